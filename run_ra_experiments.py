@@ -0,0 +1,202 @@
+#!/usr/bin/env python3
+"""
+Rogue RA Experiment Runner and Plot Generator
+
+This script runs the RA spoof example with different parameter combinations, with
+and without the RA guard on the switch, and generates plots showing the relationship
+between the parameters and the percentage of clients hijacked by the rogue router.
+"""
+
+import os
+import subprocess
+from itertools import product
+
+import matplotlib.pyplot as plt
+import pandas as pd
+
+CSV_FILE = "ra-spoof-results.csv"
+
+
+def remove_csv_file():
+    """Remove the existing CSV file if it exists."""
+    if os.path.exists(CSV_FILE):
+        os.remove(CSV_FILE)
+        print(f"Removed existing {CSV_FILE}")
+
+
+def run_simulation(nClients, raInterval, rogueStart, prefixFlood, raGuard, logEnabled=False):
+    """Run a single simulation with the given parameters."""
+    cmd = [
+        "./ns3",
+        "run",
+        "ra-spoof-example",
+        "--",
+        f"--nClients={nClients}",
+        f"--raInterval={raInterval}",
+        f"--rogueStart={rogueStart}",
+        f"--prefixFlood={str(prefixFlood).lower()}",
+        f"--raGuard={str(raGuard).lower()}",
+    ]
+
+    if logEnabled:
+        cmd.append("--logEnabled=true")
+
+    print(f"Running: {' '.join(cmd)}")
+
+    try:
+        subprocess.run(cmd, capture_output=True, text=True, check=True)
+        print("✓ Simulation completed successfully")
+        return True
+    except subprocess.CalledProcessError as e:
+        print(f"✗ Simulation failed: {e}")
+        print(f"Error output: {e.stderr}")
+        return False
+
+
+def run_all_experiments():
+    """Run all parameter combinations."""
+    # Parameter values to test
+    nClients_values = [10, 50, 100, 200]
+    raInterval_values = [50, 200, 1000]
+    rogueStart_values = [0.05, 1.0, 5.0]
+    prefixFlood_values = [False, True]
+    raGuard_values = [False, True]
+
+    remove_csv_file()
+
+    combinations = list(
+        product(
+            nClients_values, raInterval_values, rogueStart_values, prefixFlood_values, raGuard_values
+        )
+    )
+    print(f"Starting experiments with {len(combinations)} total combinations...")
+
+    for index, (nClients, raInterval, rogueStart, prefixFlood, raGuard) in enumerate(combinations):
+        print(f"\n[{index + 1}/{len(combinations)}] Testing parameters:")
+        print(
+            f"  nClients={nClients}, raInterval={raInterval}, rogueStart={rogueStart}, "
+            f"prefixFlood={prefixFlood}, raGuard={raGuard}"
+        )
+        if not run_simulation(nClients, raInterval, rogueStart, prefixFlood, raGuard):
+            print("Skipping remaining combinations due to failure")
+            return False
+
+    print(f"\n✓ All {len(combinations)} experiments completed successfully!")
+    return True
+
+
+def load_and_validate_data():
+    """Load the CSV data and validate it."""
+    if not os.path.exists(CSV_FILE):
+        print(f"Error: {CSV_FILE} not found!")
+        return None
+
+    try:
+        df = pd.read_csv(CSV_FILE)
+        print(f"Loaded {len(df)} records from CSV file")
+        print(f"Columns: {list(df.columns)}")
+        return df
+    except Exception as e:
+        print(f"Error loading CSV file: {e}")
+        return None
+
+
+def create_plots(df):
+    """Create one figure per prefix flood mode."""
+    if df is None or df.empty:
+        print("No data to plot!")
+        return
+
+    output_dir = "output"
+    if not os.path.exists(output_dir):
+        os.makedirs(output_dir)
+        print(f"Created output directory: {output_dir}")
+
+    nClients_values = sorted(df["nClients"].unique())
+    for prefixFlood in sorted(df["prefixFlood"].unique()):
+        df_mode = df[df["prefixFlood"] == prefixFlood]
+        mode = "flood" if prefixFlood else "single"
+
+        fig, axes = plt.subplots(2, 2, figsize=(15, 12))
+        fig.suptitle(f"Rogue RA Attack Results (prefix mode: {mode})", fontsize=16)
+
+        # Plot 1 and 2: raInterval vs roguePercentage, without and with the RA guard
+        for ax, raGuard in ((axes[0, 0], 0), (axes[0, 1], 1)):
+            df_guard = df_mode[df_mode["raGuard"] == raGuard]
+            for nClients in nClients_values:
+                data = df_guard[df_guard["nClients"] == nClients]
+                if not data.empty:
+                    grouped = data.groupby("raInterval")["roguePercentage"].mean()
+                    ax.plot(grouped.index, grouped.values, "o-", label=f"nClients={nClients}")
+            ax.set_xlabel("Rogue RA Interval (ms)")
+            ax.set_ylabel("Clients with a Rogue Default Route (%)")
+            ax.set_title(f"RA Interval vs Rogue Percentage ({'with' if raGuard else 'no'} RA guard)")
+            ax.set_xscale("log")
+            ax.legend()
+            ax.grid(True, alpha=0.3)
+
+        # Plot 3: rogueStart vs roguePercentage (no guard)
+        ax3 = axes[1, 0]
+        df_noguard = df_mode[df_mode["raGuard"] == 0]
+        for nClients in nClients_values:
+            data = df_noguard[df_noguard["nClients"] == nClients]
+            if not data.empty:
+                grouped = data.groupby("rogueStart")["roguePercentage"].mean()
+                ax3.plot(grouped.index, grouped.values, "o-", label=f"nClients={nClients}")
+        ax3.set_xlabel("Rogue Router Start Time (s)")
+        ax3.set_ylabel("Clients with a Rogue Default Route (%)")
+        ax3.set_title("Rogue Start Time vs Rogue Percentage (no RA guard)")
+        ax3.legend()
+        ax3.grid(True, alpha=0.3)
+
+        # Plot 4: RAs dropped by the guard vs raInterval
+        ax4 = axes[1, 1]
+        df_guard = df_mode[df_mode["raGuard"] == 1]
+        grouped = df_guard.groupby("raInterval")["droppedRas"].mean()
+        ax4.plot(grouped.index, grouped.values, "o-", color="red", linewidth=2, markersize=8)
+        ax4.set_xlabel("Rogue RA Interval (ms)")
+        ax4.set_ylabel("RAs Dropped by the RA Guard")
+        ax4.set_title("RA Interval vs Dropped RAs")
+        ax4.set_xscale("log")
+        ax4.grid(True, alpha=0.3)
+
+        plt.tight_layout()
+
+        filename = os.path.join(output_dir, f"ra_spoof_results_{mode}.png")
+        plt.savefig(filename, dpi=300, bbox_inches="tight")
+        print(f"Saved plot: {filename}")
+        plt.close()
+
+
+def main():
+    """Main function to run experiments and generate plots."""
+    print("Rogue RA Experiment Runner and Plot Generator")
+    print("=" * 50)
+
+    if not os.path.exists("./ns3"):
+        print("Error: ./ns3 executable not found in current directory!")
+        print("Please run this script from the ns-3 directory.")
+        return
+
+    print("\nStep 1: Running all experiments...")
+    if not run_all_experiments():
+        print("Experiments failed. Exiting.")
+        return
+
+    print("\nStep 2: Loading experiment data...")
+    df = load_and_validate_data()
+    if df is None:
+        print("Failed to load data. Exiting.")
+        return
+
+    print("\nStep 3: Generating plots...")
+    create_plots(df)
+
+    print("\n✓ All tasks completed successfully!")
+    print("Generated files:")
+    print(f"  - {CSV_FILE} (experiment data)")
+    print("  - output/ra_spoof_results_*.png (plots)")
+
+
+if __name__ == "__main__":
+    main()
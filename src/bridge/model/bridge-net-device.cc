@@ -74,6 +74,7 @@ BridgeNetDevice::DoDispose()
         *iter = nullptr;
     }
     m_ports.clear();
+    m_ingressFilter = IngressFilterCallback();
     m_channel = nullptr;
     m_node = nullptr;
     NetDevice::DoDispose();
@@ -90,6 +91,12 @@ BridgeNetDevice::ReceiveFromDevice(Ptr<NetDevice> incomingPort,
     NS_LOG_FUNCTION_NOARGS();
     NS_LOG_DEBUG("UID is " << packet->GetUid());
 
+    if (!m_ingressFilter.IsNull() && !m_ingressFilter(incomingPort, packet, protocol, src, dst))
+    {
+        NS_LOG_LOGIC("Frame dropped by the ingress filter");
+        return;
+    }
+
     Mac48Address src48 = Mac48Address::ConvertFrom(src);
     Mac48Address dst48 = Mac48Address::ConvertFrom(dst);
 
@@ -237,6 +244,13 @@ BridgeNetDevice::GetNBridgePorts() const
     return m_ports.size();
 }
 
+void
+BridgeNetDevice::SetIngressFilter(IngressFilterCallback filter)
+{
+    NS_LOG_FUNCTION_NOARGS();
+    m_ingressFilter = filter;
+}
+
 Ptr<NetDevice>
 BridgeNetDevice::GetBridgePort(uint32_t n) const
 {
@@ -103,6 +103,30 @@ class BridgeNetDevice : public NetDevice
      */
     Ptr<NetDevice> GetBridgePort(uint32_t n) const;
 
+    /**
+     * @brief Callback deciding whether a frame received on a port enters the bridge.
+     *
+     * The arguments are the incoming port, the packet, the protocol (e.g., Ethertype),
+     * the source and the destination addresses.  The callback returns false to drop
+     * the frame.
+     */
+    typedef Callback<bool,
+                     Ptr<NetDevice>,
+                     Ptr<const Packet>,
+                     uint16_t,
+                     const Address&,
+                     const Address&>
+        IngressFilterCallback;
+
+    /**
+     * @brief Set the filter applied to every frame received on a bridge port.
+     * @param filter the filter, or a null callback to accept all the frames
+     *
+     * The filter runs before any learning or forwarding, and it is called
+     * for every received frame: it should be cheap.
+     */
+    void SetIngressFilter(IngressFilterCallback filter);
+
     // inherited from NetDevice base class.
     void SetIfIndex(const uint32_t index) override;
     uint32_t GetIfIndex() const override;
@@ -196,6 +220,7 @@ class BridgeNetDevice : public NetDevice
   private:
     NetDevice::ReceiveCallback m_rxCallback;               //!< receive callback
     NetDevice::PromiscReceiveCallback m_promiscRxCallback; //!< promiscuous receive callback
+    IngressFilterCallback m_ingressFilter;                 //!< ingress filter
 
     Mac48Address m_address; //!< MAC address of the NetDevice
     Time m_expirationTime;  //!< time it takes for learned MAC state to expire
@@ -147,6 +147,30 @@ const char* NS_GLOBAL_VALUE = "name=value[;...]";
  */
 const char* NS_LOG = "component=option[|option...][:...]";
 
+/**
+ * @ingroup core-environ
+ * @brief Write the log messages to a binary log.
+ *
+ * The messages enabled by #NS_LOG are recorded in this file instead of
+ * being printed on \c std::clog.  The file is printed as text by the
+ * \c print-binary-log utility.
+ *
+ * <dl class="params">
+ *   <dt>%Parameters</dt>
+ *   <dd>
+ *     <table class="params">
+ *       <tr>
+ *         <td class="paramname">file</td>
+ *         <td>The binary log to write.</td>
+ *       </tr>
+ *     </table>
+ *   </dd>
+ * </dl>
+ *
+ * Referenced by ns3::BinaryLogEnvVarCheck(), in \ref log-binary.cc.
+ */
+const char* NS_LOG_BINARY = "file";
+
 /**
  * @ingroup core-environ
  * @brief Where to make temporary directories.
@@ -19,6 +19,9 @@
 
 #include <functional>
 #include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
 #include <vector>
@@ -218,6 +221,13 @@ typedef std::vector<std::shared_ptr<CallbackComponentBase>> CallbackComponentVec
  * @ingroup callbackimpl
  * CallbackImpl class with varying numbers of argument types
  *
+ * The callable object and the bound arguments are stored by the derived
+ * classes FunctorCallbackImpl and BoundCallbackImpl, in the same
+ * allocation as the CallbackImpl, and invoked through a single function
+ * pointer.  The callback components, used only by the equality test, are
+ * built once, on the first call to GetComponents(), which may happen
+ * concurrently on a Callback shared by several threads.
+ *
  * @tparam R \explicit The return type of the Callback.
  * @tparam UArgs \explicit The types of any arguments to the Callback.
  */
@@ -225,25 +235,14 @@ template <typename R, typename... UArgs>
 class CallbackImpl : public CallbackImplBase
 {
   public:
-    /**
-     * Constructor.
-     *
-     * @param func the callable object
-     * @param components the callback components (callable object and bound arguments)
-     */
-    CallbackImpl(std::function<R(UArgs...)> func, const CallbackComponentVector& components)
-        : m_func(func),
-          m_components(components)
-    {
-    }
-
     /**
      * Get the stored function.
-     * @return A const reference to the stored function.
+     * @return A function invoking this callback implementation.
      */
-    const std::function<R(UArgs...)>& GetFunction() const
+    std::function<R(UArgs...)> GetFunction() const
     {
-        return m_func;
+        Ptr<const CallbackImpl> impl(this);
+        return [impl](UArgs... uargs) -> R { return (*impl)(std::forward<UArgs>(uargs)...); };
     }
 
     /**
@@ -252,6 +251,7 @@ class CallbackImpl : public CallbackImplBase
      */
     const CallbackComponentVector& GetComponents() const
     {
+        std::call_once(m_componentsBuilt, [this]() { m_components = DoGetComponents(); });
         return m_components;
     }
 
@@ -263,7 +263,7 @@ class CallbackImpl : public CallbackImplBase
      */
     R operator()(UArgs... uargs) const
     {
-        return m_func(uargs...);
+        return m_invoke(this, std::forward<UArgs>(uargs)...);
     }
 
     bool IsEqual(Ptr<const CallbackImplBase> other) const override
@@ -275,26 +275,33 @@ class CallbackImpl : public CallbackImplBase
         {
             return false;
         }
+        if (otherDerived == this)
+        {
+            return true;
+        }
+
+        const auto& components = GetComponents();
+        const auto& otherComponents = otherDerived->GetComponents();
 
         // if the two callback implementations are made of a distinct number of
         // components, they are different
-        if (m_components.size() != otherDerived->GetComponents().size())
+        if (components.size() != otherComponents.size())
         {
             return false;
         }
 
         // the two functions are equal if they compare equal or the shared pointers
         // point to the same locations
-        if (!m_components.at(0)->IsEqual(otherDerived->GetComponents().at(0)) &&
-            m_components.at(0) != otherDerived->GetComponents().at(0))
+        if (!components.at(0)->IsEqual(otherComponents.at(0)) &&
+            components.at(0) != otherComponents.at(0))
         {
             return false;
         }
 
         // check if the remaining components are equal one by one
-        for (std::size_t i = 1; i < m_components.size(); i++)
+        for (std::size_t i = 1; i < components.size(); i++)
         {
-            if (!m_components.at(i)->IsEqual(otherDerived->GetComponents().at(i)))
+            if (!components.at(i)->IsEqual(otherComponents.at(i)))
             {
                 return false;
             }
@@ -327,12 +334,193 @@ class CallbackImpl : public CallbackImplBase
         return id;
     }
 
+  protected:
+    /** Type of the function invoking the stored callable object. */
+    using Invoker = R (*)(const CallbackImpl*, UArgs...);
+
+    /**
+     * Constructor.
+     *
+     * @param invoke The function invoking the stored callable object.
+     */
+    CallbackImpl(Invoker invoke)
+        : m_invoke(invoke)
+    {
+    }
+
+    /**
+     * Build the callback components.
+     * @return The callable object and the bound arguments, if any.
+     */
+    virtual CallbackComponentVector DoGetComponents() const = 0;
+
+  private:
+    /// Invokes the callable object stored by the derived class
+    Invoker m_invoke;
+
+    /// Stores the original callable object and the bound arguments, once built
+    mutable CallbackComponentVector m_components;
+    /// Guards the construction of m_components
+    mutable std::once_flag m_componentsBuilt;
+};
+
+/**
+ * @ingroup callbackimpl
+ * CallbackImpl storing a callable object and the values of its first
+ * arguments.
+ *
+ * @tparam T \explicit The type of the callable object.
+ * @tparam BTuple \explicit The tuple of the types of the bound arguments.
+ * @tparam R \explicit The return type of the Callback.
+ * @tparam UArgs \explicit The types of any arguments to the Callback.
+ */
+template <typename T, typename BTuple, typename R, typename... UArgs>
+class FunctorCallbackImpl;
+
+/**
+ * @ingroup callbackimpl
+ * Partial specialization of FunctorCallbackImpl unpacking the types of
+ * the bound arguments.
+ *
+ * @tparam T \explicit The type of the callable object.
+ * @tparam BArgs \explicit The types of the bound arguments.
+ * @tparam R \explicit The return type of the Callback.
+ * @tparam UArgs \explicit The types of any arguments to the Callback.
+ */
+template <typename T, typename... BArgs, typename R, typename... UArgs>
+class FunctorCallbackImpl<T, std::tuple<BArgs...>, R, UArgs...> : public CallbackImpl<R, UArgs...>
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * @param func The callable object
+     * @param bargs The values of the bound arguments
+     */
+    FunctorCallbackImpl(T func, BArgs... bargs)
+        : CallbackImpl<R, UArgs...>(&FunctorCallbackImpl::Invoke),
+          m_func(std::move(func)),
+          m_bargs(std::move(bargs)...)
+    {
+    }
+
+  private:
+    /**
+     * Invoke the callable object.
+     *
+     * @param impl This callback implementation
+     * @param uargs The arguments to the Callback
+     * @return Callback value
+     */
+    static R Invoke(const CallbackImpl<R, UArgs...>* impl, UArgs... uargs)
+    {
+        auto self = static_cast<const FunctorCallbackImpl*>(impl);
+        return std::apply(
+            [&](auto&... bargs) -> R {
+                if constexpr (std::is_void_v<R>)
+                {
+                    std::invoke(self->m_func, bargs..., std::forward<UArgs>(uargs)...);
+                }
+                else
+                {
+                    return std::invoke(self->m_func, bargs..., std::forward<UArgs>(uargs)...);
+                }
+            },
+            self->m_bargs);
+    }
+
+    CallbackComponentVector DoGetComponents() const override
+    {
+        // The original function is comparable if it is a function pointer or
+        // a pointer to a member function or a pointer to a member data.
+        constexpr bool isComp =
+            std::is_function_v<std::remove_pointer_t<T>> || std::is_member_pointer_v<T>;
+
+        return std::apply(
+            [this](const auto&... bargs) {
+                return CallbackComponentVector(
+                    {std::make_shared<CallbackComponent<T, isComp>>(m_func),
+                     std::make_shared<CallbackComponent<BArgs>>(bargs)...});
+            },
+            m_bargs);
+    }
+
+    mutable T m_func;                     //!< The callable object
+    mutable std::tuple<BArgs...> m_bargs; //!< The values of the bound arguments
+};
+
+/**
+ * @ingroup callbackimpl
+ * CallbackImpl binding the first arguments of another CallbackImpl.
+ *
+ * @tparam BImpl \explicit The type of the other CallbackImpl.
+ * @tparam BTuple \explicit The tuple of the types of the bound arguments.
+ * @tparam R \explicit The return type of the Callback.
+ * @tparam UArgs \explicit The types of any arguments to the Callback.
+ */
+template <typename BImpl, typename BTuple, typename R, typename... UArgs>
+class BoundCallbackImpl;
+
+/**
+ * @ingroup callbackimpl
+ * Partial specialization of BoundCallbackImpl unpacking the types of
+ * the bound arguments.
+ *
+ * @tparam BImpl \explicit The type of the other CallbackImpl.
+ * @tparam BArgs \explicit The types of the bound arguments.
+ * @tparam R \explicit The return type of the Callback.
+ * @tparam UArgs \explicit The types of any arguments to the Callback.
+ */
+template <typename BImpl, typename... BArgs, typename R, typename... UArgs>
+class BoundCallbackImpl<BImpl, std::tuple<BArgs...>, R, UArgs...>
+    : public CallbackImpl<R, UArgs...>
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * @param impl The other callback implementation
+     * @param bargs The values of the bound arguments
+     */
+    BoundCallbackImpl(Ptr<BImpl> impl, BArgs... bargs)
+        : CallbackImpl<R, UArgs...>(&BoundCallbackImpl::Invoke),
+          m_impl(impl),
+          m_bargs(std::move(bargs)...)
+    {
+    }
+
   private:
-    /// Stores the callable object associated with this callback (as a lambda)
-    std::function<R(UArgs...)> m_func;
+    /**
+     * Invoke the other callback implementation.
+     *
+     * @param impl This callback implementation
+     * @param uargs The arguments to the Callback
+     * @return Callback value
+     */
+    static R Invoke(const CallbackImpl<R, UArgs...>* impl, UArgs... uargs)
+    {
+        auto self = static_cast<const BoundCallbackImpl*>(impl);
+        return std::apply(
+            [&](auto&... bargs) -> R {
+                return (*self->m_impl)(bargs..., std::forward<UArgs>(uargs)...);
+            },
+            self->m_bargs);
+    }
+
+    CallbackComponentVector DoGetComponents() const override
+    {
+        CallbackComponentVector components(m_impl->GetComponents());
+        std::apply(
+            [&components](const auto&... bargs) {
+                components.insert(components.end(),
+                                  {std::make_shared<CallbackComponent<BArgs>>(bargs)...});
+            },
+            m_bargs);
+        return components;
+    }
 
-    /// Stores the original callable object and the bound arguments, if any
-    std::vector<std::shared_ptr<CallbackComponentBase>> m_components;
+    Ptr<BImpl> m_impl;                    //!< The other callback implementation
+    mutable std::tuple<BArgs...> m_bargs; //!< The values of the bound arguments
 };
 
 /**
@@ -448,17 +636,10 @@ class Callback : public CallbackBase
     template <typename... BArgs>
     Callback(const Callback<R, BArgs..., UArgs...>& cb, BArgs... bargs)
     {
-        auto f = cb.DoPeekImpl()->GetFunction();
-
-        CallbackComponentVector components(cb.DoPeekImpl()->GetComponents());
-        components.insert(components.end(),
-                          {std::make_shared<CallbackComponent<std::decay_t<BArgs>>>(bargs)...});
-
-        m_impl = Create<CallbackImpl<R, UArgs...>>(
-            [f, bargs...](auto&&... uargs) -> R {
-                return f(bargs..., std::forward<decltype(uargs)>(uargs)...);
-            },
-            components);
+        m_impl = Create<BoundCallbackImpl<CallbackImpl<R, BArgs..., UArgs...>,
+                                          std::tuple<BArgs...>,
+                                          R,
+                                          UArgs...>>(cb.DoPeekImpl(), bargs...);
     }
 
     /**
@@ -480,23 +661,7 @@ class Callback : public CallbackBase
                                int> = 0>
     Callback(T func, BArgs... bargs)
     {
-        // store the function in a std::function object
-        std::function<R(BArgs..., UArgs...)> f(func);
-
-        // The original function is comparable if it is a function pointer or
-        // a pointer to a member function or a pointer to a member data.
-        constexpr bool isComp =
-            std::is_function_v<std::remove_pointer_t<T>> || std::is_member_pointer_v<T>;
-
-        CallbackComponentVector components(
-            {std::make_shared<CallbackComponent<T, isComp>>(func),
-             std::make_shared<CallbackComponent<std::decay_t<BArgs>>>(bargs)...});
-
-        m_impl = Create<CallbackImpl<R, UArgs...>>(
-            [f, bargs...](auto&&... uargs) -> R {
-                return f(bargs..., std::forward<decltype(uargs)>(uargs)...);
-            },
-            components);
+        m_impl = Create<FunctorCallbackImpl<T, std::tuple<BArgs...>, R, UArgs...>>(func, bargs...);
     }
 
   private:
@@ -516,17 +681,13 @@ class Callback : public CallbackBase
     {
         Callback<R, std::tuple_element_t<sizeof...(bargs) + INDEX, std::tuple<UArgs...>>...> cb;
 
-        const auto f = DoPeekImpl()->GetFunction();
-
-        CallbackComponentVector components(DoPeekImpl()->GetComponents());
-        components.insert(components.end(),
-                          {std::make_shared<CallbackComponent<std::decay_t<BoundArgs>>>(bargs)...});
-
-        cb.m_impl = Create<std::remove_pointer_t<decltype(cb.DoPeekImpl())>>(
-            [f, bargs...](auto&&... uargs) mutable {
-                return f(bargs..., std::forward<decltype(uargs)>(uargs)...);
-            },
-            components);
+        cb.m_impl = Create<BoundCallbackImpl<CallbackImpl<R, UArgs...>,
+                                             std::tuple<std::decay_t<BoundArgs>...>,
+                                             R,
+                                             std::tuple_element_t<sizeof...(bargs) + INDEX,
+                                                                  std::tuple<UArgs...>>...>>(
+            DoPeekImpl(),
+            std::forward<BoundArgs>(bargs)...);
 
         return cb;
     }
@@ -571,7 +732,11 @@ class Callback : public CallbackBase
      */
     R operator()(UArgs... uargs) const
     {
-        return (*(DoPeekImpl()))(uargs...);
+        // Keep the bound object alive until the call returns, even if the
+        // callable drops the last other reference to it, e.g., by releasing
+        // the owner of this Callback.
+        Ptr<CallbackImpl<R, UArgs...>> impl(DoPeekImpl());
+        return (*impl)(std::forward<UArgs>(uargs)...);
     }
 
     /**
@@ -660,6 +825,59 @@ operator!=(Callback<R, Args...> a, Callback<R, Args...> b)
     return !a.IsEqual(b);
 }
 
+/**
+ * @ingroup callbackimpl
+ * The type of the Callback left after binding the first arguments of
+ * a function.
+ *
+ * @tparam N \explicit The number of bound arguments.
+ * @tparam R \explicit The return type of the function.
+ * @tparam Args \explicit The types of the arguments of the function.
+ */
+template <std::size_t N, typename R, typename... Args>
+struct BoundCallbackType
+{
+    /**
+     * Declare the Callback type.
+     * @return The Callback taking the arguments of index N and following.
+     */
+    template <std::size_t... INDEX>
+    static auto Make(std::index_sequence<INDEX...>)
+        -> Callback<R, std::tuple_element_t<N + INDEX, std::tuple<Args...>>...>;
+
+    /** The Callback type. */
+    using Type = decltype(Make(std::make_index_sequence<sizeof...(Args) - N>{}));
+
+    /**
+     * Declare the CallbackImpl type of a callable object and bound arguments.
+     * @return The FunctorCallbackImpl of the Callback type.
+     */
+    template <typename T, typename BTuple, std::size_t... INDEX>
+    static auto MakeImpl(std::index_sequence<INDEX...>)
+        -> FunctorCallbackImpl<T,
+                               BTuple,
+                               R,
+                               std::tuple_element_t<N + INDEX, std::tuple<Args...>>...>;
+
+    /**
+     * Build a Callback holding a callable object and its bound arguments in
+     * a single CallbackImpl.
+     *
+     * @tparam T \deduced The type of the callable object.
+     * @tparam BArgs \deduced The types of the bound arguments.
+     * @param [in] func The callable object.
+     * @param [in] bargs The values of the bound arguments.
+     * @return The Callback.
+     */
+    template <typename T, typename... BArgs>
+    static Type Bind(T func, BArgs... bargs)
+    {
+        using Impl = decltype(MakeImpl<T, std::tuple<BArgs...>>(
+            std::make_index_sequence<sizeof...(Args) - N>{}));
+        return Type(Create<Impl>(func, bargs...));
+    }
+};
+
 /**
  * @{
  */
@@ -744,7 +962,9 @@ template <typename R, typename... Args, typename... BArgs>
 auto
 MakeBoundCallback(R (*fnPtr)(Args...), BArgs&&... bargs)
 {
-    return Callback<R, Args...>(fnPtr).Bind(std::forward<BArgs>(bargs)...);
+    return BoundCallbackType<sizeof...(BArgs), R, Args...>::Bind(
+        fnPtr,
+        std::decay_t<BArgs>(std::forward<BArgs>(bargs))...);
 }
 
 /**
@@ -765,14 +985,14 @@ template <typename T, typename OBJ, typename R, typename... Args, typename... BA
 auto
 MakeCallback(R (T::*memPtr)(Args...), OBJ objPtr, BArgs... bargs)
 {
-    return Callback<R, Args...>(memPtr, objPtr).Bind(bargs...);
+    return BoundCallbackType<sizeof...(BArgs), R, Args...>::Bind(memPtr, objPtr, bargs...);
 }
 
 template <typename T, typename OBJ, typename R, typename... Args, typename... BArgs>
 auto
 MakeCallback(R (T::*memPtr)(Args...) const, OBJ objPtr, BArgs... bargs)
 {
-    return Callback<R, Args...>(memPtr, objPtr).Bind(bargs...);
+    return BoundCallbackType<sizeof...(BArgs), R, Args...>::Bind(memPtr, objPtr, bargs...);
 }
 
 /**@}*/
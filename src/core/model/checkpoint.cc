@@ -0,0 +1,275 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "checkpoint.h"
+
+#include "abort.h"
+#include "log.h"
+#include "rng-seed-manager.h"
+#include "simulator.h"
+
+#include <cstring> // memcpy
+#include <fstream>
+#include <iterator>
+
+/**
+ * @file
+ * @ingroup checkpoint
+ * ns3::Checkpoint, ns3::CheckpointWriter and ns3::CheckpointReader
+ * implementations.
+ */
+
+/**
+ * @ingroup checkpoint
+ * Unnamed namespace for checkpoint.cc
+ */
+namespace
+{
+
+/** The first bytes of a checkpoint file. */
+const char MAGIC[] = "NS3CKPT1";
+
+/**
+ * Append a value to a buffer, in host byte order.
+ * @param [in,out] data The buffer.
+ * @param [in] value The value.
+ */
+template <typename T>
+void
+Append(std::string& data, T value)
+{
+    data.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+} // unnamed namespace
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("Checkpoint");
+
+void
+CheckpointWriter::WriteU8(uint8_t value)
+{
+    Append(m_data, value);
+}
+
+void
+CheckpointWriter::WriteU32(uint32_t value)
+{
+    Append(m_data, value);
+}
+
+void
+CheckpointWriter::WriteU64(uint64_t value)
+{
+    Append(m_data, value);
+}
+
+void
+CheckpointWriter::WriteDouble(double value)
+{
+    Append(m_data, value);
+}
+
+void
+CheckpointWriter::WriteString(const std::string& value)
+{
+    WriteU32(value.size());
+    m_data.append(value);
+}
+
+void
+CheckpointWriter::WriteTime(const Time& value)
+{
+    Append(m_data, value.GetTimeStep());
+}
+
+void
+CheckpointWriter::Write(const uint8_t* buffer, uint32_t size)
+{
+    m_data.append(reinterpret_cast<const char*>(buffer), size);
+}
+
+const std::string&
+CheckpointWriter::GetData() const
+{
+    return m_data;
+}
+
+CheckpointReader::CheckpointReader(const std::string& data)
+    : m_data(data),
+      m_offset(0)
+{
+}
+
+uint8_t
+CheckpointReader::ReadU8()
+{
+    uint8_t value;
+    Read(&value, sizeof(value));
+    return value;
+}
+
+uint32_t
+CheckpointReader::ReadU32()
+{
+    uint32_t value;
+    Read(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+    return value;
+}
+
+uint64_t
+CheckpointReader::ReadU64()
+{
+    uint64_t value;
+    Read(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+    return value;
+}
+
+double
+CheckpointReader::ReadDouble()
+{
+    double value;
+    Read(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+    return value;
+}
+
+std::string
+CheckpointReader::ReadString()
+{
+    uint32_t size = ReadU32();
+    NS_ABORT_MSG_IF(size > m_data.size() - m_offset, "Truncated checkpoint section");
+    std::string value = m_data.substr(m_offset, size);
+    m_offset += size;
+    return value;
+}
+
+Time
+CheckpointReader::ReadTime()
+{
+    int64_t value;
+    Read(reinterpret_cast<uint8_t*>(&value), sizeof(value));
+    return TimeStep(value);
+}
+
+void
+CheckpointReader::Read(uint8_t* buffer, uint32_t size)
+{
+    NS_ABORT_MSG_IF(size > m_data.size() - m_offset, "Truncated checkpoint section");
+    std::memcpy(buffer, m_data.data() + m_offset, size);
+    m_offset += size;
+}
+
+bool
+CheckpointReader::IsEnd() const
+{
+    return m_offset == m_data.size();
+}
+
+Checkpoint::Checkpoint()
+    : m_time(Simulator::Now()),
+      m_seed(RngSeedManager::GetSeed()),
+      m_run(RngSeedManager::GetRun())
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+Checkpoint::Add(const std::string& name, const Checkpointable& object)
+{
+    NS_LOG_FUNCTION(this << name);
+    CheckpointWriter writer;
+    object.SaveCheckpoint(writer);
+    m_sections[name] = writer.GetData();
+}
+
+bool
+Checkpoint::Has(const std::string& name) const
+{
+    return m_sections.contains(name);
+}
+
+void
+Checkpoint::Restore(const std::string& name, Checkpointable& object) const
+{
+    NS_LOG_FUNCTION(this << name);
+    auto it = m_sections.find(name);
+    NS_ABORT_MSG_IF(it == m_sections.end(), "No checkpoint section " << name);
+    CheckpointReader reader(it->second);
+    object.RestoreCheckpoint(reader);
+    NS_ABORT_MSG_UNLESS(reader.IsEnd(), "Checkpoint section " << name << " not entirely read");
+}
+
+Time
+Checkpoint::GetTime() const
+{
+    return m_time;
+}
+
+uint32_t
+Checkpoint::GetSeed() const
+{
+    return m_seed;
+}
+
+uint64_t
+Checkpoint::GetRun() const
+{
+    return m_run;
+}
+
+void
+Checkpoint::Save(const std::string& filename) const
+{
+    NS_LOG_FUNCTION(this << filename);
+    CheckpointWriter writer;
+    writer.Write(reinterpret_cast<const uint8_t*>(MAGIC), sizeof(MAGIC) - 1);
+    writer.WriteU8(Time::GetResolution());
+    writer.WriteTime(m_time);
+    writer.WriteU32(m_seed);
+    writer.WriteU64(m_run);
+    writer.WriteU32(m_sections.size());
+    for (const auto& [name, data] : m_sections)
+    {
+        writer.WriteString(name);
+        writer.WriteString(data);
+    }
+
+    std::ofstream os(filename, std::ios::binary | std::ios::trunc);
+    os.write(writer.GetData().data(), writer.GetData().size());
+    NS_ABORT_MSG_UNLESS(os, "Can't write checkpoint " << filename);
+}
+
+Checkpoint
+Checkpoint::Load(const std::string& filename)
+{
+    NS_LOG_FUNCTION(filename);
+    std::ifstream is(filename, std::ios::binary);
+    NS_ABORT_MSG_UNLESS(is.is_open(), "Can't open checkpoint " << filename);
+    std::string data((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+
+    CheckpointReader reader(data);
+    std::string magic(sizeof(MAGIC) - 1, '\0');
+    NS_ABORT_MSG_IF(data.size() < magic.size(), filename << " is not a checkpoint");
+    reader.Read(reinterpret_cast<uint8_t*>(magic.data()), magic.size());
+    NS_ABORT_MSG_IF(magic != MAGIC, filename << " is not a checkpoint");
+    NS_ABORT_MSG_IF(reader.ReadU8() != Time::GetResolution(),
+                    "Checkpoint " << filename << " has another time resolution");
+
+    Checkpoint checkpoint;
+    checkpoint.m_time = reader.ReadTime();
+    checkpoint.m_seed = reader.ReadU32();
+    checkpoint.m_run = reader.ReadU64();
+    uint32_t n = reader.ReadU32();
+    for (uint32_t i = 0; i < n; i++)
+    {
+        std::string name = reader.ReadString();
+        checkpoint.m_sections[name] = reader.ReadString();
+    }
+    NS_ABORT_MSG_UNLESS(reader.IsEnd(), "Trailing bytes in checkpoint " << filename);
+    return checkpoint;
+}
+
+} // namespace ns3
@@ -0,0 +1,249 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef NS3_CHECKPOINT_H
+#define NS3_CHECKPOINT_H
+
+#include "nstime.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+/**
+ * @file
+ * @ingroup checkpoint
+ * ns3::Checkpoint, ns3::Checkpointable, ns3::CheckpointWriter and
+ * ns3::CheckpointReader declarations.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup core
+ * @defgroup checkpoint Checkpoint and restore
+ *
+ * Save the state of a simulation at some time, and resume from it in
+ * another process, e.g., to run many variants of a scenario from the same
+ * warm state.
+ *
+ * A checkpoint holds the simulation time and a section for each
+ * model that opted in by implementing ns3::Checkpointable.  The pending
+ * events are not saved, since they are arbitrary callbacks: the process
+ * restoring the checkpoint builds the same scenario, calls
+ * Simulator::SetStartTime() before scheduling any event, and then
+ * restores each model, which reschedules its own timers.
+ */
+
+/**
+ * @ingroup checkpoint
+ * Serialize the values of a checkpoint section.
+ */
+class CheckpointWriter
+{
+  public:
+    /**
+     * Write an unsigned 8-bit value.
+     * @param [in] value The value.
+     */
+    void WriteU8(uint8_t value);
+    /**
+     * Write an unsigned 32-bit value.
+     * @param [in] value The value.
+     */
+    void WriteU32(uint32_t value);
+    /**
+     * Write an unsigned 64-bit value.
+     * @param [in] value The value.
+     */
+    void WriteU64(uint64_t value);
+    /**
+     * Write a double.
+     * @param [in] value The value.
+     */
+    void WriteDouble(double value);
+    /**
+     * Write a string.
+     * @param [in] value The string.
+     */
+    void WriteString(const std::string& value);
+    /**
+     * Write a Time, as a number of time steps.
+     * @param [in] value The time.
+     */
+    void WriteTime(const Time& value);
+    /**
+     * Write raw bytes.
+     * @param [in] buffer The bytes.
+     * @param [in] size The number of bytes.
+     */
+    void Write(const uint8_t* buffer, uint32_t size);
+
+    /**
+     * Get the serialized values.
+     * @returns The serialized values.
+     */
+    const std::string& GetData() const;
+
+  private:
+    std::string m_data; //!< The serialized values.
+};
+
+/**
+ * @ingroup checkpoint
+ * Deserialize the values of a checkpoint section, in the order they
+ * were written by a CheckpointWriter.
+ *
+ * Reading past the end of the section is a fatal error.
+ */
+class CheckpointReader
+{
+  public:
+    /**
+     * Constructor.
+     * @param [in] data The serialized values.
+     */
+    CheckpointReader(const std::string& data);
+
+    /** @returns An unsigned 8-bit value. */
+    uint8_t ReadU8();
+    /** @returns An unsigned 32-bit value. */
+    uint32_t ReadU32();
+    /** @returns An unsigned 64-bit value. */
+    uint64_t ReadU64();
+    /** @returns A double. */
+    double ReadDouble();
+    /** @returns A string. */
+    std::string ReadString();
+    /** @returns A Time. */
+    Time ReadTime();
+    /**
+     * Read raw bytes.
+     * @param [out] buffer The bytes.
+     * @param [in] size The number of bytes.
+     */
+    void Read(uint8_t* buffer, uint32_t size);
+
+    /**
+     * Check if all the values were read.
+     * @returns \c true if the end of the section is reached.
+     */
+    bool IsEnd() const;
+
+  private:
+    const std::string& m_data; //!< The serialized values.
+    std::size_t m_offset;      //!< The offset of the next value.
+};
+
+/**
+ * @ingroup checkpoint
+ * Interface of the models whose state can be saved in a checkpoint.
+ */
+class Checkpointable
+{
+  public:
+    /** Destructor. */
+    virtual ~Checkpointable() = default;
+
+    /**
+     * Save the state of the model.
+     * @param [in] writer The section of the model.
+     */
+    virtual void SaveCheckpoint(CheckpointWriter& writer) const = 0;
+    /**
+     * Restore the state saved by SaveCheckpoint().
+     *
+     * This is called after Simulator::SetStartTime(), so that Simulator::Now()
+     * is the checkpoint time and the model can reschedule its timers.
+     *
+     * @param [in] reader The section of the model.
+     */
+    virtual void RestoreCheckpoint(CheckpointReader& reader) = 0;
+};
+
+/**
+ * @ingroup checkpoint
+ * The saved state of a simulation: the simulation time, the seed and
+ * run numbers, and the named sections of the models.
+ *
+ * @code
+ *   // Process saving the state at 100 s
+ *   Simulator::Stop(Seconds(100));
+ *   Simulator::Run();
+ *   Checkpoint checkpoint;
+ *   checkpoint.Add("/NodeList/0/$ns3::Ipv4L3Protocol", *ipv4);
+ *   checkpoint.Save("warm.ckpt");
+ *
+ *   // Process restoring it
+ *   Checkpoint checkpoint = Checkpoint::Load("warm.ckpt");
+ *   Simulator::SetStartTime(checkpoint.GetTime());
+ *   // ... build the scenario ...
+ *   checkpoint.Restore("/NodeList/0/$ns3::Ipv4L3Protocol", *ipv4);
+ * @endcode
+ */
+class Checkpoint
+{
+  public:
+    /**
+     * Start a checkpoint of the current simulation time, seed and run.
+     */
+    Checkpoint();
+
+    /**
+     * Save the state of a model.
+     * @param [in] name The name of the section.
+     * @param [in] object The model.
+     */
+    void Add(const std::string& name, const Checkpointable& object);
+    /**
+     * Check if the checkpoint holds a section.
+     * @param [in] name The name of the section.
+     * @returns \c true if the section exists.
+     */
+    bool Has(const std::string& name) const;
+    /**
+     * Restore the state of a model.
+     *
+     * It is a fatal error if the section does not exist, or if the model
+     * does not read all of it.
+     *
+     * @param [in] name The name of the section.
+     * @param [in] object The model.
+     */
+    void Restore(const std::string& name, Checkpointable& object) const;
+
+    /** @returns The simulation time of the checkpoint. */
+    Time GetTime() const;
+    /** @returns The seed number of the checkpointed simulation. */
+    uint32_t GetSeed() const;
+    /** @returns The run number of the checkpointed simulation. */
+    uint64_t GetRun() const;
+
+    /**
+     * Write the checkpoint to a file.
+     * @param [in] filename The file.
+     */
+    void Save(const std::string& filename) const;
+    /**
+     * Read a checkpoint from a file written by Save().
+     *
+     * It is a fatal error if the file can't be read, or if the time
+     * resolution is not the one of the checkpointed simulation.
+     *
+     * @param [in] filename The file.
+     * @returns The checkpoint.
+     */
+    static Checkpoint Load(const std::string& filename);
+
+  private:
+    Time m_time;                                   //!< The simulation time.
+    uint32_t m_seed;                               //!< The seed number.
+    uint64_t m_run;                                //!< The run number.
+    std::map<std::string, std::string> m_sections; //!< The sections, by name.
+};
+
+} // namespace ns3
+
+#endif /* NS3_CHECKPOINT_H */
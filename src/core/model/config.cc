@@ -15,6 +15,7 @@
 #include "pointer.h"
 #include "singleton.h"
 
+#include <map>
 #include <sstream>
 
 /**
@@ -327,6 +328,25 @@ class Resolver
     void Resolve(Ptr<Object> root);
 
   private:
+    /** An attribute through which a Config path continues to other objects. */
+    struct PathAttribute
+    {
+        std::string name;                      //!< The attribute name
+        Ptr<const AttributeAccessor> accessor; //!< The attribute accessor
+        bool container;                        //!< Object container or pointer attribute
+    };
+
+    /**
+     * Get the pointer and object container attributes of a TypeId and its
+     * parents matching a path item.  The result is cached, so that the
+     * attributes of each TypeId are looked up once per item.
+     *
+     * @param [in] tid The TypeId of the current object on the Config path.
+     * @param [in] item The path item, an attribute name or \c "*".
+     * @returns The matching attributes.
+     */
+    static const std::vector<PathAttribute>& GetPathAttributes(TypeId tid,
+                                                               const std::string& item);
     /** Ensure the Config path starts and ends with a '/'. */
     void Canonicalize();
     /**
@@ -526,65 +546,61 @@ Resolver::DoResolve(std::string path, Ptr<Object> root)
     else
     {
         // this is a normal attribute.
-        TypeId tid;
-        TypeId nextTid = root->GetInstanceTypeId();
         bool foundMatch = false;
-
-        do
+        for (const auto& attribute : GetPathAttributes(root->GetInstanceTypeId(), item))
         {
-            tid = nextTid;
-
-            for (uint32_t i = 0; i < tid.GetAttributeN(); i++)
+            if (!attribute.container)
             {
-                TypeId::AttributeInformation info;
-                info = tid.GetAttribute(i);
-                if (info.name != item && item != "*")
+                NS_LOG_DEBUG("GetAttribute(ptr)=" << attribute.name
+                                                  << " on path=" << GetResolvedPath());
+                PointerValue pValue;
+                root->GetAttribute(attribute.name, pValue);
+                Ptr<Object> object = pValue.Get<Object>();
+                if (!object)
                 {
+                    NS_LOG_ERROR("Requested object name=\"" << item << "\" exists on path=\""
+                                                            << GetResolvedPath()
+                                                            << "\""
+                                                               " but is null.");
                     continue;
                 }
-                // attempt to cast to a pointer checker.
-                const auto pChecker =
-                    dynamic_cast<const PointerChecker*>(PeekPointer(info.checker));
-                if (pChecker != nullptr)
-                {
-                    NS_LOG_DEBUG("GetAttribute(ptr)=" << info.name
-                                                      << " on path=" << GetResolvedPath());
-                    PointerValue pValue;
-                    root->GetAttribute(info.name, pValue);
-                    Ptr<Object> object = pValue.Get<Object>();
-                    if (!object)
-                    {
-                        NS_LOG_ERROR("Requested object name=\"" << item << "\" exists on path=\""
-                                                                << GetResolvedPath()
-                                                                << "\""
-                                                                   " but is null.");
-                        continue;
-                    }
-                    foundMatch = true;
-                    m_workStack.push_back(info.name);
-                    DoResolve(pathLeft, object);
-                    m_workStack.pop_back();
-                }
-                // attempt to cast to an object vector.
-                const auto vectorChecker =
-                    dynamic_cast<const ObjectPtrContainerChecker*>(PeekPointer(info.checker));
-                if (vectorChecker != nullptr)
+                foundMatch = true;
+                m_workStack.push_back(attribute.name);
+                DoResolve(pathLeft, object);
+                m_workStack.pop_back();
+                continue;
+            }
+
+            NS_LOG_DEBUG("GetAttribute(vector)=" << attribute.name << " on path="
+                                                 << GetResolvedPath() << pathLeft);
+            foundMatch = true;
+            m_workStack.push_back(attribute.name);
+            // Look up a single index directly in the container, instead of
+            // matching it against every index of the container.
+            std::string::size_type end = pathLeft.find('/', 1);
+            std::string index = pathLeft.substr(1, end - 1);
+            const auto accessor =
+                dynamic_cast<const ObjectPtrContainerAccessor*>(PeekPointer(attribute.accessor));
+            if (end != std::string::npos && !index.empty() && index.size() < 10 &&
+                index.find_first_not_of("0123456789") == std::string::npos && accessor)
+            {
+                std::size_t i = std::stoul(index);
+                Ptr<Object> object = accessor->Find(PeekPointer(root), i);
+                if (object)
                 {
-                    NS_LOG_DEBUG("GetAttribute(vector)=" << info.name << " on path="
-                                                         << GetResolvedPath() << pathLeft);
-                    foundMatch = true;
-                    ObjectPtrContainerValue vector;
-                    root->GetAttribute(info.name, vector);
-                    m_workStack.push_back(info.name);
-                    DoArrayResolve(pathLeft, vector);
+                    m_workStack.push_back(std::to_string(i));
+                    DoResolve(pathLeft.substr(end), object);
                     m_workStack.pop_back();
                 }
-                // this could be anything else and we don't know what to do with it.
-                // So, we just ignore it.
             }
-
-            nextTid = tid.GetParent();
-        } while (nextTid != tid);
+            else
+            {
+                ObjectPtrContainerValue vector;
+                root->GetAttribute(attribute.name, vector);
+                DoArrayResolve(pathLeft, vector);
+            }
+            m_workStack.pop_back();
+        }
 
         if (!foundMatch)
         {
@@ -595,6 +611,57 @@ Resolver::DoResolve(std::string path, Ptr<Object> root)
     }
 }
 
+const std::vector<Resolver::PathAttribute>&
+Resolver::GetPathAttributes(TypeId tid, const std::string& item)
+{
+    NS_LOG_FUNCTION(tid << item);
+
+    // The attributes of a TypeId do not change once an object of that type exists.
+    static std::map<std::pair<uint16_t, std::string>, std::vector<PathAttribute>> cache;
+    auto [it, inserted] = cache.try_emplace({tid.GetUid(), item});
+    if (!inserted)
+    {
+        return it->second;
+    }
+
+    auto add = [&attributes = it->second](const TypeId::AttributeInformation& info) {
+        // attempt to cast to a pointer checker.
+        if (dynamic_cast<const PointerChecker*>(PeekPointer(info.checker)) != nullptr)
+        {
+            attributes.push_back({info.name, info.accessor, false});
+        }
+        // attempt to cast to an object vector.
+        if (dynamic_cast<const ObjectPtrContainerChecker*>(PeekPointer(info.checker)) != nullptr)
+        {
+            attributes.push_back({info.name, info.accessor, true});
+        }
+        // this could be anything else and we don't know what to do with it.
+        // So, we just ignore it.
+    };
+
+    if (item != "*")
+    {
+        auto [found, owner, info] = TypeId::FindAttribute(tid, item);
+        if (found)
+        {
+            add(info);
+        }
+        return it->second;
+    }
+
+    TypeId nextTid = tid;
+    do
+    {
+        tid = nextTid;
+        for (std::size_t i = 0; i < tid.GetAttributeN(); i++)
+        {
+            add(tid.GetAttribute(i));
+        }
+        nextTid = tid.GetParent();
+    } while (nextTid != tid);
+    return it->second;
+}
+
 void
 Resolver::DoArrayResolve(std::string path, const ObjectPtrContainerValue& container)
 {
@@ -645,6 +712,10 @@ class ConfigImpl : public Singleton<ConfigImpl>
     void DisconnectWithoutContext(std::string path, const CallbackBase& cb);
     /** @copydoc ns3::Config::Disconnect() */
     void Disconnect(std::string path, const CallbackBase& cb);
+    /** @copydoc ns3::Config::ConnectEach() */
+    std::size_t ConnectEach(
+        std::string path,
+        std::function<CallbackBase(Ptr<Object> object, const std::string& context)> makeCallback);
     /** @copydoc ns3::Config::LookupMatches() */
     MatchContainer LookupMatches(std::string path);
 
@@ -773,6 +844,30 @@ ConfigImpl::Disconnect(std::string path, const CallbackBase& cb)
     container.Disconnect(leaf, cb);
 }
 
+std::size_t
+ConfigImpl::ConnectEach(
+    std::string path,
+    std::function<CallbackBase(Ptr<Object> object, const std::string& context)> makeCallback)
+{
+    NS_LOG_FUNCTION(this << path);
+
+    std::string root;
+    std::string leaf;
+    ParsePath(path, &root, &leaf);
+    MatchContainer container = LookupMatches(root);
+    std::size_t connected = 0;
+    for (std::size_t i = 0; i < container.GetN(); i++)
+    {
+        Ptr<Object> object = container.Get(i);
+        CallbackBase cb = makeCallback(object, container.GetMatchedPath(i) + leaf);
+        if (cb.GetImpl() && object->TraceConnectWithoutContext(leaf, cb))
+        {
+            connected++;
+        }
+    }
+    return connected;
+}
+
 MatchContainer
 ConfigImpl::LookupMatches(std::string path)
 {
@@ -990,6 +1085,15 @@ Disconnect(std::string path, const CallbackBase& cb)
     ConfigImpl::Get()->Disconnect(path, cb);
 }
 
+std::size_t
+ConnectEach(
+    std::string path,
+    std::function<CallbackBase(Ptr<Object> object, const std::string& context)> makeCallback)
+{
+    NS_LOG_FUNCTION(path);
+    return ConfigImpl::Get()->ConnectEach(path, makeCallback);
+}
+
 MatchContainer
 LookupMatches(std::string path)
 {
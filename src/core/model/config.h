@@ -10,6 +10,7 @@
 
 #include "ptr.h"
 
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -171,6 +172,25 @@ bool ConnectFailSafe(std::string path, const CallbackBase& cb);
  * This function undoes the work of Config::ConnectWithContext.
  */
 void Disconnect(std::string path, const CallbackBase& cb);
+/**
+ * @ingroup config
+ * @param [in] path A path to match trace sources.
+ * @param [in] makeCallback The function which builds the callback to
+ *   connect to the trace source of an object, given the object and the
+ *   path of its trace source; a null callback leaves the trace source
+ *   unconnected.
+ *
+ * This function resolves the input path once, usually with wildcards,
+ * and connects a callback built for each matching object to its trace
+ * source, without a context.  It is much faster than calling
+ * Config::ConnectWithoutContext() with the path of each object, e.g.,
+ * to connect a sink bound to per-node state to the nodes of a large
+ * topology.
+ * @returns The number of trace sources connected.
+ */
+std::size_t ConnectEach(
+    std::string path,
+    std::function<CallbackBase(Ptr<Object> object, const std::string& context)> makeCallback);
 
 /**
  * @ingroup config
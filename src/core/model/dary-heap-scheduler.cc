@@ -0,0 +1,225 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "dary-heap-scheduler.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+#include "uinteger.h"
+
+#include <algorithm>
+
+/**
+ * @file
+ * @ingroup scheduler
+ * Implementation of ns3::DaryHeapScheduler class.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("DaryHeapScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(DaryHeapScheduler);
+
+TypeId
+DaryHeapScheduler::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::DaryHeapScheduler")
+            .SetParent<Scheduler>()
+            .SetGroupName("Core")
+            .AddConstructor<DaryHeapScheduler>()
+            .AddAttribute("Arity",
+                          "The number of children of each node of the heap.",
+                          UintegerValue(4),
+                          MakeUintegerAccessor(&DaryHeapScheduler::SetArity,
+                                               &DaryHeapScheduler::GetArity),
+                          MakeUintegerChecker<uint32_t>(2, 64));
+    return tid;
+}
+
+DaryHeapScheduler::DaryHeapScheduler()
+    : m_arity(4)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+DaryHeapScheduler::~DaryHeapScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+DaryHeapScheduler::SetArity(uint32_t arity)
+{
+    NS_LOG_FUNCTION(this << arity);
+    NS_ASSERT_MSG(m_keys.empty(), "The arity can not be changed while events are scheduled");
+    m_arity = arity;
+}
+
+uint32_t
+DaryHeapScheduler::GetArity() const
+{
+    return m_arity;
+}
+
+void
+DaryHeapScheduler::SiftUp(std::size_t index)
+{
+    Scheduler::EventKey key = m_keys[index];
+    EventImpl* impl = m_impls[index];
+    while (index > 0)
+    {
+        std::size_t parent = (index - 1) / m_arity;
+        if (!(key < m_keys[parent]))
+        {
+            break;
+        }
+        m_keys[index] = m_keys[parent];
+        m_impls[index] = m_impls[parent];
+        index = parent;
+    }
+    m_keys[index] = key;
+    m_impls[index] = impl;
+}
+
+void
+DaryHeapScheduler::SiftDown(std::size_t index)
+{
+    std::size_t size = m_keys.size();
+    Scheduler::EventKey key = m_keys[index];
+    EventImpl* impl = m_impls[index];
+    while (true)
+    {
+        std::size_t first = index * m_arity + 1;
+        if (first >= size)
+        {
+            break;
+        }
+        std::size_t last = std::min(first + m_arity, size);
+        std::size_t smallest = first;
+        for (std::size_t child = first + 1; child < last; child++)
+        {
+            if (m_keys[child] < m_keys[smallest])
+            {
+                smallest = child;
+            }
+        }
+        if (!(m_keys[smallest] < key))
+        {
+            break;
+        }
+        m_keys[index] = m_keys[smallest];
+        m_impls[index] = m_impls[smallest];
+        index = smallest;
+    }
+    m_keys[index] = key;
+    m_impls[index] = impl;
+}
+
+void
+DaryHeapScheduler::PopRoot()
+{
+    m_keys.front() = m_keys.back();
+    m_impls.front() = m_impls.back();
+    m_keys.pop_back();
+    m_impls.pop_back();
+    if (!m_keys.empty())
+    {
+        SiftDown(0);
+    }
+}
+
+void
+DaryHeapScheduler::DropRemoved()
+{
+    while (!m_removed.empty() && !m_keys.empty() && m_removed.erase(m_keys.front().m_uid) > 0)
+    {
+        PopRoot();
+    }
+}
+
+void
+DaryHeapScheduler::Compact()
+{
+    NS_LOG_FUNCTION(this << m_keys.size() << m_removed.size());
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < m_keys.size(); i++)
+    {
+        if (m_removed.count(m_keys[i].m_uid) == 0)
+        {
+            m_keys[kept] = m_keys[i];
+            m_impls[kept] = m_impls[i];
+            kept++;
+        }
+    }
+    m_keys.resize(kept);
+    m_impls.resize(kept);
+    m_removed.clear();
+    for (std::size_t i = kept / m_arity + 1; i > 0; i--)
+    {
+        if (i - 1 < kept)
+        {
+            SiftDown(i - 1);
+        }
+    }
+}
+
+void
+DaryHeapScheduler::Insert(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << &ev);
+    m_keys.push_back(ev.key);
+    m_impls.push_back(ev.impl);
+    SiftUp(m_keys.size() - 1);
+}
+
+bool
+DaryHeapScheduler::IsEmpty() const
+{
+    NS_LOG_FUNCTION(this);
+    // the root is never a removed event
+    return m_keys.empty();
+}
+
+Scheduler::Event
+DaryHeapScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    return Event{m_impls.front(), m_keys.front()};
+}
+
+Scheduler::Event
+DaryHeapScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    Event next{m_impls.front(), m_keys.front()};
+    PopRoot();
+    DropRemoved();
+    return next;
+}
+
+void
+DaryHeapScheduler::Remove(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << &ev);
+    NS_ASSERT(!IsEmpty());
+    if (m_keys.front().m_uid == ev.key.m_uid)
+    {
+        PopRoot();
+        DropRemoved();
+        return;
+    }
+    m_removed.insert(ev.key.m_uid);
+    if (m_removed.size() > m_keys.size() / 2)
+    {
+        Compact();
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,125 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef DARY_HEAP_SCHEDULER_H
+#define DARY_HEAP_SCHEDULER_H
+
+#include "scheduler.h"
+
+#include <stdint.h>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup scheduler
+ * ns3::DaryHeapScheduler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup scheduler
+ * @brief a d-ary heap event scheduler
+ *
+ * This scheduler keeps the events in an implicit d-ary heap (4-ary by
+ * default, see the \c Arity attribute).  Compared to the binary
+ * HeapScheduler, a d-ary heap is shallower, so inserting an event needs
+ * fewer comparisons, and the children of a node are contiguous in memory,
+ * so that removing the next event touches fewer cache lines.
+ *
+ * The sort keys and the EventImpl pointers are stored in two parallel
+ * vectors: the heap operations only read the keys, which are packed
+ * together, and move the pointers along.
+ *
+ * Remove() is lazy: unless the event is the next one, its uid is only
+ * recorded, and the entry is discarded when it reaches the top of the heap.
+ * The heap is compacted when more than half of its entries have been
+ * removed.
+ *
+ * @par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | Logarithmic     | Heapify
+ * IsEmpty()    | Constant        | Explicit queue size
+ * PeekNext()   | Constant        | Heap kept sorted
+ * Remove()     | Constant        | Lazy removal, amortized compaction
+ * RemoveNext() | Logarithmic     | Heapify
+ *
+ * @par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | 2 x 3 x `sizeof (*)` + hash set  | Two `std::vector`, removed uids
+ * Per Event | 0                                | Events stored in `std::vector` directly
+ */
+class DaryHeapScheduler : public Scheduler
+{
+  public:
+    /**
+     *  Register this type.
+     *  @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    DaryHeapScheduler();
+    /** Destructor. */
+    ~DaryHeapScheduler() override;
+
+    // Inherited
+    void Insert(const Scheduler::Event& ev) override;
+    bool IsEmpty() const override;
+    Scheduler::Event PeekNext() const override;
+    Scheduler::Event RemoveNext() override;
+    void Remove(const Scheduler::Event& ev) override;
+
+  private:
+    /**
+     * Set the number of children of each node.
+     * The arity can only be changed while the heap is empty.
+     *
+     * @param [in] arity The number of children.
+     */
+    void SetArity(uint32_t arity);
+    /**
+     * Get the number of children of each node.
+     *
+     * @returns The number of children.
+     */
+    uint32_t GetArity() const;
+    /**
+     * Move an entry up to its position.
+     *
+     * @param [in] index The index of the entry.
+     */
+    void SiftUp(std::size_t index);
+    /**
+     * Move an entry down to its position.
+     *
+     * @param [in] index The index of the entry.
+     */
+    void SiftDown(std::size_t index);
+    /** Remove the root of the heap. */
+    void PopRoot();
+    /** Discard the removed entries at the top of the heap. */
+    void DropRemoved();
+    /** Discard all the removed entries and rebuild the heap. */
+    void Compact();
+
+    /** The event keys, managed as a heap. */
+    std::vector<Scheduler::EventKey> m_keys;
+    /** The event implementations, in the same order as m_keys. */
+    std::vector<EventImpl*> m_impls;
+    /** The uids of the events removed but still in the heap. */
+    std::unordered_set<uint32_t> m_removed;
+    /** The number of children of each node. */
+    uint32_t m_arity;
+};
+
+} // namespace ns3
+
+#endif /* DARY_HEAP_SCHEDULER_H */
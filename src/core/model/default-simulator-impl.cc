@@ -8,12 +8,16 @@
 
 #include "default-simulator-impl.h"
 
+#include "abort.h"
 #include "assert.h"
+#include "boolean.h"
 #include "log.h"
 #include "scheduler.h"
 #include "simulator.h"
+#include "uinteger.h"
 
 #include <cmath>
+#include <iostream>
 
 /**
  * @file
@@ -34,14 +38,30 @@ NS_OBJECT_ENSURE_REGISTERED(DefaultSimulatorImpl);
 TypeId
 DefaultSimulatorImpl::GetTypeId()
 {
-    static TypeId tid = TypeId("ns3::DefaultSimulatorImpl")
-                            .SetParent<SimulatorImpl>()
-                            .SetGroupName("Core")
-                            .AddConstructor<DefaultSimulatorImpl>();
+    static TypeId tid =
+        TypeId("ns3::DefaultSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Core")
+            .AddConstructor<DefaultSimulatorImpl>()
+            .AddAttribute("EventProfile",
+                          "Count the events and their wall clock time per event function "
+                          "and per context, and print a report at Simulator::Destroy().",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&DefaultSimulatorImpl::SetEventProfile,
+                                              &DefaultSimulatorImpl::GetEventProfile),
+                          MakeBooleanChecker())
+            .AddAttribute("EventProfileTopN",
+                          "The number of event functions and of contexts in the report "
+                          "of the event profiler.",
+                          UintegerValue(10),
+                          MakeUintegerAccessor(&DefaultSimulatorImpl::m_profileTopN),
+                          MakeUintegerChecker<uint32_t>());
     return tid;
 }
 
 DefaultSimulatorImpl::DefaultSimulatorImpl()
+    : m_eventsWithContextRing(EVENTS_WITH_CONTEXT_RING_SIZE),
+      m_eventsWithContextOverflow(false)
 {
     NS_LOG_FUNCTION(this);
     m_stop = false;
@@ -51,7 +71,7 @@ DefaultSimulatorImpl::DefaultSimulatorImpl()
     m_currentContext = Simulator::NO_CONTEXT;
     m_unscheduledEvents = 0;
     m_eventCount = 0;
-    m_eventsWithContextEmpty = true;
+    m_profileTopN = 10;
     m_mainThreadId = std::this_thread::get_id();
 }
 
@@ -89,6 +109,36 @@ DefaultSimulatorImpl::Destroy()
             ev->Invoke();
         }
     }
+    if (m_profiler)
+    {
+        m_profiler->Report(std::cout, m_profileTopN);
+    }
+}
+
+void
+DefaultSimulatorImpl::SetEventProfile(bool enable)
+{
+    NS_LOG_FUNCTION(this << enable);
+    if (!enable)
+    {
+        m_profiler.reset();
+    }
+    else if (!m_profiler)
+    {
+        m_profiler = std::make_unique<EventProfiler>();
+    }
+}
+
+bool
+DefaultSimulatorImpl::GetEventProfile() const
+{
+    return m_profiler != nullptr;
+}
+
+const EventProfiler*
+DefaultSimulatorImpl::GetEventProfiler() const
+{
+    return m_profiler.get();
 }
 
 void
@@ -108,6 +158,17 @@ DefaultSimulatorImpl::SetScheduler(ObjectFactory schedulerFactory)
     m_events = scheduler;
 }
 
+void
+DefaultSimulatorImpl::SetStartTime(const Time& time)
+{
+    NS_LOG_FUNCTION(this << time);
+    NS_ASSERT_MSG(time.IsPositive(), "Negative start time " << time);
+    ProcessEventsWithContext();
+    NS_ABORT_MSG_UNLESS(m_events->IsEmpty() && m_eventCount == 0,
+                        "The start time must be set before scheduling any event");
+    m_currentTs = time.GetTimeStep();
+}
+
 // System ID for non-distributed simulation is always zero
 uint32_t
 DefaultSimulatorImpl::GetSystemId() const
@@ -130,7 +191,14 @@ DefaultSimulatorImpl::ProcessOneEvent()
     m_currentTs = next.key.m_ts;
     m_currentContext = next.key.m_context;
     m_currentUid = next.key.m_uid;
-    next.impl->Invoke();
+    if (m_profiler) [[unlikely]]
+    {
+        m_profiler->Invoke(next.impl, next.key.m_context);
+    }
+    else
+    {
+        next.impl->Invoke();
+    }
     next.impl->Unref();
 
     ProcessEventsWithContext();
@@ -142,33 +210,50 @@ DefaultSimulatorImpl::IsFinished() const
     return m_events->IsEmpty() || m_stop;
 }
 
+void
+DefaultSimulatorImpl::InsertEventWithContext(const EventWithContext& event)
+{
+    Scheduler::Event ev;
+    ev.impl = event.event;
+    ev.key.m_ts = m_currentTs + event.timestamp;
+    ev.key.m_context = event.context;
+    ev.key.m_uid = m_uid;
+    m_uid++;
+    m_unscheduledEvents++;
+    m_events->Insert(ev);
+}
+
 void
 DefaultSimulatorImpl::ProcessEventsWithContext()
 {
-    if (m_eventsWithContextEmpty)
+    if (m_eventsWithContextRing.IsDrained() &&
+        !m_eventsWithContextOverflow.load(std::memory_order_acquire))
     {
         return;
     }
 
-    // swap queues
+    EventWithContext event;
+    while (m_eventsWithContextRing.Pop(event))
+    {
+        InsertEventWithContext(event);
+    }
+
+    // The overflow list holds events pushed after the ones in the ring:
+    // wait for the slots still being written by other threads.
+    if (!m_eventsWithContextRing.IsDrained() ||
+        !m_eventsWithContextOverflow.load(std::memory_order_acquire))
+    {
+        return;
+    }
     EventsWithContext eventsWithContext;
     {
         std::unique_lock lock{m_eventsWithContextMutex};
         m_eventsWithContext.swap(eventsWithContext);
-        m_eventsWithContextEmpty = true;
+        m_eventsWithContextOverflow.store(false, std::memory_order_release);
     }
-    while (!eventsWithContext.empty())
+    for (const auto& overflowEvent : eventsWithContext)
     {
-        EventWithContext event = eventsWithContext.front();
-        eventsWithContext.pop_front();
-        Scheduler::Event ev;
-        ev.impl = event.event;
-        ev.key.m_ts = m_currentTs + event.timestamp;
-        ev.key.m_context = event.context;
-        ev.key.m_uid = m_uid;
-        m_uid++;
-        m_unscheduledEvents++;
-        m_events->Insert(ev);
+        InsertEventWithContext(overflowEvent);
     }
 }
 
@@ -253,10 +338,12 @@ DefaultSimulatorImpl::ScheduleWithContext(uint32_t context, const Time& delay, E
         // Current time added in ProcessEventsWithContext()
         ev.timestamp = delay.GetTimeStep();
         ev.event = event;
+        if (m_eventsWithContextOverflow.load(std::memory_order_acquire) ||
+            !m_eventsWithContextRing.Push(ev))
         {
             std::unique_lock lock{m_eventsWithContextMutex};
             m_eventsWithContext.push_back(ev);
-            m_eventsWithContextEmpty = false;
+            m_eventsWithContextOverflow.store(true, std::memory_order_release);
         }
     }
 }
@@ -9,9 +9,13 @@
 #ifndef DEFAULT_SIMULATOR_IMPL_H
 #define DEFAULT_SIMULATOR_IMPL_H
 
+#include "event-profiler.h"
+#include "mpsc-ring.h"
 #include "simulator-impl.h"
 
+#include <atomic>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <thread>
 
@@ -31,6 +35,10 @@ class Scheduler;
  * @ingroup simulator
  *
  * The default single process simulator implementation.
+ *
+ * When the \c EventProfile attribute is \c true, the events are executed
+ * through an EventProfiler, and the \c EventProfileTopN most frequent
+ * event functions and contexts are printed by Simulator::Destroy().
  */
 class DefaultSimulatorImpl : public SimulatorImpl
 {
@@ -63,13 +71,32 @@ class DefaultSimulatorImpl : public SimulatorImpl
     Time GetDelayLeft(const EventId& id) const override;
     Time GetMaximumSimulationTime() const override;
     void SetScheduler(ObjectFactory schedulerFactory) override;
+    void SetStartTime(const Time& time) override;
     uint32_t GetSystemId() const override;
     uint32_t GetContext() const override;
     uint64_t GetEventCount() const override;
 
+    /**
+     * Get the event profiler.
+     * @returns The event profiler, or nullptr if the \c EventProfile
+     *          attribute is \c false.
+     */
+    const EventProfiler* GetEventProfiler() const;
+
   private:
     void DoDispose() override;
 
+    /**
+     * Enable or disable the event profiler.
+     * @param [in] enable \c true to profile the events.
+     */
+    void SetEventProfile(bool enable);
+    /**
+     * Check if the event profiler is enabled.
+     * @returns \c true if the events are profiled.
+     */
+    bool GetEventProfile() const;
+
     /** Process the next event. */
     void ProcessOneEvent();
     /** Move events from a different context into the main event queue. */
@@ -86,15 +113,28 @@ class DefaultSimulatorImpl : public SimulatorImpl
         EventImpl* event;
     };
 
+    /**
+     * Insert an event from a different context in the main event queue.
+     *
+     * @param [in] event The event.
+     */
+    void InsertEventWithContext(const EventWithContext& event);
+
+    /** Number of slots of the ring of events from a different context. */
+    static constexpr std::size_t EVENTS_WITH_CONTEXT_RING_SIZE = 4096;
+    /** Lock-free ring of the events from a different context. */
+    MpscRing<EventWithContext> m_eventsWithContextRing;
+
     /** Container type for the events from a different context. */
     typedef std::list<EventWithContext> EventsWithContext;
-    /** The container of events from a different context. */
-    EventsWithContext m_eventsWithContext;
     /**
-     * Flag \c true if all events with context have been moved to the
-     * primary event queue.
+     * The events from a different context which did not fit in the ring.
+     * While it is not empty, the other threads append their events here
+     * rather than to the ring, so that the events of a thread stay in order.
      */
-    bool m_eventsWithContextEmpty;
+    EventsWithContext m_eventsWithContext;
+    /** Flag \c true if m_eventsWithContext is not empty. */
+    std::atomic<bool> m_eventsWithContextOverflow;
     /** Mutex to control access to the list of events with context. */
     std::mutex m_eventsWithContextMutex;
 
@@ -125,6 +165,11 @@ class DefaultSimulatorImpl : public SimulatorImpl
 
     /** Main execution thread. */
     std::thread::id m_mainThreadId;
+
+    /** The event profiler, if enabled. */
+    std::unique_ptr<EventProfiler> m_profiler;
+    /** Number of event functions and contexts reported by the profiler. */
+    uint32_t m_profileTopN;
 };
 
 } // namespace ns3
@@ -8,6 +8,7 @@
 
 #include "event-impl.h"
 
+#include "event-pool.h"
 #include "log.h"
 
 /**
@@ -56,4 +57,25 @@ EventImpl::IsCancelled()
     return m_cancel;
 }
 
+void*
+EventImpl::operator new(std::size_t size)
+{
+    if (EventPool::IsEnabled())
+    {
+        return EventPool::Allocate(size);
+    }
+    return ::operator new(size);
+}
+
+void
+EventImpl::operator delete(void* p, std::size_t size)
+{
+    if (EventPool::IsEnabled())
+    {
+        EventPool::Deallocate(p, size);
+        return;
+    }
+    ::operator delete(p);
+}
+
 } // namespace ns3
@@ -10,6 +10,7 @@
 
 #include "simple-ref-count.h"
 
+#include <cstddef>
 #include <stdint.h>
 
 /**
@@ -56,6 +57,25 @@ class EventImpl : public SimpleRefCount<EventImpl>
      */
     bool IsCancelled();
 
+    /**
+     * Allocate the memory of an event.
+     *
+     * When the \ref GlobalValueEventPool "EventPool" global value is true,
+     * the memory comes from the EventPool free lists instead of the global
+     * allocator.
+     *
+     * @param [in] size The size of the event.
+     * @return The allocated memory.
+     */
+    static void* operator new(std::size_t size);
+
+    /**
+     * Release the memory of an event.
+     * @param [in] p The memory to release.
+     * @param [in] size The size of the event.
+     */
+    static void operator delete(void* p, std::size_t size);
+
   protected:
     /**
      * Implementation for Invoke().
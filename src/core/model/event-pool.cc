@@ -0,0 +1,241 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "event-pool.h"
+
+#include "boolean.h"
+#include "global-value.h"
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup events
+ * ns3::EventPool implementation.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup events
+ * @anchor GlobalValueEventPool
+ * Allocate the events from the EventPool free lists.
+ *
+ * The value is read when the first event is allocated; later changes
+ * have no effect.
+ */
+static GlobalValue g_eventPool =
+    GlobalValue("EventPool",
+                "Allocate the events from size-class free lists instead of the global allocator. "
+                "Must be set before the first event is scheduled.",
+                BooleanValue(false),
+                MakeBooleanChecker());
+
+namespace
+{
+
+/** Size granularity of the size classes, in bytes. */
+constexpr std::size_t EVENT_POOL_GRANULARITY = 16;
+/** Number of size classes. */
+constexpr std::size_t EVENT_POOL_CLASSES = EventPool::MAX_SIZE / EVENT_POOL_GRANULARITY;
+/** Number of blocks in a chunk, and in a batch moved to the shared free lists. */
+constexpr std::size_t EVENT_POOL_CHUNK_BLOCKS = 64;
+/** Largest number of blocks in a per-thread free list. */
+constexpr std::size_t EVENT_POOL_MAX_LOCAL_BLOCKS = 2 * EVENT_POOL_CHUNK_BLOCKS;
+
+/** A released block, linked in a free list. */
+struct FreeBlock
+{
+    FreeBlock* next; //!< Next released block of the same size class
+};
+
+/** A free list of blocks of the same size class. */
+struct FreeList
+{
+    FreeBlock* head{nullptr}; //!< The first block
+    std::size_t count{0};     //!< The number of blocks
+
+    /**
+     * Add a block.
+     * @param [in] block The block.
+     */
+    void Push(FreeBlock* block)
+    {
+        block->next = head;
+        head = block;
+        count++;
+    }
+
+    /**
+     * Move blocks to another list.
+     * @param [in,out] other The other list.
+     * @param [in] n The largest number of blocks to move.
+     */
+    void MoveTo(FreeList& other, std::size_t n)
+    {
+        for (; n > 0 && head != nullptr; n--)
+        {
+            FreeBlock* block = head;
+            head = block->next;
+            count--;
+            other.Push(block);
+        }
+    }
+};
+
+/** The free lists shared by all the threads, and the chunks. */
+struct SharedFreeLists
+{
+    std::mutex mutex;                          //!< Protects this structure
+    FreeList lists[EVENT_POOL_CLASSES];        //!< One free list per size class
+    std::vector<void*> chunks;                 //!< The chunks
+    std::atomic<std::size_t> reservedBytes{0}; //!< Number of bytes reserved for the chunks
+};
+
+/**
+ * Get the shared free lists, kept reachable for the lifetime of the process
+ * since threads may release their blocks after the static destructors.
+ * @return The shared free lists.
+ */
+SharedFreeLists&
+GetShared()
+{
+    static auto shared = new SharedFreeLists();
+    return *shared;
+}
+
+/**
+ * Per-thread free lists, one per size class, which give their blocks back to
+ * the shared free lists when the thread exits.
+ */
+struct LocalFreeLists
+{
+    FreeList lists[EVENT_POOL_CLASSES]; //!< One free list per size class
+
+    ~LocalFreeLists()
+    {
+        SharedFreeLists& shared = GetShared();
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        for (std::size_t i = 0; i < EVENT_POOL_CLASSES; i++)
+        {
+            lists[i].MoveTo(shared.lists[i], lists[i].count);
+        }
+    }
+};
+
+/** The free lists of the calling thread. */
+thread_local LocalFreeLists g_local;
+
+/**
+ * Refill the free list of the calling thread for a size class, from the
+ * shared free list or else from a new chunk.
+ * @param [in] sizeClass The size class.
+ */
+void
+Refill(std::size_t sizeClass)
+{
+    FreeList& local = g_local.lists[sizeClass];
+    SharedFreeLists& shared = GetShared();
+    {
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        shared.lists[sizeClass].MoveTo(local, EVENT_POOL_CHUNK_BLOCKS);
+    }
+    if (local.head != nullptr)
+    {
+        return;
+    }
+
+    std::size_t blockSize = (sizeClass + 1) * EVENT_POOL_GRANULARITY;
+    std::size_t chunkSize = blockSize * EVENT_POOL_CHUNK_BLOCKS;
+    auto chunk = static_cast<char*>(::operator new(chunkSize));
+    {
+        std::lock_guard<std::mutex> lock(shared.mutex);
+        shared.chunks.push_back(chunk);
+    }
+    shared.reservedBytes += chunkSize;
+
+    for (std::size_t i = EVENT_POOL_CHUNK_BLOCKS; i > 0; i--)
+    {
+        local.Push(reinterpret_cast<FreeBlock*>(chunk + (i - 1) * blockSize));
+    }
+}
+
+/**
+ * Move a batch of blocks of the calling thread to the shared free list.
+ * @param [in] sizeClass The size class.
+ */
+void
+Release(std::size_t sizeClass)
+{
+    SharedFreeLists& shared = GetShared();
+    std::lock_guard<std::mutex> lock(shared.mutex);
+    g_local.lists[sizeClass].MoveTo(shared.lists[sizeClass], EVENT_POOL_CHUNK_BLOCKS);
+}
+
+} // namespace
+
+void*
+EventPool::Allocate(std::size_t size)
+{
+    if (size == 0 || size > MAX_SIZE)
+    {
+        return ::operator new(size);
+    }
+    std::size_t sizeClass = (size - 1) / EVENT_POOL_GRANULARITY;
+    FreeList& local = g_local.lists[sizeClass];
+    if (local.head == nullptr)
+    {
+        Refill(sizeClass);
+    }
+    FreeBlock* block = local.head;
+    local.head = block->next;
+    local.count--;
+    return block;
+}
+
+void
+EventPool::Deallocate(void* p, std::size_t size)
+{
+    if (p == nullptr)
+    {
+        return;
+    }
+    if (size == 0 || size > MAX_SIZE)
+    {
+        ::operator delete(p);
+        return;
+    }
+    std::size_t sizeClass = (size - 1) / EVENT_POOL_GRANULARITY;
+    FreeList& local = g_local.lists[sizeClass];
+    local.Push(static_cast<FreeBlock*>(p));
+    // A thread which releases more blocks than it allocates, e.g., the blocks
+    // of the events scheduled for it by another thread, gives them back.
+    if (local.count > EVENT_POOL_MAX_LOCAL_BLOCKS)
+    {
+        Release(sizeClass);
+    }
+}
+
+bool
+EventPool::IsEnabled()
+{
+    static const bool enabled = []() {
+        BooleanValue value;
+        g_eventPool.GetValue(value);
+        return value.Get();
+    }();
+    return enabled;
+}
+
+std::size_t
+EventPool::GetReservedBytes()
+{
+    return GetShared().reservedBytes;
+}
+
+} // namespace ns3
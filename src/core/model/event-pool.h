@@ -0,0 +1,79 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef EVENT_POOL_H
+#define EVENT_POOL_H
+
+#include <cstddef>
+
+/**
+ * @file
+ * @ingroup events
+ * ns3::EventPool declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup events
+ * @brief Size-class free lists for the memory of simulation events.
+ *
+ * The memory is carved out of chunks holding a number of blocks of the same
+ * size class (multiples of 16 bytes, up to MAX_SIZE bytes).  Released blocks
+ * are kept in per-thread free lists and reused by the next allocation of the
+ * same size class, so that, in steady state, scheduling an event does not
+ * call the global allocator.  Requests larger than MAX_SIZE bytes are
+ * forwarded to the global allocator.
+ *
+ * A block can be released by a thread other than the one that allocated it,
+ * e.g., for events scheduled with Simulator::ScheduleWithContext from another
+ * thread.  A per-thread free list holds a bounded number of blocks: the
+ * extra blocks, and the blocks of an exiting thread, are moved in batches to
+ * free lists shared by all the threads, from which a thread refills its
+ * free lists before allocating a new chunk.  The memory reserved is thus
+ * bounded by the peak number of live blocks, plus the per-thread free
+ * lists.  The chunks are never returned to the system.
+ *
+ * EventImpl uses this pool when the \c EventPool global value is true.
+ */
+class EventPool
+{
+  public:
+    /** Largest size served from the free lists, in bytes. */
+    static constexpr std::size_t MAX_SIZE = 256;
+
+    /**
+     * @brief Allocate a block.
+     * @param [in] size The size of the block.
+     * @return The block.
+     */
+    static void* Allocate(std::size_t size);
+
+    /**
+     * @brief Release a block.
+     * @param [in] p The block, returned by Allocate().
+     * @param [in] size The size passed to Allocate().
+     */
+    static void Deallocate(void* p, std::size_t size);
+
+    /**
+     * Check if the events are allocated from the pool.
+     *
+     * The \ref GlobalValueEventPool "EventPool" global value is read by the
+     * first call, i.e., when the first event is allocated.
+     *
+     * @return The value of the EventPool global value at the first call.
+     */
+    static bool IsEnabled();
+
+    /**
+     * @return The number of bytes obtained from the global allocator for the chunks.
+     */
+    static std::size_t GetReservedBytes();
+};
+
+} // namespace ns3
+
+#endif /* EVENT_POOL_H */
@@ -0,0 +1,111 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "event-profiler.h"
+
+#include "demangle.h"
+#include "event-impl.h"
+#include "simulator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::EventProfiler implementation.
+ */
+
+namespace ns3
+{
+
+void
+EventProfiler::Invoke(EventImpl* event, uint32_t context)
+{
+    // Look up the type before the event runs: the event may cancel itself.
+    std::type_index type(typeid(*event));
+    auto start = std::chrono::steady_clock::now();
+    event->Invoke();
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+
+    Counters& function = m_functions[type];
+    function.count++;
+    function.nanoseconds += elapsed;
+    Counters& ctx = m_contexts[context];
+    ctx.count++;
+    ctx.nanoseconds += elapsed;
+}
+
+/**
+ * Sort profiler entries by decreasing number of events.
+ * @param [in,out] entries The entries.
+ */
+static void
+SortEntries(std::vector<EventProfiler::Entry>& entries)
+{
+    std::stable_sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.count > b.count;
+    });
+}
+
+std::vector<EventProfiler::Entry>
+EventProfiler::GetFunctions() const
+{
+    std::vector<Entry> entries;
+    for (const auto& [type, counters] : m_functions)
+    {
+        entries.push_back({Demangle(type.name()), counters.count, counters.nanoseconds});
+    }
+    SortEntries(entries);
+    return entries;
+}
+
+std::vector<EventProfiler::Entry>
+EventProfiler::GetContexts() const
+{
+    std::vector<Entry> entries;
+    for (const auto& [context, counters] : m_contexts)
+    {
+        std::string name =
+            context == Simulator::NO_CONTEXT ? "NO_CONTEXT" : std::to_string(context);
+        entries.push_back({name, counters.count, counters.nanoseconds});
+    }
+    SortEntries(entries);
+    return entries;
+}
+
+void
+EventProfiler::Report(std::ostream& os, std::size_t n) const
+{
+    uint64_t total = 0;
+    for (const auto& [type, counters] : m_functions)
+    {
+        total += counters.count;
+    }
+
+    auto print = [&os, n, total](const std::string& title, const std::vector<Entry>& entries) {
+        os << title << " (" << std::min(n, entries.size()) << " of " << entries.size() << ")"
+           << std::endl;
+        os << std::setw(12) << "events" << std::setw(8) << "%" << std::setw(12) << "ms"
+           << std::setw(10) << "ns/event" << "  name" << std::endl;
+        for (std::size_t i = 0; i < std::min(n, entries.size()); i++)
+        {
+            const Entry& entry = entries[i];
+            os << std::setw(12) << entry.count << std::setw(8) << std::fixed
+               << std::setprecision(2) << 100.0 * entry.count / total << std::setw(12)
+               << std::setprecision(3) << entry.nanoseconds / 1e6 << std::setw(10)
+               << entry.nanoseconds / entry.count << "  " << entry.name << std::endl;
+        }
+        os.unsetf(std::ios::floatfield);
+    };
+
+    os << "Event profile: " << total << " events" << std::endl;
+    print("Top event functions", GetFunctions());
+    print("Top contexts", GetContexts());
+}
+
+} // namespace ns3
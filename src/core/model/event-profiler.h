@@ -0,0 +1,98 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef EVENT_PROFILER_H
+#define EVENT_PROFILER_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::EventProfiler declaration.
+ */
+
+namespace ns3
+{
+
+class EventImpl;
+
+/**
+ * @ingroup simulator
+ * @ingroup debugging
+ *
+ * @brief Count the events executed by the simulator, and their wall clock
+ * time, per event function and per context.
+ *
+ * The event function is identified by the dynamic type of the EventImpl,
+ * e.g., the MakeEvent() instantiation for a member function, whose
+ * demangled name holds the signature of the function and its class.
+ *
+ * The DefaultSimulatorImpl uses an EventProfiler when its \c EventProfile
+ * attribute is \c true, and prints the most frequent functions and
+ * contexts when Simulator::Destroy() is called:
+ *
+ * @code
+ *     $ ./ns3 run "my-program --ns3::DefaultSimulatorImpl::EventProfile=true"
+ * @endcode
+ */
+class EventProfiler
+{
+  public:
+    /** The statistics of an event function or of a context. */
+    struct Entry
+    {
+        std::string name;        //!< The demangled function type, or the context
+        uint64_t count{0};       //!< Number of events executed
+        uint64_t nanoseconds{0}; //!< Wall clock time spent in the events
+    };
+
+    /**
+     * Invoke an event, and account for it.
+     * @param [in] event The event implementation.
+     * @param [in] context The event context.
+     */
+    void Invoke(EventImpl* event, uint32_t context);
+
+    /**
+     * Get the statistics of the event functions.
+     * @returns The entries, by decreasing number of events.
+     */
+    std::vector<Entry> GetFunctions() const;
+
+    /**
+     * Get the statistics of the contexts.
+     * @returns The entries, by decreasing number of events.
+     */
+    std::vector<Entry> GetContexts() const;
+
+    /**
+     * Print the most frequent event functions and contexts.
+     * @param [in,out] os The output stream.
+     * @param [in] n The maximum number of functions and of contexts.
+     */
+    void Report(std::ostream& os, std::size_t n) const;
+
+  private:
+    /** Number of events and wall clock time. */
+    struct Counters
+    {
+        uint64_t count{0};       //!< Number of events executed
+        uint64_t nanoseconds{0}; //!< Wall clock time spent in the events
+    };
+
+    /** Counters per event function. */
+    std::unordered_map<std::type_index, Counters> m_functions;
+    /** Counters per context. */
+    std::unordered_map<uint32_t, Counters> m_contexts;
+};
+
+} // namespace ns3
+
+#endif /* EVENT_PROFILER_H */
@@ -0,0 +1,241 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ladder-scheduler.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+
+#include <algorithm>
+#include <limits>
+
+/**
+ * @file
+ * @ingroup scheduler
+ * Implementation of ns3::LadderScheduler class.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("LadderScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(LadderScheduler);
+
+TypeId
+LadderScheduler::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::LadderScheduler")
+                            .SetParent<Scheduler>()
+                            .SetGroupName("Core")
+                            .AddConstructor<LadderScheduler>();
+    return tid;
+}
+
+LadderScheduler::LadderScheduler()
+    : m_topMin(std::numeric_limits<uint64_t>::max()),
+      m_topMax(0),
+      m_topStart(0),
+      m_rungs(MAX_RUNGS),
+      m_nRungs(0),
+      m_bottomHead(0),
+      m_size(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+LadderScheduler::~LadderScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+LadderScheduler::InitRung(std::size_t rung, uint64_t start, uint64_t span, std::size_t nEvents)
+{
+    NS_LOG_FUNCTION(this << rung << start << span << nEvents);
+    Rung& r = m_rungs[rung];
+    r.start = start;
+    r.width = std::max<uint64_t>(1, (span + nEvents - 1) / nEvents);
+    r.current = 0;
+    r.nBuckets = (span + r.width - 1) / r.width;
+    if (r.buckets.size() < r.nBuckets)
+    {
+        r.buckets.resize(r.nBuckets);
+    }
+}
+
+void
+LadderScheduler::TransferTop()
+{
+    NS_LOG_FUNCTION(this << m_top.size());
+    InitRung(0, m_topMin, m_topMax - m_topMin + 1, m_top.size());
+    Rung& r = m_rungs[0];
+    for (const auto& ev : m_top)
+    {
+        r.buckets[(ev.key.m_ts - r.start) / r.width].push_back(ev);
+    }
+    m_nRungs = 1;
+    m_topStart = r.start + r.nBuckets * r.width;
+    m_top.clear();
+    m_topMin = std::numeric_limits<uint64_t>::max();
+    m_topMax = 0;
+}
+
+void
+LadderScheduler::FillBottom()
+{
+    while (m_bottomHead == m_bottom.size())
+    {
+        m_bottom.clear();
+        m_bottomHead = 0;
+        if (m_nRungs == 0)
+        {
+            if (m_top.empty())
+            {
+                return;
+            }
+            TransferTop();
+        }
+        Rung& r = m_rungs[m_nRungs - 1];
+        while (r.current < r.nBuckets && r.buckets[r.current].empty())
+        {
+            r.current++;
+        }
+        if (r.current == r.nBuckets)
+        {
+            m_nRungs--;
+            continue;
+        }
+
+        Bucket& bucket = r.buckets[r.current];
+        uint64_t bucketStart = r.GetCurrentStart();
+        r.current++;
+        if (bucket.size() > THRESHOLD && r.width > 1 && m_nRungs < MAX_RUNGS)
+        {
+            // Spread the bucket on a finer rung.
+            NS_LOG_LOGIC("Spawn rung " << m_nRungs << " for " << bucket.size() << " events");
+            InitRung(m_nRungs, bucketStart, r.width, bucket.size());
+            Rung& child = m_rungs[m_nRungs];
+            for (const auto& ev : bucket)
+            {
+                child.buckets[(ev.key.m_ts - child.start) / child.width].push_back(ev);
+            }
+            m_nRungs++;
+        }
+        else
+        {
+            m_bottom.swap(bucket);
+            std::sort(m_bottom.begin(), m_bottom.end());
+        }
+        bucket.clear();
+    }
+}
+
+void
+LadderScheduler::InsertBottom(const Event& ev)
+{
+    if (m_bottom.size() == m_bottomHead || m_bottom.back() < ev)
+    {
+        m_bottom.push_back(ev);
+        return;
+    }
+    m_bottom.insert(std::upper_bound(m_bottom.begin() + m_bottomHead, m_bottom.end(), ev), ev);
+}
+
+std::size_t
+LadderScheduler::FindRung(uint64_t ts) const
+{
+    std::size_t rung = 0;
+    while (rung < m_nRungs && ts < m_rungs[rung].GetCurrentStart())
+    {
+        rung++;
+    }
+    return rung;
+}
+
+void
+LadderScheduler::Insert(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << &ev);
+    uint64_t ts = ev.key.m_ts;
+    m_size++;
+    if (ts >= m_topStart)
+    {
+        m_top.push_back(ev);
+        m_topMin = std::min(m_topMin, ts);
+        m_topMax = std::max(m_topMax, ts);
+        return;
+    }
+    std::size_t rung = FindRung(ts);
+    if (rung < m_nRungs)
+    {
+        Rung& r = m_rungs[rung];
+        r.buckets[(ts - r.start) / r.width].push_back(ev);
+        return;
+    }
+    InsertBottom(ev);
+}
+
+bool
+LadderScheduler::IsEmpty() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_size == 0;
+}
+
+Scheduler::Event
+LadderScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    // Refilling Bottom moves events between the tiers, but does not change
+    // the content of the scheduler.
+    const_cast<LadderScheduler*>(this)->FillBottom();
+    return m_bottom[m_bottomHead];
+}
+
+Scheduler::Event
+LadderScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    FillBottom();
+    m_size--;
+    return m_bottom[m_bottomHead++];
+}
+
+void
+LadderScheduler::Remove(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << &ev);
+    uint64_t ts = ev.key.m_ts;
+    auto sameUid = [&ev](const Event& other) { return other.key.m_uid == ev.key.m_uid; };
+    m_size--;
+    if (ts >= m_topStart)
+    {
+        // m_topMin and m_topMax are only bounds, they are not updated
+        auto it = std::find_if(m_top.begin(), m_top.end(), sameUid);
+        NS_ASSERT(it != m_top.end());
+        *it = m_top.back();
+        m_top.pop_back();
+        return;
+    }
+    std::size_t rung = FindRung(ts);
+    if (rung < m_nRungs)
+    {
+        Rung& r = m_rungs[rung];
+        Bucket& bucket = r.buckets[(ts - r.start) / r.width];
+        auto it = std::find_if(bucket.begin(), bucket.end(), sameUid);
+        NS_ASSERT(it != bucket.end());
+        *it = bucket.back();
+        bucket.pop_back();
+        return;
+    }
+    auto it = std::lower_bound(m_bottom.begin() + m_bottomHead, m_bottom.end(), ev);
+    NS_ASSERT(it != m_bottom.end() && it->key.m_uid == ev.key.m_uid);
+    m_bottom.erase(it);
+}
+
+} // namespace ns3
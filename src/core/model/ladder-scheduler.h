@@ -0,0 +1,169 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef LADDER_SCHEDULER_H
+#define LADDER_SCHEDULER_H
+
+#include "scheduler.h"
+
+#include <stdint.h>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup scheduler
+ * ns3::LadderScheduler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup scheduler
+ * @brief a ladder queue event scheduler
+ *
+ * This event scheduler implements the Ladder Queue published in
+ * ["Ladder Queue: An O(1) Priority Queue Structure for Large-Scale
+ * Discrete Event Simulation" by Wai Teng Tang, Rick Siow Mong Goh and
+ * Ian Li-Jin Thng][Tang].
+ *
+ * [Tang]: https://doi.org/10.1145/1103323.1103324 "Tang"
+ *
+ * The events are kept in three tiers:
+ *  - Top: an unsorted vector of the far future events, at or after
+ *    the end of the first rung.
+ *  - Ladder: up to MAX_RUNGS rungs of buckets.  The first rung is built from
+ *    Top when the ladder runs dry, with as many buckets as events.  When the
+ *    next bucket of the last rung holds more than THRESHOLD events, it is
+ *    spread on a new, finer, rung instead of being sorted.
+ *  - Bottom: a sorted vector of the earliest events, at most one bucket.
+ *
+ * Unlike the CalendarScheduler, the bucket width is not guessed from a
+ * sample of the events: each rung is sized from the span and the number of
+ * the events it receives, so that skewed or multi-modal time stamp
+ * distributions (e.g., microsecond link events mixed with one second
+ * timers) only spawn finer rungs where the events are dense.
+ *
+ * All the tiers and buckets are `std::vector`, which keep their capacity
+ * when they are emptied and reused.
+ *
+ * @par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | Constant        | Append to Top or a bucket
+ * IsEmpty()    | Constant        | Explicit queue size
+ * PeekNext()   | Constant        | Bottom refill amortized on the events
+ * Remove()     | ~Constant       | Search within a bucket
+ * RemoveNext() | Constant        | Bottom refill amortized on the events
+ *
+ * @par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | MAX_RUNGS + 2 x `std::vector`    | Tiers
+ * Per Event | ~`sizeof (std::vector)`          | Up to one empty bucket per event
+ */
+class LadderScheduler : public Scheduler
+{
+  public:
+    /**
+     *  Register this type.
+     *  @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    LadderScheduler();
+    /** Destructor. */
+    ~LadderScheduler() override;
+
+    // Inherited
+    void Insert(const Scheduler::Event& ev) override;
+    bool IsEmpty() const override;
+    Scheduler::Event PeekNext() const override;
+    Scheduler::Event RemoveNext() override;
+    void Remove(const Scheduler::Event& ev) override;
+
+  private:
+    /** Maximum number of rungs. */
+    static constexpr std::size_t MAX_RUNGS = 8;
+    /** Bucket size above which a new rung is spawned, instead of sorting the bucket. */
+    static constexpr std::size_t THRESHOLD = 50;
+
+    /** A bucket, or a tier, of events. */
+    typedef std::vector<Scheduler::Event> Bucket;
+
+    /** A rung of the ladder. */
+    struct Rung
+    {
+        uint64_t start;              //!< Time stamp of the start of the first bucket
+        uint64_t width;              //!< Width of the buckets
+        std::size_t current;         //!< Index of the first bucket not yet dequeued
+        std::size_t nBuckets;        //!< Number of buckets in use
+        std::vector<Bucket> buckets; //!< The buckets, possibly more than nBuckets
+
+        /**
+         * @return The time stamp of the start of the current bucket.
+         */
+        uint64_t GetCurrentStart() const
+        {
+            return start + current * width;
+        }
+    };
+
+    /**
+     * Initialize a rung covering a time span.
+     *
+     * @param [in] rung The rung index.
+     * @param [in] start The start of the span.
+     * @param [in] span The width of the span.
+     * @param [in] nEvents The number of events which will be put in the rung.
+     */
+    void InitRung(std::size_t rung, uint64_t start, uint64_t span, std::size_t nEvents);
+    /**
+     * Move the events of Top to a new first rung.
+     */
+    void TransferTop();
+    /**
+     * Refill Bottom, if empty, from the ladder.
+     */
+    void FillBottom();
+    /**
+     * Insert an event in Bottom, keeping it sorted.
+     *
+     * @param [in] ev The event.
+     */
+    void InsertBottom(const Scheduler::Event& ev);
+    /**
+     * Find the rung for a time stamp.
+     *
+     * @param [in] ts The time stamp, before m_topStart.
+     * @returns The rung index, or m_nRungs if the time stamp belongs to Bottom.
+     */
+    std::size_t FindRung(uint64_t ts) const;
+
+    /** Far future events, unsorted. */
+    Bucket m_top;
+    /** Smallest time stamp in Top. */
+    uint64_t m_topMin;
+    /** Largest time stamp in Top. */
+    uint64_t m_topMax;
+    /** Events at or after this time stamp go to Top. */
+    uint64_t m_topStart;
+    /** The rungs, possibly more than m_nRungs. */
+    std::vector<Rung> m_rungs;
+    /** Number of rungs in use. */
+    std::size_t m_nRungs;
+    /** Earliest events, sorted. */
+    Bucket m_bottom;
+    /** Index of the next event in Bottom. */
+    std::size_t m_bottomHead;
+    /** Number of events. */
+    std::size_t m_size;
+};
+
+} // namespace ns3
+
+#endif /* LADDER_SCHEDULER_H */
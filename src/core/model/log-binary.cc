@@ -0,0 +1,745 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "log-binary.h"
+
+#include "environment-variable.h"
+#include "fatal-error.h"
+#include "log.h"
+#include "node-printer.h"
+#include "simulator.h"
+#include "time-printer.h"
+
+#include <cstring> // memcpy
+#include <fstream>
+#include <iomanip>
+#include <list>
+#include <mutex>
+
+/**
+ * @file
+ * @ingroup logging
+ * ns3::BinaryLog and ns3::BinaryLogRecord implementations.
+ */
+
+/**
+ * @ingroup logging
+ * Unnamed namespace for log-binary.cc
+ */
+namespace
+{
+
+/** The first bytes of a binary log. */
+constexpr char MAGIC[8] = {'N', 'S', '3', 'B', 'L', 'O', 'G', '1'};
+
+/** Size of the buffer of a thread above which it is written to the file. */
+constexpr std::size_t FLUSH_SIZE = 64 * 1024;
+
+/** The entries of a binary log. */
+enum Entry : uint8_t
+{
+    SITE = 0,  //!< The definition of a site.
+    RECORD = 1 //!< A message.
+};
+
+/** The prefixes of a message. */
+enum Prefix : uint8_t
+{
+    PREFIX_TIME = 0x01,      //!< The simulation time, in seconds, and its precision.
+    PREFIX_TIME_TEXT = 0x02, //!< The output of a custom TimePrinter.
+    PREFIX_NODE = 0x04,      //!< The simulator context.
+    PREFIX_NODE_TEXT = 0x08, //!< The output of a custom NodePrinter.
+    PREFIX_FUNC = 0x10,      //!< The component and function names.
+    PREFIX_LEVEL = 0x20      //!< The level label.
+};
+
+/** A registered log statement. */
+struct Site
+{
+    std::string component; //!< The name of the log component.
+    std::string function;  //!< The function containing the statement.
+    uint32_t level;        //!< The LogLevel of the statement.
+    uint8_t kind;          //!< The BinaryLog::SiteKind of the statement.
+};
+
+/** The records of a thread, and its formatting streams. */
+struct ThreadBuffer
+{
+    /** Register the buffer. */
+    ThreadBuffer();
+    /** Write the records and unregister the buffer. */
+    ~ThreadBuffer();
+
+    std::vector<uint8_t> data; //!< The records not written yet.
+    std::ostringstream text;   //!< The stream formatting the values stored as text.
+    std::stringbuf context;    //!< The output of NS_LOG_APPEND_CONTEXT.
+    uint32_t depth{0};         //!< The number of records being recorded.
+};
+
+/** The binary output, shared by all the threads. */
+struct State
+{
+    std::mutex mutex;                 //!< Protects the fields below.
+    std::ofstream file;               //!< The binary output.
+    bool headerWritten{false};        //!< Whether MAGIC was written to the file.
+    std::vector<Site> sites;          //!< The registered sites.
+    std::size_t sitesWritten{0};      //!< The number of sites defined in the file.
+    std::list<ThreadBuffer*> buffers; //!< The buffers of the threads.
+};
+
+/**
+ * Get the binary output.
+ * @returns The binary output.
+ */
+State&
+GetState()
+{
+    static State state;
+    return state;
+}
+
+/**
+ * Get the buffer of the current thread.
+ * @returns The buffer.
+ */
+ThreadBuffer&
+GetThreadBuffer()
+{
+    thread_local ThreadBuffer buffer;
+    return buffer;
+}
+
+/**
+ * Append a value to an entry.
+ * @param [in,out] entry The entry.
+ * @param [in] value The value.
+ */
+template <typename T>
+void
+Append(std::string& entry, T value)
+{
+    entry.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+/**
+ * Append a string to an entry.
+ * @param [in,out] entry The entry.
+ * @param [in] value The string.
+ */
+void
+AppendString(std::string& entry, std::string_view value)
+{
+    Append(entry, static_cast<uint32_t>(value.size()));
+    entry.append(value);
+}
+
+/**
+ * Write the new sites and the records of a thread to the file.
+ * The mutex of the state must be held.
+ * @param [in,out] state The binary output.
+ * @param [in,out] data The records, cleared.
+ */
+void
+Drain(State& state, std::vector<uint8_t>& data)
+{
+    if (state.file.is_open() && !data.empty())
+    {
+        if (!state.headerWritten)
+        {
+            state.file.write(MAGIC, sizeof(MAGIC));
+            state.headerWritten = true;
+        }
+        for (; state.sitesWritten < state.sites.size(); state.sitesWritten++)
+        {
+            const Site& site = state.sites[state.sitesWritten];
+            std::string entry;
+            Append(entry, SITE);
+            Append(entry, static_cast<uint32_t>(state.sitesWritten));
+            Append(entry, site.kind);
+            Append(entry, site.level);
+            AppendString(entry, site.component);
+            AppendString(entry, site.function);
+            auto size = static_cast<uint32_t>(entry.size());
+            state.file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+            state.file.write(entry.data(), entry.size());
+        }
+        state.file.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+    data.clear();
+}
+
+ThreadBuffer::ThreadBuffer()
+{
+    data.reserve(FLUSH_SIZE + 4096);
+    State& state = GetState();
+    std::lock_guard lock(state.mutex);
+    state.buffers.push_back(this);
+}
+
+ThreadBuffer::~ThreadBuffer()
+{
+    State& state = GetState();
+    std::lock_guard lock(state.mutex);
+    Drain(state, data);
+    state.buffers.remove(this);
+}
+
+/** Reads the values of an entry. */
+class Reader
+{
+  public:
+    /**
+     * Constructor.
+     * @param [in] entry The entry.
+     */
+    Reader(const std::string& entry)
+        : m_current(entry.data()),
+          m_end(entry.data() + entry.size())
+    {
+    }
+
+    /**
+     * Read a value.
+     * @param [out] value The value.
+     * @returns \c false if the entry is too short.
+     */
+    template <typename T>
+    bool Get(T& value)
+    {
+        if (static_cast<std::size_t>(m_end - m_current) < sizeof(value))
+        {
+            return false;
+        }
+        std::memcpy(&value, m_current, sizeof(value));
+        m_current += sizeof(value);
+        return true;
+    }
+
+    /**
+     * Read a string.
+     * @param [out] value The string.
+     * @returns \c false if the entry is too short.
+     */
+    bool GetString(std::string& value)
+    {
+        uint32_t size;
+        if (!Get(size) || static_cast<std::size_t>(m_end - m_current) < size)
+        {
+            return false;
+        }
+        value.assign(m_current, size);
+        m_current += size;
+        return true;
+    }
+
+  private:
+    const char* m_current; //!< The next value.
+    const char* m_end;     //!< The end of the entry.
+};
+
+} // Unnamed namespace
+
+namespace ns3
+{
+
+bool BinaryLog::m_enabled = false;
+
+void
+BinaryLog::Open(const std::string& filename)
+{
+    Close();
+    State& state = GetState();
+
+    // Write the records when exiting, while the state is still alive.
+    static struct Closer
+    {
+        ~Closer()
+        {
+            BinaryLog::Close();
+        }
+    } closer;
+
+    std::lock_guard lock(state.mutex);
+    state.file.open(filename, std::ios::binary | std::ios::trunc);
+    if (!state.file.is_open())
+    {
+        NS_FATAL_ERROR("Can't open the binary log file " << filename);
+    }
+    state.headerWritten = false;
+    state.sitesWritten = 0;
+    m_enabled = true;
+}
+
+void
+BinaryLog::Close()
+{
+    if (!m_enabled)
+    {
+        return;
+    }
+    State& state = GetState();
+    std::lock_guard lock(state.mutex);
+    for (ThreadBuffer* buffer : state.buffers)
+    {
+        Drain(state, buffer->data);
+    }
+    state.file.close();
+    m_enabled = false;
+}
+
+void
+BinaryLog::Flush()
+{
+    State& state = GetState();
+    std::lock_guard lock(state.mutex);
+    for (ThreadBuffer* buffer : state.buffers)
+    {
+        Drain(state, buffer->data);
+    }
+    state.file.flush();
+}
+
+uint32_t
+BinaryLog::RegisterSite(const LogComponent& component,
+                        uint32_t level,
+                        const char* function,
+                        SiteKind kind)
+{
+    State& state = GetState();
+    std::lock_guard lock(state.mutex);
+    state.sites.push_back({component.Name(), function, level, kind});
+    return state.sites.size() - 1;
+}
+
+bool
+BinaryLog::Decode(std::istream& is, std::ostream& os)
+{
+    char magic[sizeof(MAGIC)];
+    if (!is.read(magic, sizeof(magic)))
+    {
+        // Nothing was logged
+        return is.gcount() == 0;
+    }
+    if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0)
+    {
+        return false;
+    }
+
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    std::vector<Site> sites;
+    uint32_t size;
+    while (is.read(reinterpret_cast<char*>(&size), sizeof(size)))
+    {
+        std::string entry(size, '\0');
+        if (!is.read(entry.data(), size))
+        {
+            return false;
+        }
+        Reader reader(entry);
+        uint8_t type;
+        if (!reader.Get(type))
+        {
+            return false;
+        }
+        if (type == SITE)
+        {
+            uint32_t id;
+            Site site;
+            if (!reader.Get(id) || id != sites.size() || !reader.Get(site.kind) ||
+                !reader.Get(site.level) || !reader.GetString(site.component) ||
+                !reader.GetString(site.function))
+            {
+                return false;
+            }
+            sites.push_back(site);
+            continue;
+        }
+
+        uint32_t id;
+        uint8_t prefixes;
+        if (type != RECORD || !reader.Get(id) || id >= sites.size() || !reader.Get(prefixes))
+        {
+            return false;
+        }
+        const Site& site = sites[id];
+        bool function = (site.kind == FUNCTION);
+
+        // The prefixes, as printed by NS_LOG_APPEND_TIME_PREFIX and
+        // NS_LOG_APPEND_NODE_PREFIX
+        std::string text;
+        if (prefixes & PREFIX_TIME)
+        {
+            double seconds;
+            uint8_t digits;
+            if (!reader.Get(seconds) || !reader.Get(digits))
+            {
+                return false;
+            }
+            os << std::fixed << std::setprecision(digits) << std::showpos << seconds << "s ";
+            os.flags(flags);
+            os.precision(precision);
+        }
+        if (prefixes & PREFIX_TIME_TEXT)
+        {
+            if (!reader.GetString(text))
+            {
+                return false;
+            }
+            os << text << " ";
+        }
+        if (prefixes & PREFIX_NODE)
+        {
+            uint32_t context;
+            if (!reader.Get(context))
+            {
+                return false;
+            }
+            if (context == Simulator::NO_CONTEXT)
+            {
+                os << "-1 ";
+            }
+            else
+            {
+                os << context << " ";
+            }
+        }
+        if (prefixes & PREFIX_NODE_TEXT)
+        {
+            if (!reader.GetString(text))
+            {
+                return false;
+            }
+            os << text << " ";
+        }
+
+        os.setf(std::ios_base::boolalpha);
+        bool started = false;
+        bool first = true;
+        uint8_t tag;
+        do
+        {
+            if (!reader.Get(tag))
+            {
+                return false;
+            }
+            if (tag == BinaryLogRecord::CONTEXT)
+            {
+                if (!reader.GetString(text))
+                {
+                    return false;
+                }
+                os << text;
+                continue;
+            }
+            if (!started)
+            {
+                started = true;
+                if (function)
+                {
+                    os << site.component << ":" << site.function << "(";
+                }
+                else
+                {
+                    if (prefixes & PREFIX_FUNC)
+                    {
+                        os << site.component << ":" << site.function << "(): ";
+                    }
+                    if (prefixes & PREFIX_LEVEL)
+                    {
+                        os << "["
+                           << LogComponent::GetLevelLabel(static_cast<LogLevel>(site.level))
+                           << "] ";
+                    }
+                }
+            }
+            if (tag == BinaryLogRecord::END || tag == BinaryLogRecord::TEXT)
+            {
+                // The text includes its separators
+            }
+            else if (function && !first)
+            {
+                os << ", ";
+            }
+            first = false;
+
+            bool ok = true;
+            switch (tag)
+            {
+            case BinaryLogRecord::END:
+                break;
+            case BinaryLogRecord::BOOL: {
+                uint8_t value;
+                ok = reader.Get(value);
+                os << static_cast<bool>(value);
+                break;
+            }
+            case BinaryLogRecord::CHAR: {
+                char value;
+                ok = reader.Get(value);
+                os << value;
+                break;
+            }
+            case BinaryLogRecord::INT: {
+                int64_t value;
+                ok = reader.Get(value);
+                os << value;
+                break;
+            }
+            case BinaryLogRecord::UINT: {
+                uint64_t value;
+                ok = reader.Get(value);
+                os << value;
+                break;
+            }
+            case BinaryLogRecord::DOUBLE: {
+                double value;
+                ok = reader.Get(value);
+                os << value;
+                break;
+            }
+            case BinaryLogRecord::STRING:
+                ok = reader.GetString(text);
+                if (function)
+                {
+                    os << "\"" << text << "\"";
+                }
+                else
+                {
+                    os << text;
+                }
+                break;
+            case BinaryLogRecord::POINTER: {
+                uint64_t value;
+                ok = reader.Get(value);
+                os << reinterpret_cast<const void*>(static_cast<uintptr_t>(value));
+                break;
+            }
+            case BinaryLogRecord::TEXT:
+                ok = reader.GetString(text);
+                os << text;
+                break;
+            default:
+                ok = false;
+            }
+            if (!ok)
+            {
+                return false;
+            }
+        } while (tag != BinaryLogRecord::END);
+        os.flags(flags);
+
+        if (function)
+        {
+            os << ")";
+        }
+        os << std::endl;
+    }
+    // A truncated size is an error
+    return is.gcount() == 0;
+}
+
+BinaryLogRecord::BinaryLogRecord(const LogComponent& component,
+                                 uint32_t site,
+                                 BinaryLog::SiteKind kind)
+    : m_buffer(nullptr),
+      m_start(0),
+      m_text(nullptr),
+      m_function(kind == BinaryLog::FUNCTION),
+      m_first(true)
+{
+    ThreadBuffer& buffer = GetThreadBuffer();
+    if (buffer.depth++ > 0)
+    {
+        // Logged while recording another message
+        return;
+    }
+    m_buffer = &buffer.data;
+    m_start = m_buffer->size();
+
+    uint32_t size = 0; // Set by the destructor
+    Put(&size, sizeof(size));
+    Entry entry = RECORD;
+    Put(&entry, sizeof(entry));
+    Put(&site, sizeof(site));
+
+    TimePrinter timePrinter = LogGetTimePrinter();
+    NodePrinter nodePrinter = LogGetNodePrinter();
+    uint8_t prefixes = 0;
+    if (timePrinter != nullptr && component.IsEnabled(LOG_PREFIX_TIME))
+    {
+        prefixes |= (timePrinter == &DefaultTimePrinter) ? PREFIX_TIME : PREFIX_TIME_TEXT;
+    }
+    if (nodePrinter != nullptr && component.IsEnabled(LOG_PREFIX_NODE))
+    {
+        prefixes |= (nodePrinter == &DefaultNodePrinter) ? PREFIX_NODE : PREFIX_NODE_TEXT;
+    }
+    if (!m_function && component.IsEnabled(LOG_PREFIX_FUNC))
+    {
+        prefixes |= PREFIX_FUNC;
+    }
+    if (!m_function && component.IsEnabled(LOG_PREFIX_LEVEL))
+    {
+        prefixes |= PREFIX_LEVEL;
+    }
+    Put(&prefixes, sizeof(prefixes));
+
+    if (prefixes & PREFIX_TIME)
+    {
+        // The precision used by DefaultTimePrinter
+        uint8_t digits;
+        switch (Time::GetResolution())
+        {
+        case Time::US:
+            digits = 6;
+            break;
+        case Time::NS:
+            digits = 9;
+            break;
+        case Time::PS:
+            digits = 12;
+            break;
+        case Time::FS:
+            digits = 15;
+            break;
+        default:
+            digits = 5;
+        }
+        double seconds = Simulator::Now().ToDouble(Time::S);
+        Put(&seconds, sizeof(seconds));
+        Put(&digits, sizeof(digits));
+    }
+    if (prefixes & PREFIX_TIME_TEXT)
+    {
+        std::ostringstream os;
+        (*timePrinter)(os);
+        std::string text = os.str();
+        uint32_t length = text.size();
+        Put(&length, sizeof(length));
+        Put(text.data(), length);
+    }
+    if (prefixes & PREFIX_NODE)
+    {
+        uint32_t context = Simulator::GetContext();
+        Put(&context, sizeof(context));
+    }
+    if (prefixes & PREFIX_NODE_TEXT)
+    {
+        std::ostringstream os;
+        (*nodePrinter)(os);
+        std::string text = os.str();
+        uint32_t length = text.size();
+        Put(&length, sizeof(length));
+        Put(text.data(), length);
+    }
+}
+
+BinaryLogRecord::~BinaryLogRecord()
+{
+    ThreadBuffer& buffer = GetThreadBuffer();
+    buffer.depth--;
+    if (m_buffer == nullptr)
+    {
+        return;
+    }
+    if (m_text != nullptr)
+    {
+        PutString(TEXT, m_text->view());
+    }
+    Tag end = END;
+    Put(&end, sizeof(end));
+    uint32_t size = m_buffer->size() - m_start - sizeof(size);
+    std::memcpy(m_buffer->data() + m_start, &size, sizeof(size));
+
+    if (m_buffer->size() >= FLUSH_SIZE)
+    {
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        Drain(state, *m_buffer);
+    }
+}
+
+BinaryLogRecord&
+BinaryLogRecord::operator<<(std::ios_base& (*manipulator)(std::ios_base&))
+{
+    if (m_buffer != nullptr)
+    {
+        Text() << manipulator;
+    }
+    return *this;
+}
+
+BinaryLogRecord&
+BinaryLogRecord::operator<<(std::ostream& (*manipulator)(std::ostream&))
+{
+    if (m_buffer != nullptr)
+    {
+        Text() << manipulator;
+    }
+    return *this;
+}
+
+void
+BinaryLogRecord::SetContext(std::string_view context)
+{
+    if (m_buffer != nullptr && !context.empty())
+    {
+        PutString(CONTEXT, context);
+    }
+}
+
+std::ostream&
+BinaryLogRecord::Text()
+{
+    if (m_text == nullptr)
+    {
+        // The state of std::clog when NS_LOG formats a message
+        m_text = &GetThreadBuffer().text;
+        m_text->str("");
+        m_text->clear();
+        m_text->flags(std::ios_base::skipws | std::ios_base::dec | std::ios_base::boolalpha);
+        m_text->precision(6);
+        m_text->width(0);
+        m_text->fill(' ');
+    }
+    return *m_text;
+}
+
+BinaryLogContext::BinaryLogContext(BinaryLogRecord& record)
+    : m_record(record)
+{
+    std::stringbuf& context = GetThreadBuffer().context;
+    context.str("");
+    m_clog = std::clog.rdbuf(&context);
+}
+
+BinaryLogContext::~BinaryLogContext()
+{
+    std::clog.rdbuf(m_clog);
+    m_record.SetContext(GetThreadBuffer().context.view());
+}
+
+/**
+ * @ingroup logging
+ * Open the binary output named by the \c NS_LOG_BINARY environment variable.
+ * @returns \c true if the variable is set.
+ */
+static bool
+BinaryLogEnvVarCheck()
+{
+    auto [found, filename] = EnvironmentVariable::Get("NS_LOG_BINARY");
+    if (found && !filename.empty())
+    {
+        BinaryLog::Open(filename);
+    }
+    return found;
+}
+
+/**
+ * @ingroup logging
+ * Whether the \c NS_LOG_BINARY environment variable is set.
+ */
+static bool g_binaryLogEnvVar [[maybe_unused]] = BinaryLogEnvVarCheck();
+
+} // namespace ns3
@@ -0,0 +1,408 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef NS3_LOG_BINARY_H
+#define NS3_LOG_BINARY_H
+
+#include <cstdint>
+#include <ios>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup logging
+ * ns3::BinaryLog and ns3::BinaryLogRecord declarations.
+ */
+
+namespace ns3
+{
+
+class LogComponent;
+
+/**
+ * @ingroup logging
+ * Binary output of the log messages.
+ *
+ * When a binary output is open, the NS_LOG, NS_LOG_FUNCTION and
+ * NS_LOG_FUNCTION_NOARGS macros do not format their messages on
+ * \c std::clog: each log statement is registered once as a \em site
+ * (component, function, level), and each message is recorded as the site
+ * index followed by the raw values of its arguments.  The records are
+ * appended to a per-thread buffer, which is written to the file when full,
+ * by Flush() or by Close().
+ *
+ * Numbers, booleans, strings and pointers (including ns3::Ptr) are stored
+ * raw.  A value of any other type is formatted with its \c operator<<,
+ * and so are the values following it in the same message, so that the
+ * state changes of the stream (\c std::hex, \c std::setw, ...) apply as
+ * they do in text.
+ *
+ * The file is rendered as text offline, with Decode() or the
+ * \c print-binary-log utility, as the messages would have been printed
+ * on \c std::clog.
+ *
+ * A binary output can also be opened with the \c NS_LOG_BINARY environment
+ * variable:
+ * @code
+ *   $ NS_LOG="DhcpServer=info|prefix_all" NS_LOG_BINARY=dhcp.log ./ns3 run ...
+ *   $ ./ns3 run 'print-binary-log --file=dhcp.log'
+ * @endcode
+ *
+ * NS_LOG_UNCOND, NS_ABORT and NS_FATAL messages are always printed on
+ * \c std::clog.
+ */
+class BinaryLog
+{
+  public:
+    /** The log statements of a site. */
+    enum SiteKind : uint8_t
+    {
+        MESSAGE = 0, //!< NS_LOG and its level variants.
+        FUNCTION = 1 //!< NS_LOG_FUNCTION and NS_LOG_FUNCTION_NOARGS.
+    };
+
+    /**
+     * Open the binary output, closing the current one.
+     * @param [in] filename The file to write.
+     */
+    static void Open(const std::string& filename);
+    /**
+     * Write the buffered records and close the binary output.
+     * The log messages are printed on \c std::clog again.
+     */
+    static void Close();
+    /**
+     * Write the records buffered by all the threads.
+     *
+     * The other threads must not log during this call.
+     */
+    static void Flush();
+
+    /**
+     * Check if the log messages are written to a binary output.
+     * @returns \c true if a binary output is open.
+     */
+    static bool IsEnabled()
+    {
+        return m_enabled;
+    }
+
+    /**
+     * Register a log statement.
+     * @param [in] component The log component of the statement.
+     * @param [in] level The LogLevel of the statement.
+     * @param [in] function The function containing the statement.
+     * @param [in] kind The kind of statement.
+     * @returns The index of the site.
+     */
+    static uint32_t RegisterSite(const LogComponent& component,
+                                 uint32_t level,
+                                 const char* function,
+                                 SiteKind kind);
+
+    /**
+     * Render a binary log as text.
+     * @param [in] is The binary log.
+     * @param [in] os The stream on which the messages are printed.
+     * @returns \c false if the binary log is truncated or malformed.
+     */
+    static bool Decode(std::istream& is, std::ostream& os);
+
+  private:
+    static bool m_enabled; //!< Whether a binary output is open.
+};
+
+/**
+ * @ingroup logging
+ * A log message being recorded in the buffer of the current thread.
+ *
+ * The message is completed when the record is destroyed.  A message
+ * logged while recording another one in the same thread, e.g., by the
+ * \c operator<< of an argument, is discarded.
+ */
+class BinaryLogRecord
+{
+  public:
+    /** The type of a value in a record. */
+    enum Tag : uint8_t
+    {
+        END = 0,     //!< End of the record.
+        BOOL = 1,    //!< A bool.
+        CHAR = 2,    //!< A character.
+        INT = 3,     //!< A signed integer, as int64_t.
+        UINT = 4,    //!< An unsigned integer, as uint64_t.
+        DOUBLE = 5,  //!< A floating point number, as double.
+        STRING = 6,  //!< A string.
+        POINTER = 7, //!< A pointer, as uint64_t.
+        TEXT = 8,    //!< The formatted remainder of the message.
+        CONTEXT = 9  //!< The output of NS_LOG_APPEND_CONTEXT.
+    };
+
+    /**
+     * Start a record.
+     * @param [in] component The log component of the site.
+     * @param [in] site The index of the site.
+     * @param [in] kind The kind of site.
+     */
+    BinaryLogRecord(const LogComponent& component, uint32_t site, BinaryLog::SiteKind kind);
+    /** Complete the record. */
+    ~BinaryLogRecord();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    BinaryLogRecord(const BinaryLogRecord&) = delete;
+    BinaryLogRecord& operator=(const BinaryLogRecord&) = delete;
+
+    /**
+     * Record a value.
+     * @param [in] value The value.
+     * @returns This record, so it's chainable.
+     */
+    template <typename T>
+    BinaryLogRecord& operator<<(const T& value);
+    /**
+     * Record the elements of a vector, as ParameterLogger does for the
+     * function parameters.
+     * @param [in] vector The elements.
+     * @returns This record, so it's chainable.
+     */
+    template <typename T>
+    BinaryLogRecord& operator<<(const std::vector<T>& vector);
+    /**
+     * Apply a manipulator, such as \c std::hex, to the rest of the message.
+     * @param [in] manipulator The manipulator.
+     * @returns This record, so it's chainable.
+     */
+    BinaryLogRecord& operator<<(std::ios_base& (*manipulator)(std::ios_base&));
+    /**
+     * Apply a manipulator, such as \c std::flush, to the rest of the message.
+     * @param [in] manipulator The manipulator.
+     * @returns This record, so it's chainable.
+     */
+    BinaryLogRecord& operator<<(std::ostream& (*manipulator)(std::ostream&));
+
+    /**
+     * Record the output of NS_LOG_APPEND_CONTEXT.
+     * @param [in] context The context.
+     */
+    void SetContext(std::string_view context);
+
+  private:
+    /**
+     * Append raw bytes to the record.
+     * @param [in] data The bytes.
+     * @param [in] size The number of bytes.
+     */
+    void Put(const void* data, std::size_t size)
+    {
+        auto bytes = static_cast<const uint8_t*>(data);
+        m_buffer->insert(m_buffer->end(), bytes, bytes + size);
+    }
+
+    /**
+     * Append a tagged value to the record.
+     * @param [in] tag The type of the value.
+     * @param [in] value The value.
+     */
+    template <typename T>
+    void PutValue(Tag tag, T value)
+    {
+        Put(&tag, sizeof(tag));
+        Put(&value, sizeof(value));
+    }
+
+    /**
+     * Append a tagged string to the record.
+     * @param [in] tag The type of the string.
+     * @param [in] value The string.
+     */
+    void PutString(Tag tag, std::string_view value)
+    {
+        PutValue(tag, static_cast<uint32_t>(value.size()));
+        Put(value.data(), value.size());
+    }
+
+    /**
+     * Get the stream formatting the rest of the message.
+     * @returns The stream.
+     */
+    std::ostream& Text();
+
+    std::vector<uint8_t>* m_buffer; //!< The buffer of the thread, or null if discarded.
+    std::size_t m_start;            //!< The offset of the record in the buffer.
+    std::ostringstream* m_text;     //!< The formatted rest of the message, if any.
+    bool m_function;                //!< Whether the values are function parameters.
+    bool m_first;                   //!< Whether no parameter was recorded yet.
+};
+
+/**
+ * @ingroup logging
+ * Capture what NS_LOG_APPEND_CONTEXT prints on \c std::clog in a
+ * BinaryLogRecord.
+ */
+class BinaryLogContext
+{
+  public:
+    /**
+     * Redirect \c std::clog.
+     * @param [in] record The record of the message.
+     */
+    BinaryLogContext(BinaryLogRecord& record);
+    /** Restore \c std::clog and record the context. */
+    ~BinaryLogContext();
+
+    // Delete copy constructor and assignment operator to avoid misuse
+    BinaryLogContext(const BinaryLogContext&) = delete;
+    BinaryLogContext& operator=(const BinaryLogContext&) = delete;
+
+  private:
+    BinaryLogRecord& m_record; //!< The record of the message.
+    std::streambuf* m_clog;    //!< The buffer of \c std::clog.
+};
+
+template <typename T>
+BinaryLogRecord&
+BinaryLogRecord::operator<<(const T& value)
+{
+    if (m_buffer == nullptr)
+    {
+        return *this;
+    }
+    if (m_text == nullptr)
+    {
+        // Same output as ParameterLogger for the function parameters: the
+        // arithmetic values are promoted, e.g., bool and uint8_t print as int.
+        if constexpr (std::is_same_v<T, bool>)
+        {
+            if (m_function)
+            {
+                PutValue(INT, static_cast<int64_t>(value));
+            }
+            else
+            {
+                PutValue(BOOL, static_cast<uint8_t>(value));
+            }
+            m_first = false;
+            return *this;
+        }
+        else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> ||
+                           std::is_same_v<T, unsigned char>)
+        {
+            if (m_function)
+            {
+                PutValue(INT, static_cast<int64_t>(+value));
+            }
+            else
+            {
+                PutValue(CHAR, static_cast<char>(value));
+            }
+            m_first = false;
+            return *this;
+        }
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+        {
+            PutValue(INT, static_cast<int64_t>(value));
+            m_first = false;
+            return *this;
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            PutValue(UINT, static_cast<uint64_t>(value));
+            m_first = false;
+            return *this;
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            PutValue(DOUBLE, static_cast<double>(value));
+            m_first = false;
+            return *this;
+        }
+        else if constexpr (std::is_convertible_v<const T&, std::string>)
+        {
+            PutString(STRING, value);
+            m_first = false;
+            return *this;
+        }
+        else if constexpr (std::is_pointer_v<T> &&
+                           (std::is_object_v<std::remove_pointer_t<T>> ||
+                            std::is_void_v<std::remove_pointer_t<T>>))
+        {
+            PutValue(POINTER, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+            m_first = false;
+            return *this;
+        }
+        else if constexpr (requires { PeekPointer(value); })
+        {
+            // ns3::Ptr prints its pointer
+            PutValue(POINTER,
+                     static_cast<uint64_t>(reinterpret_cast<uintptr_t>(PeekPointer(value))));
+            m_first = false;
+            return *this;
+        }
+    }
+
+    // The value is only const here: some operator<< take a non-const
+    // reference, which the text output on std::clog accepts.
+    auto& text = const_cast<T&>(value);
+    std::ostream& os = Text();
+    if (m_function)
+    {
+        if (!m_first)
+        {
+            os << ", ";
+        }
+        if constexpr (std::is_convertible_v<T, std::string>)
+        {
+            os << "\"" << text << "\"";
+        }
+        else if constexpr (std::is_arithmetic_v<T>)
+        {
+            os << +value;
+        }
+        else
+        {
+            os << text;
+        }
+    }
+    else
+    {
+        os << text;
+    }
+    m_first = false;
+    return *this;
+}
+
+template <typename T>
+BinaryLogRecord&
+BinaryLogRecord::operator<<(const std::vector<T>& vector)
+{
+    if (m_buffer == nullptr)
+    {
+        return *this;
+    }
+    // The kind of site is only known at run time: a vector without
+    // operator<< can only be a function parameter.
+    if constexpr (requires(std::ostream& os) { os << vector; })
+    {
+        if (!m_function)
+        {
+            Text() << vector;
+            return *this;
+        }
+    }
+    for (const auto& i : vector)
+    {
+        *this << i;
+    }
+    return *this;
+}
+
+} // namespace ns3
+
+#endif /* NS3_LOG_BINARY_H */
@@ -148,6 +148,27 @@
 #define NS_LOG_CONDITION
 #endif
 
+/**
+ * @ingroup logging
+ * Start recording a message in the binary log.
+ *
+ * The statement is registered once as a site of the binary log.  The
+ * values of the message are then streamed to \c binaryLogRecord.
+ *
+ * @param [in] kind The BinaryLog::SiteKind of the statement.
+ * @param [in] level The log level.
+ * @internal
+ * Logging implementation macro; should not be called directly.
+ */
+#define NS_LOG_BINARY_RECORD(kind, level)                                                          \
+    static const uint32_t binaryLogSite =                                                          \
+        ns3::BinaryLog::RegisterSite(g_log, level, __FUNCTION__, kind);                            \
+    ns3::BinaryLogRecord binaryLogRecord(g_log, binaryLogSite, kind);                              \
+    {                                                                                              \
+        ns3::BinaryLogContext binaryLogContext(binaryLogRecord);                                   \
+        NS_LOG_APPEND_CONTEXT;                                                                     \
+    }
+
 /**
  * @ingroup logging
  *
@@ -173,14 +194,22 @@
     {                                                                                              \
         if (g_log.IsEnabled(level))                                                                \
         {                                                                                          \
-            NS_LOG_APPEND_TIME_PREFIX;                                                             \
-            NS_LOG_APPEND_NODE_PREFIX;                                                             \
-            NS_LOG_APPEND_CONTEXT;                                                                 \
-            NS_LOG_APPEND_FUNC_PREFIX;                                                             \
-            NS_LOG_APPEND_LEVEL_PREFIX(level);                                                     \
-            auto flags = std::clog.setf(std::ios_base::boolalpha);                                 \
-            std::clog << msg << std::endl;                                                         \
-            std::clog.flags(flags);                                                                \
+            if (ns3::BinaryLog::IsEnabled())                                                       \
+            {                                                                                      \
+                NS_LOG_BINARY_RECORD(ns3::BinaryLog::MESSAGE, level);                              \
+                binaryLogRecord << msg;                                                            \
+            }                                                                                      \
+            else                                                                                   \
+            {                                                                                      \
+                NS_LOG_APPEND_TIME_PREFIX;                                                         \
+                NS_LOG_APPEND_NODE_PREFIX;                                                         \
+                NS_LOG_APPEND_CONTEXT;                                                             \
+                NS_LOG_APPEND_FUNC_PREFIX;                                                         \
+                NS_LOG_APPEND_LEVEL_PREFIX(level);                                                 \
+                auto flags = std::clog.setf(std::ios_base::boolalpha);                             \
+                std::clog << msg << std::endl;                                                     \
+                std::clog.flags(flags);                                                            \
+            }                                                                                      \
         }                                                                                          \
     } while (false)
 
@@ -198,10 +227,17 @@
     {                                                                                              \
         if (g_log.IsEnabled(ns3::LOG_FUNCTION))                                                    \
         {                                                                                          \
-            NS_LOG_APPEND_TIME_PREFIX;                                                             \
-            NS_LOG_APPEND_NODE_PREFIX;                                                             \
-            NS_LOG_APPEND_CONTEXT;                                                                 \
-            std::clog << g_log.Name() << ":" << __FUNCTION__ << "()" << std::endl;                 \
+            if (ns3::BinaryLog::IsEnabled())                                                       \
+            {                                                                                      \
+                NS_LOG_BINARY_RECORD(ns3::BinaryLog::FUNCTION, ns3::LOG_FUNCTION);                 \
+            }                                                                                      \
+            else                                                                                   \
+            {                                                                                      \
+                NS_LOG_APPEND_TIME_PREFIX;                                                         \
+                NS_LOG_APPEND_NODE_PREFIX;                                                         \
+                NS_LOG_APPEND_CONTEXT;                                                             \
+                std::clog << g_log.Name() << ":" << __FUNCTION__ << "()" << std::endl;             \
+            }                                                                                      \
         }                                                                                          \
     } while (false)
 
@@ -232,14 +268,22 @@
     {                                                                                              \
         if (g_log.IsEnabled(ns3::LOG_FUNCTION))                                                    \
         {                                                                                          \
-            NS_LOG_APPEND_TIME_PREFIX;                                                             \
-            NS_LOG_APPEND_NODE_PREFIX;                                                             \
-            NS_LOG_APPEND_CONTEXT;                                                                 \
-            std::clog << g_log.Name() << ":" << __FUNCTION__ << "(";                               \
-            auto flags = std::clog.setf(std::ios_base::boolalpha);                                 \
-            ns3::ParameterLogger(std::clog) << parameters;                                         \
-            std::clog.flags(flags);                                                                \
-            std::clog << ")" << std::endl;                                                         \
+            if (ns3::BinaryLog::IsEnabled())                                                       \
+            {                                                                                      \
+                NS_LOG_BINARY_RECORD(ns3::BinaryLog::FUNCTION, ns3::LOG_FUNCTION);                 \
+                binaryLogRecord << parameters;                                                     \
+            }                                                                                      \
+            else                                                                                   \
+            {                                                                                      \
+                NS_LOG_APPEND_TIME_PREFIX;                                                         \
+                NS_LOG_APPEND_NODE_PREFIX;                                                         \
+                NS_LOG_APPEND_CONTEXT;                                                             \
+                std::clog << g_log.Name() << ":" << __FUNCTION__ << "(";                           \
+                auto flags = std::clog.setf(std::ios_base::boolalpha);                             \
+                ns3::ParameterLogger(std::clog) << parameters;                                     \
+                std::clog.flags(flags);                                                            \
+                std::clog << ")" << std::endl;                                                     \
+            }                                                                                      \
         }                                                                                          \
     } while (false)
 
@@ -87,47 +87,6 @@ EventImpl* MakeEvent(T function);
 namespace ns3
 {
 
-namespace internal
-{
-
-/**
- * @ingroup events
- * Helper for the MakeEvent functions which take a class method.
- *
- * This helper converts a pointer to a reference.
- *
- * This is the generic template declaration (with empty body).
- *
- * @tparam T \explicit The class type.
- */
-template <typename T>
-struct EventMemberImplObjTraits;
-
-/**
- * @ingroup events
- * Helper for the MakeEvent functions which take a class method.
- *
- * This helper converts a pointer to a reference.
- *
- * This is the specialization for pointer types.
- *
- * @tparam T \explicit The class type.
- */
-template <typename T>
-struct EventMemberImplObjTraits<T*>
-{
-    /**
-     * @param [in] p Object pointer.
-     * @return A reference to the object pointed to by p.
-     */
-    static T& GetReference(T* p)
-    {
-        return *p;
-    }
-};
-
-} // namespace internal
-
 template <typename MEM, typename OBJ, typename... Ts>
 std::enable_if_t<std::is_member_pointer_v<MEM>, EventImpl*>
 MakeEvent(MEM mem_ptr, OBJ obj, Ts... args)
@@ -138,7 +97,9 @@ MakeEvent(MEM mem_ptr, OBJ obj, Ts... args)
         EventMemberImpl() = delete;
 
         EventMemberImpl(OBJ obj, MEM function, Ts... args)
-            : m_function(std::bind(function, obj, args...))
+            : m_obj(obj),
+              m_function(function),
+              m_arguments(args...)
         {
         }
 
@@ -150,10 +111,15 @@ MakeEvent(MEM mem_ptr, OBJ obj, Ts... args)
       private:
         void Notify() override
         {
-            m_function();
+            std::apply([this](auto&... args) { std::invoke(m_function, m_obj, args...); },
+                       m_arguments);
         }
 
-        std::function<void()> m_function;
+        // The bound object and arguments are stored inline, so that the event
+        // is a single allocation (see EventImpl::operator new).
+        OBJ m_obj;                                              //!< the object
+        MEM m_function;                                         //!< the member function
+        std::tuple<std::remove_reference_t<Ts>...> m_arguments; //!< the bound arguments
     }* ev = new EventMemberImpl(obj, mem_ptr, args...);
 
     return ev;
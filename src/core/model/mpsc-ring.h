@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef MPSC_RING_H
+#define MPSC_RING_H
+
+#include "assert.h"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdint.h>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::MpscRing declaration and template implementation.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup simulator
+ * @brief A bounded, lock-free, multiple producers single consumer FIFO.
+ *
+ * This is the bounded queue of Dmitry Vyukov, restricted to a single
+ * consumer.  Each slot holds a sequence number which tells the producers
+ * and the consumer whether the slot is free, or holds an item.  A producer
+ * claims a slot by incrementing the tail with a compare-and-swap, copies
+ * its item and publishes it by updating the sequence number of the slot.
+ *
+ * The items are popped in the order the slots were claimed, so the items
+ * of a given producer are popped in the order they were pushed.  Pop()
+ * stops at a slot claimed by a producer which has not yet published its
+ * item, even if later slots are published; IsDrained() tells whether the
+ * ring is empty, or only waiting for such a slot.
+ *
+ * @tparam T \explicit The item type, which should be cheap to copy.
+ */
+template <typename T>
+class MpscRing
+{
+  public:
+    /**
+     * Constructor.
+     * @param [in] capacity The number of slots, rounded up to a power of two.
+     */
+    explicit MpscRing(std::size_t capacity);
+
+    /** Copying is not allowed. */
+    MpscRing(const MpscRing&) = delete;
+    /**
+     * Copying is not allowed.
+     * @returns This ring.
+     */
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    /**
+     * Append an item; may be called concurrently from any thread.
+     * @param [in] item The item.
+     * @returns \c false if the ring is full.
+     */
+    bool Push(const T& item);
+
+    /**
+     * Remove the first item; must only be called by the consumer thread.
+     * @param [out] item The item.
+     * @returns \c false if no item is available.
+     */
+    bool Pop(T& item);
+
+    /**
+     * Check if the ring is empty, without any slot claimed by a producer
+     * but not yet published; must only be called by the consumer thread.
+     * @returns \c true if all the items pushed so far have been popped.
+     */
+    bool IsDrained() const;
+
+  private:
+    /** A slot of the ring. */
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence; //!< Publication state of the slot
+        T item;                            //!< The item
+    };
+
+    /**
+     * Round up to a power of two.
+     * @param [in] n The value.
+     * @returns The smallest power of two not lower than \pname{n}.
+     */
+    static std::size_t RoundUp(std::size_t n);
+
+    std::size_t m_mask;              //!< Capacity - 1
+    std::unique_ptr<Slot[]> m_slots; //!< The slots
+    /** Next slot to claim, shared by the producers. */
+    alignas(64) std::atomic<std::size_t> m_tail;
+    /** Next slot to pop, private to the consumer. */
+    alignas(64) std::size_t m_head;
+};
+
+} // namespace ns3
+
+/********************************************************************
+ *  Implementation of the templates declared above.
+ ********************************************************************/
+
+namespace ns3
+{
+
+template <typename T>
+std::size_t
+MpscRing<T>::RoundUp(std::size_t n)
+{
+    std::size_t size = 2;
+    while (size < n)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
+template <typename T>
+MpscRing<T>::MpscRing(std::size_t capacity)
+    : m_mask(RoundUp(capacity) - 1),
+      m_slots(new Slot[m_mask + 1]),
+      m_tail(0),
+      m_head(0)
+{
+    for (std::size_t i = 0; i <= m_mask; i++)
+    {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template <typename T>
+bool
+MpscRing<T>::Push(const T& item)
+{
+    std::size_t pos = m_tail.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true)
+    {
+        slot = &m_slots[pos & m_mask];
+        std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0)
+        {
+            if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // the slot still holds the item of the previous lap
+            return false;
+        }
+        else
+        {
+            pos = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+    slot->item = item;
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+bool
+MpscRing<T>::Pop(T& item)
+{
+    Slot* slot = &m_slots[m_head & m_mask];
+    if (slot->sequence.load(std::memory_order_acquire) != m_head + 1)
+    {
+        return false;
+    }
+    item = slot->item;
+    slot->sequence.store(m_head + m_mask + 1, std::memory_order_release);
+    m_head++;
+    return true;
+}
+
+template <typename T>
+bool
+MpscRing<T>::IsDrained() const
+{
+    return m_tail.load(std::memory_order_acquire) == m_head;
+}
+
+} // namespace ns3
+
+#endif /* MPSC_RING_H */
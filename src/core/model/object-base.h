@@ -31,11 +31,15 @@
  *
  * If the class is in a namespace, then the macro call should also be
  * in the namespace.
+ *
+ * Loading the module only records the name of the class: its GetTypeId
+ * method is called when the TypeId is first looked up, see
+ * TypeId::LazyRegistration.
  */
 #define NS_OBJECT_ENSURE_REGISTERED(type)                                                          \
     static struct Object##type##RegistrationClass                                                  \
     {                                                                                              \
-        Object##type##RegistrationClass()                                                          \
+        static void Register()                                                                     \
         {                                                                                          \
             NS_WARNING_PUSH_DEPRECATED;                                                            \
             ns3::TypeId tid = type::GetTypeId();                                                   \
@@ -43,6 +47,8 @@
             tid.GetParent();                                                                       \
             NS_WARNING_POP;                                                                        \
         }                                                                                          \
+                                                                                                   \
+        ns3::TypeId::LazyRegistration registration{#type, &Register};                              \
     } Object##type##RegistrationVariable
 
 /**
@@ -74,12 +80,14 @@
     }                                                                                              \
     static struct Object##type##param##RegistrationClass                                           \
     {                                                                                              \
-        Object##type##param##RegistrationClass()                                                   \
+        static void Register()                                                                     \
         {                                                                                          \
             ns3::TypeId tid = type<param>::GetTypeId();                                            \
             tid.SetSize(sizeof(type<param>));                                                      \
             tid.GetParent();                                                                       \
         }                                                                                          \
+                                                                                                   \
+        ns3::TypeId::LazyRegistration registration{#type "<" #param ">", &Register};               \
     } Object##type##param##RegistrationVariable
 
 /**
@@ -112,12 +120,14 @@
     }                                                                                              \
     static struct Object##type##param1##param2##RegistrationClass                                  \
     {                                                                                              \
-        Object##type##param1##param2##RegistrationClass()                                          \
+        static void Register()                                                                     \
         {                                                                                          \
             ns3::TypeId tid = type<param1, param2>::GetTypeId();                                   \
             tid.SetSize(sizeof(type<param1, param2>));                                             \
             tid.GetParent();                                                                       \
         }                                                                                          \
+                                                                                                   \
+        ns3::TypeId::LazyRegistration registration{#type "<" #param1 "," #param2 ">", &Register};  \
     } Object##type##param1##param2##RegistrationVariable
 
 namespace ns3
@@ -104,6 +104,22 @@ MakeObjectMapAccessor(U T::* memberVector)
             return nullptr;
         }
 
+        Ptr<Object> DoFind(const ObjectBase* object, std::size_t index) const override
+        {
+            const T* obj = dynamic_cast<const T*>(object);
+            if (obj == nullptr)
+            {
+                return nullptr;
+            }
+            using Key = typename U::key_type;
+            auto it = (obj->*m_memberVector).find(static_cast<Key>(index));
+            if (it == (obj->*m_memberVector).end() || static_cast<std::size_t>(it->first) != index)
+            {
+                return nullptr;
+            }
+            return it->second;
+        }
+
         // clang-format off
         // Clang-format guard needed for versions <= 18
         U T::* m_memberVector;
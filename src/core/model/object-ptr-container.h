@@ -245,6 +245,16 @@ class ObjectPtrContainerAccessor : public AttributeAccessor
     bool HasGetter() const override;
     bool HasSetter() const override;
 
+    /**
+     * Get an instance from the container, identified by its index,
+     * without getting the whole container.
+     *
+     * @param [in] object The container object.
+     * @param [in] index The index of the instance.
+     * @returns The instance, or null if there is none at \pname{index}.
+     */
+    Ptr<Object> Find(const ObjectBase* object, std::size_t index) const;
+
   private:
     /**
      * Get the number of instances in the container.
@@ -265,6 +275,17 @@ class ObjectPtrContainerAccessor : public AttributeAccessor
     virtual Ptr<Object> DoGet(const ObjectBase* object,
                               std::size_t i,
                               std::size_t* index) const = 0;
+    /**
+     * Get an instance from the container, identified by its index.
+     *
+     * The default implementation looks for the index among all the
+     * instances of the container.
+     *
+     * @param [in] object The container object.
+     * @param [in] index The index of the instance.
+     * @returns The instance, or null if there is none at \pname{index}.
+     */
+    virtual Ptr<Object> DoFind(const ObjectBase* object, std::size_t index) const;
 };
 
 template <typename T, typename U, typename INDEX>
@@ -293,6 +314,17 @@ MakeObjectPtrContainerAccessor(Ptr<U> (T::*get)(INDEX) const, INDEX (T::*getN)()
             return (obj->*m_get)(i);
         }
 
+        Ptr<Object> DoFind(const ObjectBase* object, std::size_t index) const override
+        {
+            std::size_t n;
+            if (!DoGetN(object, &n) || index >= n)
+            {
+                return nullptr;
+            }
+            const T* obj = static_cast<const T*>(object);
+            return (obj->*m_get)(index);
+        }
+
         Ptr<U> (T::*m_get)(INDEX) const;
         INDEX (T::*m_getN)() const;
     }* spec = new MemberGetters();
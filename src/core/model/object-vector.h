@@ -13,6 +13,8 @@
 #include "object.h"
 #include "ptr.h"
 
+#include <iterator>
+
 /**
  * @file
  * @ingroup attribute_ObjectVector
@@ -88,20 +90,19 @@ MakeObjectVectorAccessor(U T::* memberVector)
                           std::size_t* index) const override
         {
             const T* obj = static_cast<const T*>(object);
-            auto begin = (obj->*m_memberVector).begin();
-            auto end = (obj->*m_memberVector).end();
-            std::size_t k = 0;
-            for (auto j = begin; j != end; j++, k++)
+            NS_ASSERT(i < (obj->*m_memberVector).size());
+            *index = i;
+            return *std::next((obj->*m_memberVector).begin(), i);
+        }
+
+        Ptr<Object> DoFind(const ObjectBase* object, std::size_t index) const override
+        {
+            const T* obj = dynamic_cast<const T*>(object);
+            if (obj == nullptr || index >= (obj->*m_memberVector).size())
             {
-                if (k == i)
-                {
-                    *index = k;
-                    return *j;
-                }
+                return nullptr;
             }
-            NS_ASSERT(false);
-            // quiet compiler.
-            return nullptr;
+            return *std::next((obj->*m_memberVector).begin(), index);
         }
 
         // clang-format off
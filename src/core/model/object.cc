@@ -17,6 +17,7 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <iterator>
 #include <sstream>
 #include <vector>
 
@@ -97,11 +98,10 @@ Object::Object()
     : m_tid(Object::GetTypeId()),
       m_disposed(false),
       m_initialized(false),
-      m_aggregates((Aggregates*)std::malloc(sizeof(Aggregates))),
+      m_aggregates(AllocateAggregates(1)),
       m_getObjectCount(0)
 {
     NS_LOG_FUNCTION(this);
-    m_aggregates->n = 1;
     m_aggregates->buffer[0] = this;
 }
 
@@ -121,6 +121,8 @@ Object::~Object()
             m_aggregates->n--;
         }
     }
+    // the cache may point to this object
+    std::memset(m_aggregates->cache, 0, sizeof(m_aggregates->cache));
     // finally, if all objects have been removed from the list,
     // delete the aggregate list
     if (m_aggregates->n == 0)
@@ -135,13 +137,21 @@ Object::Object(const Object& o)
     : m_tid(o.m_tid),
       m_disposed(false),
       m_initialized(false),
-      m_aggregates((Aggregates*)std::malloc(sizeof(Aggregates))),
+      m_aggregates(AllocateAggregates(1)),
       m_getObjectCount(0)
 {
-    m_aggregates->n = 1;
     m_aggregates->buffer[0] = this;
 }
 
+Object::Aggregates*
+Object::AllocateAggregates(uint32_t n)
+{
+    auto aggregates = (Aggregates*)std::malloc(sizeof(Aggregates) + (n - 1) * sizeof(Object*));
+    aggregates->n = n;
+    std::memset(aggregates->cache, 0, sizeof(aggregates->cache));
+    return aggregates;
+}
+
 void
 Object::Construct(const AttributeConstructionList& attributes)
 {
@@ -155,7 +165,16 @@ Object::DoGetObject(TypeId tid) const
     NS_LOG_FUNCTION(this << tid);
     NS_ASSERT(CheckLoose());
 
-    // First check if the object is in the normal aggregates.
+    // First check the cached lookups.  A cached Object stays in the
+    // aggregates until it is deleted, which clears the cache, so a hit
+    // neither searches nor reorders the aggregates.
+    auto& slot = m_aggregates->cache[tid.GetUid() % std::size(m_aggregates->cache)];
+    if (slot.tid == tid.GetUid())
+    {
+        return slot.object;
+    }
+
+    // Then check if the object is in the normal aggregates.
     uint32_t n = m_aggregates->n;
     TypeId objectTid = Object::GetTypeId();
     for (uint32_t i = 0; i < n; i++)
@@ -178,6 +197,10 @@ Object::DoGetObject(TypeId tid) const
             current->m_getObjectCount++;
             // then, update the sort
             UpdateSortedArray(m_aggregates, i);
+            // then, cache the result; unidirectional aggregates are not
+            // cached, because the cache is shared by the aggregates.
+            slot.tid = tid.GetUid();
+            slot.object = current;
             // finally, return the match
             return const_cast<Object*>(current);
         }
@@ -306,8 +329,7 @@ Object::AggregateObject(Ptr<Object> o)
     Object* other = PeekPointer(o);
     // first create the new aggregate buffer.
     uint32_t total = m_aggregates->n + other->m_aggregates->n;
-    auto aggregates = (Aggregates*)std::malloc(sizeof(Aggregates) + (total - 1) * sizeof(Object*));
-    aggregates->n = total;
+    Aggregates* aggregates = AllocateAggregates(total);
 
     // copy our buffer to the new buffer
     std::memcpy(&aggregates->buffer[0],
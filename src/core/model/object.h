@@ -371,15 +371,38 @@ class Object : public SimpleRefCount<Object, ObjectBase, ObjectDeleter>
      * chunk of memory than the struct to allow space for a larger
      * variable sized buffer whose size is indicated by the element
      * \c n
+     *
+     * The structure also caches the results of DoGetObject() in a few
+     * slots, indexed by the TypeId uid: a new structure is allocated,
+     * with an empty cache, whenever Objects are aggregated, and the cache
+     * is cleared whenever an Object leaves the aggregates.  When several
+     * aggregates match a TypeId, the cached result is the match found by
+     * the first lookup, so later lookups of that TypeId return it even if
+     * the access counts reorder \c buffer.
      */
     struct Aggregates
     {
         /** The number of entries in \c buffer. */
         uint32_t n;
+        /** The cached DoGetObject() results. */
+        struct
+        {
+            uint16_t tid;   //!< The TypeId uid of the lookup, or 0 if the slot is empty
+            Object* object; //!< The Object found
+        } cache[4];
+
         /** The array of Objects. */
         Object* buffer[1];
     };
 
+    /**
+     * Allocate a list of aggregates, with an empty cache.
+     *
+     * @param [in] n The number of aggregates.
+     * @return The list, to be released with std::free().
+     */
+    static Aggregates* AllocateAggregates(uint32_t n);
+
     /**
      * Find an Object of TypeId tid in the aggregates of this Object.
      *
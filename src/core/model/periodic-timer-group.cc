@@ -0,0 +1,211 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "periodic-timer-group.h"
+
+#include "assert.h"
+#include "log.h"
+#include "simulator.h"
+
+#include <algorithm>
+#include <map>
+#include <memory>
+
+/**
+ * @file
+ * @ingroup timer
+ * ns3::PeriodicTimerGroup implementation.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("PeriodicTimerGroup");
+
+namespace
+{
+
+/** Shared groups, by period and number of buckets. */
+using SharedGroups = std::map<std::pair<int64_t, uint32_t>, std::unique_ptr<PeriodicTimerGroup>>;
+
+/**
+ * Get the shared groups.
+ * @returns The shared groups.
+ */
+SharedGroups&
+GetSharedGroups()
+{
+    static SharedGroups groups;
+    return groups;
+}
+
+} // namespace
+
+PeriodicTimerGroup::PeriodicTimerGroup(const Time& period, uint32_t buckets)
+    : m_period(period),
+      m_buckets(buckets),
+      m_nextId(1),
+      m_expiring(-1)
+{
+    NS_LOG_FUNCTION(this << period << buckets);
+    NS_ASSERT_MSG(buckets > 0, "A group needs at least one bucket");
+    NS_ASSERT_MSG(period.GetTimeStep() >= buckets, "Period too short for " << buckets << " buckets");
+}
+
+PeriodicTimerGroup::~PeriodicTimerGroup()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& bucket : m_buckets)
+    {
+        bucket.event.Cancel();
+    }
+}
+
+PeriodicTimerGroup&
+PeriodicTimerGroup::GetShared(const Time& period, uint32_t buckets)
+{
+    SharedGroups& groups = GetSharedGroups();
+    auto& group = groups[{period.GetTimeStep(), buckets}];
+    if (!group)
+    {
+        if (groups.size() == 1)
+        {
+            Simulator::ScheduleDestroy(&PeriodicTimerGroup::DeleteShared);
+        }
+        group = std::make_unique<PeriodicTimerGroup>(period, buckets);
+    }
+    return *group;
+}
+
+void
+PeriodicTimerGroup::DeleteShared()
+{
+    NS_LOG_FUNCTION_NOARGS();
+    GetSharedGroups().clear();
+}
+
+PeriodicTimerGroup::TimerId
+PeriodicTimerGroup::Add(Callback<void> callback)
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT_MSG(!callback.IsNull(), "Null timer callback");
+
+    // The bucket whose expiration is the latest not after one period from now.
+    int64_t period = m_period.GetTimeStep();
+    int64_t step = period / m_buckets.size();
+    int64_t now = Simulator::Now().GetTimeStep();
+    int64_t phase = now % period;
+    auto index = static_cast<uint32_t>(std::min<int64_t>(phase / step, m_buckets.size() - 1));
+
+    Bucket& bucket = m_buckets[index];
+    TimerId id = m_nextId++;
+    m_timers[id] = {index, bucket.timers.size()};
+    bucket.timers.push_back({id, callback});
+
+    if (!bucket.event.IsPending() && m_expiring != index)
+    {
+        Time delay = TimeStep(index * step - phase + period);
+        bucket.event = Simulator::Schedule(delay, &PeriodicTimerGroup::Expire, this, index);
+    }
+    return id;
+}
+
+void
+PeriodicTimerGroup::Remove(TimerId timer)
+{
+    NS_LOG_FUNCTION(this << timer);
+    auto it = m_timers.find(timer);
+    if (it == m_timers.end())
+    {
+        return;
+    }
+    auto [index, position] = it->second;
+    m_timers.erase(it);
+
+    // Leave a tombstone, erased when the bucket expires or when half of its
+    // timers are removed, so that removing n timers is O(n).
+    Bucket& bucket = m_buckets[index];
+    NS_ASSERT(bucket.timers[position].id == timer);
+    bucket.timers[position].callback.Nullify();
+    bucket.removed++;
+    if (m_expiring == index)
+    {
+        return;
+    }
+    if (bucket.removed == bucket.timers.size())
+    {
+        bucket.timers.clear();
+        bucket.removed = 0;
+        bucket.event.Cancel();
+    }
+    else if (2 * bucket.removed > bucket.timers.size())
+    {
+        Compact(index);
+    }
+}
+
+void
+PeriodicTimerGroup::Compact(uint32_t index)
+{
+    Bucket& bucket = m_buckets[index];
+    if (bucket.removed == 0)
+    {
+        return;
+    }
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < bucket.timers.size(); i++)
+    {
+        if (bucket.timers[i].callback.IsNull())
+        {
+            continue;
+        }
+        if (kept != i)
+        {
+            bucket.timers[kept] = std::move(bucket.timers[i]);
+            m_timers[bucket.timers[kept].id].position = kept;
+        }
+        kept++;
+    }
+    bucket.timers.erase(bucket.timers.begin() + kept, bucket.timers.end());
+    bucket.removed = 0;
+}
+
+void
+PeriodicTimerGroup::Expire(uint32_t index)
+{
+    NS_LOG_FUNCTION(this << index);
+    Bucket& bucket = m_buckets[index];
+    m_expiring = index;
+    // The timers added by the callbacks expire in the next period.
+    std::size_t n = bucket.timers.size();
+    for (std::size_t i = 0; i < n; i++)
+    {
+        // Copy the callback, which may remove itself.
+        Callback<void> callback = bucket.timers[i].callback;
+        if (!callback.IsNull())
+        {
+            callback();
+        }
+    }
+    m_expiring = -1;
+    Compact(index);
+    if (!bucket.timers.empty())
+    {
+        bucket.event = Simulator::Schedule(m_period, &PeriodicTimerGroup::Expire, this, index);
+    }
+}
+
+Time
+PeriodicTimerGroup::GetPeriod() const
+{
+    return m_period;
+}
+
+std::size_t
+PeriodicTimerGroup::GetN() const
+{
+    return m_timers.size();
+}
+
+} // namespace ns3
@@ -0,0 +1,156 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef PERIODIC_TIMER_GROUP_H
+#define PERIODIC_TIMER_GROUP_H
+
+#include "callback.h"
+#include "event-id.h"
+#include "nstime.h"
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup timer
+ * ns3::PeriodicTimerGroup declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup timer
+ * @brief A group of periodic timers sharing the same period, expired by a
+ * single event per period.
+ *
+ * Many models run a periodic housekeeping timer, e.g., a one second lease
+ * timer, which costs one event per object and per period.  The timers
+ * added to a PeriodicTimerGroup are instead expired together: the group
+ * schedules one event per period, which invokes all the callbacks in a loop.
+ *
+ * The period can be split in \c buckets, each expired by its own event at
+ * a fixed offset in the period (the offset of bucket \c i is
+ * <tt>i * period / buckets</tt>).  A timer goes in the bucket whose
+ * expiration is the closest before one period after Add(), so its first
+ * expiration is at most <tt>period / buckets</tt> earlier than it would
+ * have been with its own event.  With a single bucket, the timers expire
+ * at the multiples of the period.
+ *
+ * The callbacks of a bucket are invoked in the context of the Add() which
+ * started the bucket, not in the context of their own Add(): a callback
+ * which schedules events for its node should use
+ * Simulator::ScheduleWithContext().
+ *
+ * Example usage:
+ *
+ * @code
+ *     m_timer = PeriodicTimerGroup::GetShared(Seconds(1)).Add(
+ *         MakeCallback(&MyModel::TimerHandler, this));
+ *     ...
+ *     PeriodicTimerGroup::GetShared(Seconds(1)).Remove(m_timer);
+ * @endcode
+ */
+class PeriodicTimerGroup
+{
+  public:
+    /** Identifier of a timer in a group; zero is not a valid timer. */
+    using TimerId = uint64_t;
+
+    /**
+     * Constructor.
+     * @param [in] period The period of the timers.
+     * @param [in] buckets The number of expiration events per period.
+     */
+    PeriodicTimerGroup(const Time& period, uint32_t buckets = 1);
+    /** Destructor, which cancels the expiration events. */
+    ~PeriodicTimerGroup();
+
+    /** Copying is not allowed. */
+    PeriodicTimerGroup(const PeriodicTimerGroup&) = delete;
+    /**
+     * Copying is not allowed.
+     * @returns This group.
+     */
+    PeriodicTimerGroup& operator=(const PeriodicTimerGroup&) = delete;
+
+    /**
+     * Get a group shared by all the models using the same period and
+     * number of buckets.  The shared groups are deleted by
+     * Simulator::Destroy().
+     * @param [in] period The period of the timers.
+     * @param [in] buckets The number of expiration events per period.
+     * @returns The shared group.
+     */
+    static PeriodicTimerGroup& GetShared(const Time& period, uint32_t buckets = 1);
+
+    /**
+     * Add a timer, which expires every period until it is removed.
+     * @param [in] callback The function to invoke at each expiration.
+     * @returns The timer identifier.
+     */
+    TimerId Add(Callback<void> callback);
+
+    /**
+     * Remove a timer; this may be called from the callbacks.
+     * @param [in] timer The timer identifier; unknown identifiers are ignored.
+     */
+    void Remove(TimerId timer);
+
+    /** @returns The period of the timers. */
+    Time GetPeriod() const;
+
+    /** @returns The number of timers in the group. */
+    std::size_t GetN() const;
+
+  private:
+    /** A timer of a bucket. */
+    struct Timer
+    {
+        TimerId id;              //!< The timer identifier
+        Callback<void> callback; //!< The function to invoke; null once removed
+    };
+
+    /** The timers expired by the same event. */
+    struct Bucket
+    {
+        std::vector<Timer> timers; //!< The timers
+        EventId event;             //!< The next expiration
+        std::size_t removed{0};    //!< Number of removed timers not yet erased
+    };
+
+    /** The position of a timer. */
+    struct Location
+    {
+        uint32_t bucket;      //!< The bucket index
+        std::size_t position; //!< The index of the timer in the bucket
+    };
+
+    /**
+     * Expire the timers of a bucket, and reschedule the bucket.
+     * @param [in] bucket The bucket index.
+     */
+    void Expire(uint32_t bucket);
+
+    /**
+     * Erase the removed timers of a bucket, and update the position of the
+     * remaining ones.
+     * @param [in] bucket The bucket index.
+     */
+    void Compact(uint32_t bucket);
+
+    /** Delete the shared groups. */
+    static void DeleteShared();
+
+    Time m_period;                                  //!< The period of the timers
+    std::vector<Bucket> m_buckets;                  //!< The buckets
+    std::unordered_map<TimerId, Location> m_timers; //!< Position of each timer
+    TimerId m_nextId;                               //!< Next timer identifier
+    int64_t m_expiring;                             //!< Bucket being expired, or -1
+};
+
+} // namespace ns3
+
+#endif /* PERIODIC_TIMER_GROUP_H */
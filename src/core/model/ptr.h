@@ -390,38 +390,6 @@ struct CallbackTraits<Ptr<T>>
     }
 };
 
-namespace internal
-{
-
-// Duplicate of struct EventMemberImplObjTraits<T> as defined in make-event.h
-// We repeat it here to declare a specialization on Ptr<T>
-// without making this header dependent on make-event.h
-template <typename T>
-struct EventMemberImplObjTraits;
-
-/**
- * @ingroup makeeventmemptr
- * Helper for the MakeEvent functions which take a class method.
- *
- * This is the specialization for Ptr types.
- *
- * @tparam T \deduced The type of the underlying object.
- */
-template <typename T>
-struct EventMemberImplObjTraits<Ptr<T>>
-{
-    /**
-     * @param [in] p Object pointer
-     * @return A reference to the object pointed to by p
-     */
-    static T& GetReference(Ptr<T> p)
-    {
-        return *PeekPointer(p);
-    }
-};
-
-} // namespace internal
-
 } // namespace ns3
 
 namespace ns3
@@ -0,0 +1,184 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "radix-scheduler.h"
+
+#include "assert.h"
+#include "event-impl.h"
+#include "log.h"
+
+#include <algorithm>
+#include <bit>
+
+/**
+ * @file
+ * @ingroup scheduler
+ * Implementation of ns3::RadixScheduler class.
+ */
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("RadixScheduler");
+
+NS_OBJECT_ENSURE_REGISTERED(RadixScheduler);
+
+TypeId
+RadixScheduler::GetTypeId()
+{
+    static TypeId tid = TypeId("ns3::RadixScheduler")
+                            .SetParent<Scheduler>()
+                            .SetGroupName("Core")
+                            .AddConstructor<RadixScheduler>();
+    return tid;
+}
+
+RadixScheduler::RadixScheduler()
+    : m_head(0),
+      m_last(0),
+      m_size(0)
+{
+    NS_LOG_FUNCTION(this);
+}
+
+RadixScheduler::~RadixScheduler()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+std::size_t
+RadixScheduler::GetBucket(uint64_t ts) const
+{
+    NS_ASSERT_MSG(ts >= m_last, "Event scheduled before the last removed event");
+    return 64 - std::countl_zero(ts ^ m_last);
+}
+
+std::size_t
+RadixScheduler::GetFirstBucket() const
+{
+    for (std::size_t i = 1; i < BUCKETS; i++)
+    {
+        if (!m_buckets[i].empty())
+        {
+            return i;
+        }
+    }
+    NS_ASSERT_MSG(false, "No event");
+    return BUCKETS;
+}
+
+void
+RadixScheduler::Redistribute()
+{
+    NS_LOG_FUNCTION(this);
+    Bucket& bucket0 = m_buckets[0];
+    bucket0.clear();
+    m_head = 0;
+
+    Bucket& from = m_buckets[GetFirstBucket()];
+    auto first = std::min_element(from.begin(), from.end(), [](const Event& a, const Event& b) {
+        return a.key.m_ts < b.key.m_ts;
+    });
+    m_last = first->key.m_ts;
+    for (const auto& ev : from)
+    {
+        m_buckets[GetBucket(ev.key.m_ts)].push_back(ev);
+    }
+    from.clear();
+    std::sort(bucket0.begin(), bucket0.end(), [](const Event& a, const Event& b) {
+        return a.key.m_uid < b.key.m_uid;
+    });
+}
+
+void
+RadixScheduler::Insert(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << &ev);
+    std::size_t index = GetBucket(ev.key.m_ts);
+    Bucket& bucket = m_buckets[index];
+    if (index == 0 && !bucket.empty() && ev.key.m_uid < bucket.back().key.m_uid)
+    {
+        // keep bucket 0 in uid order
+        auto pos = std::upper_bound(bucket.begin() + m_head,
+                                    bucket.end(),
+                                    ev,
+                                    [](const Event& a, const Event& b) { return a.key < b.key; });
+        bucket.insert(pos, ev);
+    }
+    else
+    {
+        bucket.push_back(ev);
+    }
+    m_size++;
+}
+
+bool
+RadixScheduler::IsEmpty() const
+{
+    NS_LOG_FUNCTION(this);
+    return m_size == 0;
+}
+
+Scheduler::Event
+RadixScheduler::PeekNext() const
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    if (m_head < m_buckets[0].size())
+    {
+        return m_buckets[0][m_head];
+    }
+    const Bucket& bucket = m_buckets[GetFirstBucket()];
+    return *std::min_element(bucket.begin(), bucket.end());
+}
+
+Scheduler::Event
+RadixScheduler::RemoveNext()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ASSERT(!IsEmpty());
+    if (m_head == m_buckets[0].size())
+    {
+        Redistribute();
+    }
+    Event next = m_buckets[0][m_head++];
+    if (m_head == m_buckets[0].size())
+    {
+        m_buckets[0].clear();
+        m_head = 0;
+    }
+    m_size--;
+    return next;
+}
+
+void
+RadixScheduler::Remove(const Event& ev)
+{
+    NS_LOG_FUNCTION(this << &ev);
+    std::size_t index = GetBucket(ev.key.m_ts);
+    Bucket& bucket = m_buckets[index];
+    auto begin = bucket.begin() + (index == 0 ? m_head : 0);
+    auto it = std::find_if(begin, bucket.end(), [&ev](const Event& other) {
+        return other.key.m_uid == ev.key.m_uid;
+    });
+    NS_ASSERT(it != bucket.end());
+    NS_ASSERT(it->impl == ev.impl);
+    if (index == 0)
+    {
+        bucket.erase(it);
+        if (m_head == bucket.size())
+        {
+            bucket.clear();
+            m_head = 0;
+        }
+    }
+    else
+    {
+        *it = bucket.back();
+        bucket.pop_back();
+    }
+    m_size--;
+}
+
+} // namespace ns3
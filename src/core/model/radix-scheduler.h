@@ -0,0 +1,116 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef RADIX_SCHEDULER_H
+#define RADIX_SCHEDULER_H
+
+#include "scheduler.h"
+
+#include <array>
+#include <stdint.h>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup scheduler
+ * ns3::RadixScheduler declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup scheduler
+ * @brief a monotone radix heap event scheduler
+ *
+ * The simulator never schedules an event before the current time, which
+ * is the time stamp of the last event removed from the scheduler.  A radix
+ * heap exploits this: an event is stored in the bucket given by the
+ * position of the most significant bit in which its time stamp differs
+ * from the last removed time stamp, so that all the events of a bucket are
+ * earlier than all the events of the next buckets.
+ *
+ * Bucket 0 holds the events at the last removed time stamp, sorted by uid.
+ * When it is empty, RemoveNext() finds the earliest time stamp in the first
+ * non-empty bucket and redistributes that bucket in the lower ones.  Each
+ * event is moved at most 64 times, and usually only a few times.
+ *
+ * Remove() searches only the bucket of the event.
+ *
+ * @par Time Complexity
+ *
+ * Operation    | Amortized %Time | Reason
+ * :----------- | :-------------- | :-----
+ * Insert()     | Constant        | Append to a bucket
+ * IsEmpty()    | Constant        | Explicit queue size
+ * PeekNext()   | Linear          | Search of the first non-empty bucket
+ * Remove()     | Linear          | Search of the bucket
+ * RemoveNext() | Logarithmic     | Redistribution, 64 bit keys
+ *
+ * @par Memory Complexity
+ *
+ * Category  | Memory                           | Reason
+ * :-------- | :------------------------------- | :-----
+ * Overhead  | 65 x 3 x `sizeof (*)`            | One `std::vector` per bucket
+ * Per Event | 0                                | Events stored in `std::vector` directly
+ */
+class RadixScheduler : public Scheduler
+{
+  public:
+    /**
+     *  Register this type.
+     *  @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    RadixScheduler();
+    /** Destructor. */
+    ~RadixScheduler() override;
+
+    // Inherited
+    void Insert(const Scheduler::Event& ev) override;
+    bool IsEmpty() const override;
+    Scheduler::Event PeekNext() const override;
+    Scheduler::Event RemoveNext() override;
+    void Remove(const Scheduler::Event& ev) override;
+
+  private:
+    /** Number of buckets: one per bit of the time stamp, plus bucket 0. */
+    static constexpr std::size_t BUCKETS = 65;
+
+    /** A bucket of events. */
+    typedef std::vector<Scheduler::Event> Bucket;
+
+    /**
+     * Get the bucket of a time stamp.
+     *
+     * @param [in] ts The time stamp, not earlier than m_last.
+     * @returns The bucket index.
+     */
+    std::size_t GetBucket(uint64_t ts) const;
+    /**
+     * Get the first non-empty bucket, after bucket 0.
+     *
+     * @returns The bucket index.
+     */
+    std::size_t GetFirstBucket() const;
+    /**
+     * Refill bucket 0 from the first non-empty bucket.
+     */
+    void Redistribute();
+
+    /** The buckets. */
+    std::array<Bucket, BUCKETS> m_buckets;
+    /** Index of the next event in bucket 0. */
+    std::size_t m_head;
+    /** Time stamp of the last removed event. */
+    uint64_t m_last;
+    /** Number of events. */
+    std::size_t m_size;
+};
+
+} // namespace ns3
+
+#endif /* RADIX_SCHEDULER_H */
@@ -100,6 +100,15 @@ RandomVariableStream::GetInteger()
     return value;
 }
 
+void
+RandomVariableStream::GetValues(std::span<double> values)
+{
+    for (auto& value : values)
+    {
+        value = GetValue();
+    }
+}
+
 void
 RandomVariableStream::SetStream(int64_t stream)
 {
@@ -140,6 +149,30 @@ RandomVariableStream::Peek() const
     return m_rng;
 }
 
+void
+RandomVariableStream::SaveCheckpoint(CheckpointWriter& writer) const
+{
+    NS_LOG_FUNCTION(this);
+    double state[6];
+    m_rng->GetState(state);
+    for (auto value : state)
+    {
+        writer.WriteDouble(value);
+    }
+}
+
+void
+RandomVariableStream::RestoreCheckpoint(CheckpointReader& reader)
+{
+    NS_LOG_FUNCTION(this);
+    double state[6];
+    for (auto& value : state)
+    {
+        value = reader.ReadDouble();
+    }
+    m_rng->SetState(state);
+}
+
 NS_OBJECT_ENSURE_REGISTERED(UniformRandomVariable);
 
 TypeId
@@ -194,6 +227,23 @@ UniformRandomVariable::GetValue(double min, double max)
     return v;
 }
 
+void
+UniformRandomVariable::GetValues(double min, double max, std::span<double> values)
+{
+    // Same arithmetic as GetValue(min, max), one uniform draw per value.
+    Peek()->RandU01(values);
+    for (auto& v : values)
+    {
+        v = min + v * (max - min);
+        if (IsAntithetic())
+        {
+            v = min + (max - v);
+        }
+    }
+    NS_LOG_DEBUG(values.size() << " values, stream: " << GetStream() << " min: " << min
+                               << " max: " << max);
+}
+
 uint32_t
 UniformRandomVariable::GetInteger(uint32_t min, uint32_t max)
 {
@@ -210,6 +260,12 @@ UniformRandomVariable::GetValue()
     return GetValue(m_min, m_max);
 }
 
+void
+UniformRandomVariable::GetValues(std::span<double> values)
+{
+    GetValues(m_min, m_max, values);
+}
+
 uint32_t
 UniformRandomVariable::GetInteger()
 {
@@ -268,6 +324,12 @@ ConstantRandomVariable::GetValue()
     return GetValue(m_constant);
 }
 
+void
+ConstantRandomVariable::GetValues(std::span<double> values)
+{
+    std::fill(values.begin(), values.end(), m_constant);
+}
+
 NS_OBJECT_ENSURE_REGISTERED(SequentialRandomVariable);
 
 TypeId
@@ -778,6 +840,24 @@ NormalRandomVariable::GetValue()
     return GetValue(m_mean, m_variance, m_bound);
 }
 
+void
+NormalRandomVariable::SaveCheckpoint(CheckpointWriter& writer) const
+{
+    RandomVariableStream::SaveCheckpoint(writer);
+    writer.WriteU8(m_nextValid);
+    writer.WriteDouble(m_v2);
+    writer.WriteDouble(m_y);
+}
+
+void
+NormalRandomVariable::RestoreCheckpoint(CheckpointReader& reader)
+{
+    RandomVariableStream::RestoreCheckpoint(reader);
+    m_nextValid = reader.ReadU8();
+    m_v2 = reader.ReadDouble();
+    m_y = reader.ReadDouble();
+}
+
 NS_OBJECT_ENSURE_REGISTERED(LogNormalRandomVariable);
 
 TypeId
@@ -901,6 +981,24 @@ LogNormalRandomVariable::GetValue()
     return GetValue(m_mu, m_sigma);
 }
 
+void
+LogNormalRandomVariable::SaveCheckpoint(CheckpointWriter& writer) const
+{
+    RandomVariableStream::SaveCheckpoint(writer);
+    writer.WriteU8(m_nextValid);
+    writer.WriteDouble(m_v2);
+    writer.WriteDouble(m_normal);
+}
+
+void
+LogNormalRandomVariable::RestoreCheckpoint(CheckpointReader& reader)
+{
+    RandomVariableStream::RestoreCheckpoint(reader);
+    m_nextValid = reader.ReadU8();
+    m_v2 = reader.ReadDouble();
+    m_normal = reader.ReadDouble();
+}
+
 NS_OBJECT_ENSURE_REGISTERED(GammaRandomVariable);
 
 TypeId
@@ -1024,6 +1122,24 @@ GammaRandomVariable::GetValue()
     return GetValue(m_alpha, m_beta);
 }
 
+void
+GammaRandomVariable::SaveCheckpoint(CheckpointWriter& writer) const
+{
+    RandomVariableStream::SaveCheckpoint(writer);
+    writer.WriteU8(m_nextValid);
+    writer.WriteDouble(m_v2);
+    writer.WriteDouble(m_y);
+}
+
+void
+GammaRandomVariable::RestoreCheckpoint(CheckpointReader& reader)
+{
+    RandomVariableStream::RestoreCheckpoint(reader);
+    m_nextValid = reader.ReadU8();
+    m_v2 = reader.ReadDouble();
+    m_y = reader.ReadDouble();
+}
+
 double
 GammaRandomVariable::GetNormalValue(double mean, double variance, double bound)
 {
@@ -16,10 +16,12 @@
 #define RANDOM_VARIABLE_STREAM_H
 
 #include "attribute-helper.h"
+#include "checkpoint.h"
 #include "object.h"
 #include "type-id.h"
 
 #include <map>
+#include <span>
 #include <stdint.h>
 
 /**
@@ -86,7 +88,7 @@ class RngStream;
  * See the documentation for the specific distributions to see
  * how this modifies the returned values.
  */
-class RandomVariableStream : public Object
+class RandomVariableStream : public Object, public Checkpointable
 {
   public:
     /**
@@ -143,6 +145,31 @@ class RandomVariableStream : public Object
     // The base implementation returns `(uint32_t)GetValue()`
     virtual uint32_t GetInteger();
 
+    /**
+     * @brief Get the next random values drawn from the distribution.
+     *
+     * The values are the ones that as many calls to GetValue() would return,
+     * in the same order, so that drawing a block of values at once does not
+     * change the sequence of the stream.
+     * The base implementation calls GetValue() for each value.
+     *
+     * @param [out] values The random values.
+     */
+    virtual void GetValues(std::span<double> values);
+
+    /**
+     * @brief Save the state of the underlying RngStream, so that the
+     * restored stream continues the same sequence.
+     *
+     * The subclasses caching values drawn ahead, such as
+     * NormalRandomVariable, save them as well.
+     *
+     * @param [in] writer The section of the stream.
+     */
+    void SaveCheckpoint(CheckpointWriter& writer) const override;
+    /** @copydoc Checkpointable::RestoreCheckpoint */
+    void RestoreCheckpoint(CheckpointReader& reader) override;
+
   protected:
     /**
      * @brief Get the pointer to the underlying RngStream.
@@ -261,6 +288,14 @@ class UniformRandomVariable : public RandomVariableStream
      */
     uint32_t GetInteger(uint32_t min, uint32_t max);
 
+    /**
+     * @copydoc RandomVariableStream::GetValues()
+     *
+     * @param [in] min Low end of the range (included).
+     * @param [in] max High end of the range (excluded).
+     */
+    void GetValues(double min, double max, std::span<double> values);
+
     // Inherited
     /**
      * @copydoc RandomVariableStream::GetValue()
@@ -274,6 +309,9 @@ class UniformRandomVariable : public RandomVariableStream
      */
     uint32_t GetInteger() override;
 
+    /** @copydoc RandomVariableStream::GetValues() */
+    void GetValues(std::span<double> values) override;
+
   private:
     /** The lower bound on values that can be returned by this RNG stream. */
     double m_min;
@@ -332,6 +370,8 @@ class ConstantRandomVariable : public RandomVariableStream
     double GetValue() override;
     /* \note This RNG always returns the same value. */
     using RandomVariableStream::GetInteger;
+    /** @copydoc RandomVariableStream::GetValues() */
+    void GetValues(std::span<double> values) override;
 
   private:
     /** The constant value returned by this RNG stream. */
@@ -1027,6 +1067,8 @@ class NormalRandomVariable : public RandomVariableStream
     // Inherited
     double GetValue() override;
     using RandomVariableStream::GetInteger;
+    void SaveCheckpoint(CheckpointWriter& writer) const override;
+    void RestoreCheckpoint(CheckpointReader& reader) override;
 
   private:
     /** The mean value for the normal distribution returned by this RNG stream. */
@@ -1179,6 +1221,8 @@ class LogNormalRandomVariable : public RandomVariableStream
     // Inherited
     double GetValue() override;
     using RandomVariableStream::GetInteger;
+    void SaveCheckpoint(CheckpointWriter& writer) const override;
+    void RestoreCheckpoint(CheckpointReader& reader) override;
 
   private:
     /** The mu value for the log-normal distribution returned by this RNG stream. */
@@ -1293,6 +1337,8 @@ class GammaRandomVariable : public RandomVariableStream
     // Inherited
     double GetValue() override;
     using RandomVariableStream::GetInteger;
+    void SaveCheckpoint(CheckpointWriter& writer) const override;
+    void RestoreCheckpoint(CheckpointReader& reader) override;
 
   private:
     /**
@@ -13,6 +13,7 @@
 #include "fatal-error.h"
 #include "log.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 
@@ -326,8 +327,18 @@ namespace ns3
 
 using namespace MRG32k3a;
 
-double
-RngStream::RandU01()
+namespace
+{
+
+/**
+ * @ingroup rngimpl
+ * Advance a state vector of MRG32k3a by one step.
+ *
+ * @param [in,out] state The state vector.
+ * @returns The next random, uniformly distributed between 0 and 1.
+ */
+inline double
+NextU01(double state[6])
 {
     int32_t k;
     double p1;
@@ -335,28 +346,28 @@ RngStream::RandU01()
     double u;
 
     /* Component 1 */
-    p1 = a12 * m_currentState[1] - a13n * m_currentState[0];
+    p1 = a12 * state[1] - a13n * state[0];
     k = static_cast<int32_t>(p1 / m1);
     p1 -= k * m1;
     if (p1 < 0.0)
     {
         p1 += m1;
     }
-    m_currentState[0] = m_currentState[1];
-    m_currentState[1] = m_currentState[2];
-    m_currentState[2] = p1;
+    state[0] = state[1];
+    state[1] = state[2];
+    state[2] = p1;
 
     /* Component 2 */
-    p2 = a21 * m_currentState[5] - a23n * m_currentState[3];
+    p2 = a21 * state[5] - a23n * state[3];
     k = static_cast<int32_t>(p2 / m2);
     p2 -= k * m2;
     if (p2 < 0.0)
     {
         p2 += m2;
     }
-    m_currentState[3] = m_currentState[4];
-    m_currentState[4] = m_currentState[5];
-    m_currentState[5] = p2;
+    state[3] = state[4];
+    state[4] = state[5];
+    state[5] = p2;
 
     /* Combination */
     u = ((p1 > p2) ? (p1 - p2) * MRG32k3a::norm : (p1 - p2 + m1) * MRG32k3a::norm);
@@ -364,6 +375,40 @@ RngStream::RandU01()
     return u;
 }
 
+} // namespace
+
+double
+RngStream::RandU01()
+{
+    return NextU01(m_currentState);
+}
+
+void
+RngStream::RandU01(std::span<double> values)
+{
+    // The recursion is inherently sequential; stepping a local copy of the
+    // state lets the compiler keep it in registers across the whole block.
+    double state[6];
+    std::copy(m_currentState, m_currentState + 6, state);
+    for (auto& value : values)
+    {
+        value = NextU01(state);
+    }
+    std::copy(state, state + 6, m_currentState);
+}
+
+void
+RngStream::GetState(double state[6]) const
+{
+    std::copy(m_currentState, m_currentState + 6, state);
+}
+
+void
+RngStream::SetState(const double state[6])
+{
+    std::copy(state, state + 6, m_currentState);
+}
+
 RngStream::RngStream(uint32_t seedNumber, uint64_t stream, uint64_t substream)
 {
     if (seedNumber >= m1 || seedNumber >= m2 || seedNumber == 0)
@@ -7,6 +7,7 @@
 
 #ifndef RNGSTREAM_H
 #define RNGSTREAM_H
+#include <span>
 #include <stdint.h>
 #include <string>
 
@@ -59,6 +60,26 @@ class RngStream
      * @returns The next random.
      */
     double RandU01();
+    /**
+     * Generate the next random numbers for this stream, the same as
+     * calling RandU01() once for each of them.
+     *
+     * @param [out] values The next randoms, uniformly distributed between 0 and 1.
+     */
+    void RandU01(std::span<double> values);
+
+    /**
+     * Get the state of the generator, e.g., to save it in a Checkpoint.
+     *
+     * @param [out] state The state vector.
+     */
+    void GetState(double state[6]) const;
+    /**
+     * Set the state of the generator, as returned by GetState().
+     *
+     * @param [in] state The state vector.
+     */
+    void SetState(const double state[6]);
 
   private:
     /**
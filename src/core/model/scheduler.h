@@ -92,6 +92,14 @@ class EventImpl;
  *      <td class="markdownTableBodyLeft"> 16 bytes </td>
  * </tr>
  * <tr class="markdownTableBody">
+ *      <td class="markdownTableBodyLeft"> DaryHeapScheduler </td>
+ *      <td class="markdownTableBodyLeft"> d-ary heap on two `std::vector` </td>
+ *      <td class="markdownTableBodyLeft"> Logarithmic  </td>
+ *      <td class="markdownTableBodyLeft"> Logarithmic </td>
+ *      <td class="markdownTableBodyLeft"> 48 bytes </td>
+ *      <td class="markdownTableBodyLeft"> 0 </td>
+ * </tr>
+ * <tr class="markdownTableBody">
  *      <td class="markdownTableBodyLeft"> HeapScheduler </td>
  *      <td class="markdownTableBodyLeft"> Heap on `std::vector` </td>
  *      <td class="markdownTableBodyLeft"> Logarithmic  </td>
@@ -100,6 +108,14 @@ class EventImpl;
  *      <td class="markdownTableBodyLeft"> 0 </td>
  * </tr>
  * <tr class="markdownTableBody">
+ *      <td class="markdownTableBodyLeft"> LadderScheduler </td>
+ *      <td class="markdownTableBodyLeft"> Ladder of `std::vector` buckets </td>
+ *      <td class="markdownTableBodyLeft"> Constant </td>
+ *      <td class="markdownTableBodyLeft"> Constant </td>
+ *      <td class="markdownTableBodyLeft"> 10 x 24 bytes </td>
+ *      <td class="markdownTableBodyLeft"> ~24 bytes </td>
+ * </tr>
+ * <tr class="markdownTableBody">
  *      <td class="markdownTableBodyLeft"> ListScheduler </td>
  *      <td class="markdownTableBodyLeft"> `std::list` </td>
  *      <td class="markdownTableBodyLeft"> Linear </td>
@@ -123,6 +139,14 @@ class EventImpl;
  *      <td class="markdownTableBodyLeft"> 24 bytes </td>
  *      <td class="markdownTableBodyLeft"> 0 </td>
  * </tr>
+ * <tr class="markdownTableBody">
+ *      <td class="markdownTableBodyLeft"> RadixScheduler </td>
+ *      <td class="markdownTableBodyLeft"> Radix heap of `std::vector` </td>
+ *      <td class="markdownTableBodyLeft"> Constant </td>
+ *      <td class="markdownTableBodyLeft"> Logarithmic </td>
+ *      <td class="markdownTableBodyLeft"> 1560 bytes </td>
+ *      <td class="markdownTableBodyLeft"> 0 </td>
+ * </tr>
  * </table>
  *
  * It is possible to change the Scheduler choice during a simulation,
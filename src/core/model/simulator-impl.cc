@@ -7,6 +7,7 @@
 
 #include "simulator-impl.h"
 
+#include "fatal-error.h"
 #include "log.h"
 
 /**
@@ -29,4 +30,10 @@ SimulatorImpl::GetTypeId()
     return tid;
 }
 
+void
+SimulatorImpl::SetStartTime(const Time& time)
+{
+    NS_FATAL_ERROR(GetInstanceTypeId().GetName() << " can't start at " << time);
+}
+
 } // namespace ns3
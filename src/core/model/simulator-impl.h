@@ -83,6 +83,12 @@ class SimulatorImpl : public Object
      * before we start to use it.
      */
     virtual void SetScheduler(ObjectFactory schedulerFactory) = 0;
+    /**
+     * @copydoc Simulator::SetStartTime
+     *
+     * The base implementation does not support it.
+     */
+    virtual void SetStartTime(const Time& time);
     /** @copydoc Simulator::GetSystemId */
     virtual uint32_t GetSystemId() const = 0;
     /** @copydoc Simulator::GetContext */
@@ -7,6 +7,7 @@
  */
 #include "simulator.h"
 
+#include "abort.h"
 #include "assert.h"
 #include "des-metrics.h"
 #include "event-impl.h"
@@ -21,13 +22,21 @@
 
 #include "ns3/core-config.h"
 
+#include <cerrno>
 #include <cmath>
+#include <cstdio>
+#include <cstring> // strerror
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <list>
 #include <vector>
 
+#ifndef __WIN32__
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 /**
  * @file
  * @ingroup simulator
@@ -156,6 +165,13 @@ Simulator::SetScheduler(ObjectFactory schedulerFactory)
     GetImpl()->SetScheduler(schedulerFactory);
 }
 
+void
+Simulator::SetStartTime(const Time& time)
+{
+    NS_LOG_FUNCTION(time);
+    GetImpl()->SetStartTime(time);
+}
+
 bool
 Simulator::IsFinished()
 {
@@ -171,6 +187,101 @@ Simulator::Run()
     GetImpl()->Run();
 }
 
+std::vector<std::string>
+Simulator::ForkAt(const Time& time,
+                  uint32_t n,
+                  Callback<void, uint32_t> branch,
+                  Callback<std::string, uint32_t> result)
+{
+    NS_LOG_FUNCTION(time << n);
+#ifdef __WIN32__
+    NS_FATAL_ERROR("Simulator::ForkAt() is not supported on Windows");
+#else
+    NS_ABORT_MSG_IF(time < Now(), "Can't fork at " << time << ", in the past");
+    // Don't replace the stop event of the caller, which the branches may reach
+    EventId stop = GetImpl()->Stop(time - Now());
+    Run();
+    stop.Cancel();
+
+    // Don't write the buffered output once per process
+    std::cout.flush();
+    std::clog.flush();
+    std::fflush(nullptr);
+    if (BinaryLog::IsEnabled())
+    {
+        BinaryLog::Flush();
+    }
+
+    std::vector<int> pipes(n);
+    std::vector<pid_t> pids(n);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        int fds[2];
+        NS_ABORT_MSG_IF(pipe(fds) != 0, "pipe() failed: " << std::strerror(errno));
+        pid_t pid = fork();
+        NS_ABORT_MSG_IF(pid < 0, "fork() failed: " << std::strerror(errno));
+        if (pid == 0)
+        {
+            for (uint32_t j = 0; j < i; j++)
+            {
+                close(pipes[j]);
+            }
+            close(fds[0]);
+            if (!branch.IsNull())
+            {
+                branch(i);
+            }
+            Run();
+            std::string output = result.IsNull() ? "" : result(i);
+            Destroy();
+            std::size_t written = 0;
+            while (written < output.size())
+            {
+                ssize_t size = write(fds[1], output.data() + written, output.size() - written);
+                if (size < 0 && errno == EINTR)
+                {
+                    continue;
+                }
+                NS_ABORT_MSG_IF(size < 0, "write() failed: " << std::strerror(errno));
+                written += size;
+            }
+            close(fds[1]);
+            std::cout.flush();
+            std::clog.flush();
+            std::fflush(nullptr);
+            _exit(0);
+        }
+        NS_LOG_LOGIC("branch " << i << " is process " << pid);
+        close(fds[1]);
+        pipes[i] = fds[0];
+        pids[i] = pid;
+    }
+
+    std::vector<std::string> results(n);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        char buffer[4096];
+        ssize_t size;
+        while ((size = read(pipes[i], buffer, sizeof(buffer))) != 0)
+        {
+            if (size < 0 && errno == EINTR)
+            {
+                continue;
+            }
+            NS_ABORT_MSG_IF(size < 0, "read() failed: " << std::strerror(errno));
+            results[i].append(buffer, size);
+        }
+        close(pipes[i]);
+        int status;
+        NS_ABORT_MSG_IF(waitpid(pids[i], &status, 0) != pids[i],
+                        "waitpid() failed: " << std::strerror(errno));
+        NS_ABORT_MSG_UNLESS(WIFEXITED(status) && WEXITSTATUS(status) == 0,
+                            "Branch " << i << " of the simulation failed");
+    }
+    return results;
+#endif
+}
+
 void
 Simulator::Stop()
 {
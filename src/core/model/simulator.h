@@ -9,6 +9,7 @@
 #ifndef SIMULATOR_H
 #define SIMULATOR_H
 
+#include "callback.h"
 #include "event-id.h"
 #include "event-impl.h"
 #include "make-event.h"
@@ -17,6 +18,7 @@
 
 #include <stdint.h>
 #include <string>
+#include <vector>
 
 /**
  * @file
@@ -103,6 +105,17 @@ class Simulator
      */
     static void SetScheduler(ObjectFactory schedulerFactory);
 
+    /**
+     * @brief Start the simulation at some time rather than at 0.
+     *
+     * This is used to resume a simulation from a Checkpoint: it must be
+     * called before any event is scheduled, and the events scheduled
+     * afterwards are relative to @p time.
+     *
+     * @param [in] time The start time of the simulation.
+     */
+    static void SetStartTime(const Time& time);
+
     /**
      * Execute the events scheduled with ScheduleDestroy().
      *
@@ -137,6 +150,33 @@ class Simulator
      */
     static void Run();
 
+    /**
+     * Run the simulation until @p time, then branch it into @p n child
+     * processes which share the state reached at @p time copy-on-write.
+     *
+     * Each child \c i calls @p branch(i), e.g., to override the parameters
+     * which only matter after @p time, runs the rest of the simulation,
+     * calls @p result(i), destroys the simulation and exits.  The result
+     * strings are sent to the calling process through pipes.  This turns
+     * \c n runs of a scenario into one shared prefix plus \c n suffixes.
+     *
+     * The children run concurrently.  The files opened before the fork are
+     * shared by all the processes: the outputs of a branch should be opened
+     * by @p branch.  This is only supported on POSIX systems.
+     *
+     * @param [in] time The time of the fork.
+     * @param [in] n The number of branches.
+     * @param [in] branch The callback configuring a branch in its child.
+     * @param [in] result The callback returning the result of a branch,
+     *             called at the end of the simulation in its child.
+     * @returns The results of the branches, in order, once all the children
+     *          exited.  The simulation of the calling process is at @p time.
+     */
+    static std::vector<std::string> ForkAt(const Time& time,
+                                           uint32_t n,
+                                           Callback<void, uint32_t> branch,
+                                           Callback<std::string, uint32_t> result);
+
     /**
      * Tell the Simulator the calling event should be the last one
      * executed.
@@ -11,7 +11,10 @@
 
 #include "callback.h"
 
-#include <list>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 /**
  * @file
@@ -34,7 +37,19 @@ namespace ns3
  *
  * This is a functor: the chain of Callbacks is invoked by
  * calling the \c operator() form with the appropriate
- * number of arguments.
+ * number of arguments.  When the arguments are expensive to build,
+ * e.g., a copy of a packet, the NS_TRACE() macro avoids building them
+ * when nothing is connected.
+ *
+ * Statistics sinks which do not need to be invoked synchronously can be
+ * connected with ConnectBatched(): the TracedCallback then appends a copy
+ * of the arguments to a buffer, and invokes the sink with all the buffered
+ * records when the buffer is full, when Flush() is called, and when the
+ * TracedCallback is destroyed.
+ *
+ * A sink may connect or disconnect sinks, including itself, while it is
+ * invoked: the sinks disconnected during an invocation are removed once
+ * all the sinks have been invoked, and are not invoked anymore.
  *
  * @tparam Ts \explicit Types of the functor arguments.
  */
@@ -42,8 +57,28 @@ template <typename... Ts>
 class TracedCallback
 {
   public:
+    /** The copy of the arguments of an invocation, buffered for a batched sink. */
+    using Record = std::tuple<std::decay_t<Ts>...>;
+    /** The signature of a batched sink. */
+    using BatchCallback = Callback<void, const std::vector<Record>&>;
+
     /** Constructor. */
     TracedCallback();
+    /**
+     * Copy constructor; the sinks are copied, but not the records buffered
+     * for the batched sinks, which are delivered by \p o only.
+     * @param [in] o The TracedCallback to copy.
+     */
+    TracedCallback(const TracedCallback& o);
+    /**
+     * Copy assignment; the buffered records are flushed, then the sinks are
+     * replaced by the sinks of \p o, without its buffered records.
+     * @param [in] o The TracedCallback to copy.
+     * @returns This TracedCallback.
+     */
+    TracedCallback& operator=(const TracedCallback& o);
+    /** Destructor, which flushes the batched sinks. */
+    ~TracedCallback();
     /**
      * Append a Callback to the chain (without a context).
      *
@@ -73,6 +108,25 @@ class TracedCallback
      * @param [in] path Context path which was used to connect the Callback.
      */
     void Disconnect(const CallbackBase& callback, std::string path);
+    /**
+     * Append a batched sink, which is invoked with the records of
+     * \p batchSize invocations at a time.
+     *
+     * The records hold copies of the arguments, which may keep objects,
+     * e.g., packets, alive until the records are delivered.
+     *
+     * @param [in] callback Sink to add.
+     * @param [in] batchSize Number of records delivered at a time.
+     */
+    void ConnectBatched(const BatchCallback& callback, std::size_t batchSize);
+    /**
+     * Deliver the buffered records, then remove a batched sink.
+     *
+     * @param [in] callback Sink to remove.
+     */
+    void DisconnectBatched(const CallbackBase& callback);
+    /** Deliver the buffered records to the batched sinks. */
+    void Flush() const;
     /**
      * @brief Functor which invokes the chain of Callbacks.
      * @tparam Ts \deduced Types of the functor arguments.
@@ -81,7 +135,7 @@ class TracedCallback
     void operator()(Ts... args) const;
     /**
      * @brief Checks if the Callbacks list is empty.
-     * @return true if the Callbacks list is empty.
+     * @return true if neither a Callback nor a batched sink is connected.
      */
     bool IsEmpty() const;
 
@@ -97,16 +151,73 @@ class TracedCallback
     /**@}*/
 
   private:
+    /** A batched sink and its buffer. */
+    struct Batch
+    {
+        BatchCallback callback;      //!< The sink
+        std::size_t size;            //!< Number of records delivered at a time
+        std::vector<Record> records; //!< The buffered records
+    };
+
+    /**
+     * Deliver the buffered records of a batched sink.
+     * @param [in] index The index of the sink.
+     */
+    void Deliver(std::size_t index) const;
+
+    /**
+     * Copy the sinks of another TracedCallback, without its buffered records.
+     * @param [in] o The TracedCallback to copy.
+     */
+    void CopySinks(const TracedCallback& o);
+
+    /** Remove the sinks disconnected while the sinks were invoked. */
+    void RemoveDisconnected() const;
+
     /**
      * Container type for holding the chain of Callbacks.
      *
+     * A vector keeps the Callbacks contiguous, which is faster to
+     * iterate than a list.
+     *
      * @tparam Ts \deduced Types of the functor arguments.
      */
-    typedef std::list<Callback<void, Ts...>> CallbackList;
-    /** The chain of Callbacks. */
-    CallbackList m_callbackList;
+    typedef std::vector<Callback<void, Ts...>> CallbackList;
+    /**
+     * The chain of Callbacks.  The Callbacks disconnected while the sinks
+     * are invoked are nullified, then removed by operator().
+     */
+    mutable CallbackList m_callbackList;
+    /** The batched sinks, allocated by the first ConnectBatched(). */
+    mutable std::unique_ptr<std::vector<Batch>> m_batches;
+    /** Number of nested invocations of operator() in progress. */
+    mutable uint32_t m_invoking{0};
+    /** Whether sinks were disconnected while the sinks were invoked. */
+    mutable bool m_disconnected{false};
 };
 
+/**
+ * @ingroup tracing
+ * Invoke a TracedCallback, but evaluate the arguments only if something is
+ * connected to it.
+ *
+ * Example usage:
+ * @code
+ *     NS_TRACE(m_rxTrace, packet->Copy());
+ * @endcode
+ *
+ * @param [in] trace The TracedCallback.
+ * @param [in] ... The arguments.
+ */
+#define NS_TRACE(trace, ...)                                                                       \
+    do                                                                                             \
+    {                                                                                              \
+        if (!(trace).IsEmpty())                                                                    \
+        {                                                                                          \
+            (trace)(__VA_ARGS__);                                                                  \
+        }                                                                                          \
+    } while (false)
+
 } // namespace ns3
 
 /********************************************************************
@@ -122,6 +233,60 @@ TracedCallback<Ts...>::TracedCallback()
 {
 }
 
+template <typename... Ts>
+TracedCallback<Ts...>::TracedCallback(const TracedCallback& o)
+{
+    CopySinks(o);
+}
+
+template <typename... Ts>
+TracedCallback<Ts...>&
+TracedCallback<Ts...>::operator=(const TracedCallback& o)
+{
+    if (this != &o)
+    {
+        Flush();
+        m_callbackList.clear();
+        m_batches.reset();
+        CopySinks(o);
+    }
+    return *this;
+}
+
+template <typename... Ts>
+void
+TracedCallback<Ts...>::CopySinks(const TracedCallback& o)
+{
+    for (const auto& callback : o.m_callbackList)
+    {
+        if (!callback.IsNull())
+        {
+            m_callbackList.push_back(callback);
+        }
+    }
+    if (o.m_batches)
+    {
+        m_batches = std::make_unique<std::vector<Batch>>();
+        for (const auto& batch : *o.m_batches)
+        {
+            if (!batch.callback.IsNull())
+            {
+                ConnectBatched(batch.callback, batch.size);
+            }
+        }
+        if (m_batches->empty())
+        {
+            m_batches.reset();
+        }
+    }
+}
+
+template <typename... Ts>
+TracedCallback<Ts...>::~TracedCallback()
+{
+    Flush();
+}
+
 template <typename... Ts>
 void
 TracedCallback<Ts...>::ConnectWithoutContext(const CallbackBase& callback)
@@ -153,14 +318,21 @@ TracedCallback<Ts...>::DisconnectWithoutContext(const CallbackBase& callback)
 {
     for (auto i = m_callbackList.begin(); i != m_callbackList.end(); /* empty */)
     {
-        if ((*i).IsEqual(callback))
+        if (!(*i).IsEqual(callback))
         {
-            i = m_callbackList.erase(i);
+            i++;
         }
-        else
+        else if (m_invoking > 0)
         {
+            // Removing the Callback would shift the sinks not invoked yet.
+            (*i).Nullify();
+            m_disconnected = true;
             i++;
         }
+        else
+        {
+            i = m_callbackList.erase(i);
+        }
     }
 }
 
@@ -177,13 +349,143 @@ TracedCallback<Ts...>::Disconnect(const CallbackBase& callback, std::string path
     DisconnectWithoutContext(realCb);
 }
 
+template <typename... Ts>
+void
+TracedCallback<Ts...>::ConnectBatched(const BatchCallback& callback, std::size_t batchSize)
+{
+    NS_ASSERT_MSG(batchSize > 0, "The batch size must be positive");
+    if (!m_batches)
+    {
+        m_batches = std::make_unique<std::vector<Batch>>();
+    }
+    Batch batch{callback, batchSize, {}};
+    batch.records.reserve(batchSize);
+    m_batches->push_back(std::move(batch));
+}
+
+template <typename... Ts>
+void
+TracedCallback<Ts...>::DisconnectBatched(const CallbackBase& callback)
+{
+    if (!m_batches)
+    {
+        return;
+    }
+    for (std::size_t i = 0; m_batches && i < m_batches->size(); /* empty */)
+    {
+        if ((*m_batches)[i].callback.IsEqual(callback))
+        {
+            Deliver(i);
+            // The sink may have changed the batched sinks.
+            if (m_batches && i < m_batches->size() && (*m_batches)[i].callback.IsEqual(callback))
+            {
+                if (m_invoking > 0)
+                {
+                    (*m_batches)[i].callback.Nullify();
+                    m_disconnected = true;
+                    i++;
+                }
+                else
+                {
+                    m_batches->erase(m_batches->begin() + i);
+                }
+            }
+        }
+        else
+        {
+            i++;
+        }
+    }
+    if (m_batches && m_batches->empty())
+    {
+        m_batches.reset();
+    }
+}
+
+template <typename... Ts>
+void
+TracedCallback<Ts...>::Flush() const
+{
+    for (std::size_t i = 0; m_batches && i < m_batches->size(); i++)
+    {
+        Deliver(i);
+    }
+}
+
+template <typename... Ts>
+void
+TracedCallback<Ts...>::Deliver(std::size_t index) const
+{
+    std::vector<Record> records;
+    records.swap((*m_batches)[index].records);
+    if (records.empty())
+    {
+        return;
+    }
+    // The sink may connect or disconnect sinks, so it is invoked with a
+    // buffer which no longer belongs to this TracedCallback.
+    BatchCallback callback = (*m_batches)[index].callback;
+    callback(records);
+    if (m_batches && index < m_batches->size() && (*m_batches)[index].records.empty())
+    {
+        // Reuse the allocation of the delivered buffer.
+        records.clear();
+        records.swap((*m_batches)[index].records);
+    }
+}
+
 template <typename... Ts>
 void
 TracedCallback<Ts...>::operator()(Ts... args) const
 {
-    for (auto i = m_callbackList.begin(); i != m_callbackList.end(); i++)
+    // Sinks may connect sinks, which may reallocate the vector: each
+    // Callback is copied before it is invoked.  Sinks may also disconnect
+    // sinks: these are nullified, then removed once all the sinks have
+    // been invoked, so that no sink is skipped.
+    m_invoking++;
+    for (std::size_t i = 0; i < m_callbackList.size(); i++)
     {
-        (*i)(args...);
+        Callback<void, Ts...> callback = m_callbackList[i];
+        if (!callback.IsNull())
+        {
+            callback(args...);
+        }
+    }
+    if (m_batches) [[unlikely]]
+    {
+        for (std::size_t i = 0; m_batches && i < m_batches->size(); i++)
+        {
+            Batch& batch = (*m_batches)[i];
+            if (batch.callback.IsNull())
+            {
+                continue;
+            }
+            batch.records.emplace_back(args...);
+            if (batch.records.size() >= batch.size)
+            {
+                Deliver(i);
+            }
+        }
+    }
+    if (--m_invoking == 0 && m_disconnected) [[unlikely]]
+    {
+        RemoveDisconnected();
+    }
+}
+
+template <typename... Ts>
+void
+TracedCallback<Ts...>::RemoveDisconnected() const
+{
+    m_disconnected = false;
+    std::erase_if(m_callbackList, [](const auto& callback) { return callback.IsNull(); });
+    if (m_batches)
+    {
+        std::erase_if(*m_batches, [](const Batch& batch) { return batch.callback.IsNull(); });
+        if (m_batches->empty())
+        {
+            m_batches.reset();
+        }
     }
 }
 
@@ -191,7 +493,7 @@ template <typename... Ts>
 bool
 TracedCallback<Ts...>::IsEmpty() const
 {
-    return m_callbackList.empty();
+    return m_callbackList.empty() && !m_batches;
 }
 
 } // namespace ns3
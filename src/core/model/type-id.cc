@@ -15,6 +15,7 @@
 #include <iomanip>
 #include <map>
 #include <sstream>
+#include <unordered_map>
 #include <vector>
 
 /**
@@ -35,6 +36,22 @@ NS_LOG_COMPONENT_DEFINE("TypeId");
 // IidManager needs to be in ns3 namespace for NS_ASSERT and NS_LOG
 // to find g_log
 
+/**
+ * @ingroup object
+ * The first pending TypeId registration.
+ *
+ * The pending registrations are linked in the order of the static
+ * initialization, so that running all of them registers the TypeIds in
+ * the order of the modules, as registering them at static initialization
+ * did.
+ */
+static TypeId::LazyRegistration* g_pendingRegistrations = nullptr;
+/**
+ * @ingroup object
+ * The link to append the next pending TypeId registration.
+ */
+static TypeId::LazyRegistration** g_pendingRegistrationsEnd = &g_pendingRegistrations;
+
 /**
  * @ingroup object
  * @brief TypeId information manager
@@ -184,6 +201,21 @@ class IidManager : public Singleton<IidManager>
      * @returns The type id.
      */
     uint16_t GetRegistered(uint16_t i) const;
+    /**
+     * Run the pending registration of a class, if any.
+     * @param [in] name The name of the class, without the ns3:: namespace.
+     * @returns \c true if a registration was pending for this class.
+     */
+    bool RegisterPending(const std::string& name);
+    /** Run all the pending registrations. */
+    void RegisterAllPending();
+    /**
+     * Get a type id by name, running the pending registrations needed to
+     * find it.
+     * @param [in] name The type id to find.
+     * @returns The type id.  A type id of 0 means \pname{name} wasn't found.
+     */
+    uint16_t LookupUid(const std::string& name);
     /**
      * Record a new attribute in a type id.
      * @param [in] uid The id.
@@ -271,6 +303,30 @@ class IidManager : public Singleton<IidManager>
      * @returns \c true if this TypeId should be hidden from the user.
      */
     bool MustHideFromDocumentation(uint16_t uid) const;
+    /**
+     * Find an Attribute by name in a type id and its parents.
+     * @param [in] uid The id.
+     * @param [in] name The Attribute name.
+     * @param [out] owner The id which registered the Attribute.
+     * @param [out] index The index of the Attribute in \pname{owner}.
+     * @returns \c true if the Attribute was found.
+     */
+    bool FindAttribute(uint16_t uid,
+                       const std::string& name,
+                       uint16_t* owner,
+                       std::size_t* index) const;
+    /**
+     * Find a TraceSource by name in a type id and its parents.
+     * @param [in] uid The id.
+     * @param [in] name The TraceSource name.
+     * @param [out] owner The id which registered the TraceSource.
+     * @param [out] index The index of the TraceSource in \pname{owner}.
+     * @returns \c true if the TraceSource was found.
+     */
+    bool FindTraceSource(uint16_t uid,
+                         const std::string& name,
+                         uint16_t* owner,
+                         std::size_t* index) const;
 
   private:
     /**
@@ -319,6 +375,10 @@ class IidManager : public Singleton<IidManager>
         std::vector<TypeId::AttributeInformation> attributes;
         /** The container of TraceSources. */
         std::vector<TypeId::TraceSourceInformation> traceSources;
+        /** The index of each Attribute in \c attributes, by name. */
+        std::unordered_map<std::string, std::size_t> attributeIndex;
+        /** The index of each TraceSource in \c traceSources, by name. */
+        std::unordered_map<std::string, std::size_t> traceSourceIndex;
         /** Support level/deprecation. */
         TypeId::SupportLevel supportLevel;
         /** Support message. */
@@ -649,32 +709,110 @@ IidManager::GetRegistered(uint16_t i) const
 }
 
 bool
-IidManager::HasAttribute(uint16_t uid, std::string name)
+IidManager::RegisterPending(const std::string& name)
+{
+    NS_LOG_FUNCTION(IID << name);
+    // Classes of different namespaces may have the same name
+    std::vector<TypeId::LazyRegistration*> found;
+    auto link = &g_pendingRegistrations;
+    while (*link != nullptr)
+    {
+        TypeId::LazyRegistration* registration = *link;
+        if (name == registration->name)
+        {
+            *link = registration->next;
+            found.push_back(registration);
+        }
+        else
+        {
+            link = &registration->next;
+        }
+    }
+    g_pendingRegistrationsEnd = link;
+    // Unlinked before running: GetTypeId may look up other TypeIds
+    for (auto registration : found)
+    {
+        registration->registration();
+    }
+    return !found.empty();
+}
+
+uint16_t
+IidManager::LookupUid(const std::string& name)
+{
+    NS_LOG_FUNCTION(IID << name);
+    uint16_t uid = GetUid(name);
+    if (uid != 0)
+    {
+        return uid;
+    }
+    // Most TypeIds are named after their class, in its namespace
+    std::size_t scope = name.rfind("::", name.find('<'));
+    std::string className = (scope == std::string::npos) ? name : name.substr(scope + 2);
+    if (RegisterPending(className))
+    {
+        uid = GetUid(name);
+        if (uid != 0)
+        {
+            return uid;
+        }
+    }
+    RegisterAllPending();
+    return GetUid(name);
+}
+
+void
+IidManager::RegisterAllPending()
+{
+    NS_LOG_FUNCTION(IID);
+    while (g_pendingRegistrations != nullptr)
+    {
+        TypeId::LazyRegistration* registration = g_pendingRegistrations;
+        g_pendingRegistrations = registration->next;
+        if (g_pendingRegistrations == nullptr)
+        {
+            g_pendingRegistrationsEnd = &g_pendingRegistrations;
+        }
+        registration->registration();
+    }
+}
+
+bool
+IidManager::FindAttribute(uint16_t uid,
+                          const std::string& name,
+                          uint16_t* owner,
+                          std::size_t* index) const
 {
     NS_LOG_FUNCTION(IID << uid << name);
-    IidInformation* information = LookupInformation(uid);
     while (true)
     {
-        for (auto i = information->attributes.begin(); i != information->attributes.end(); ++i)
+        IidInformation* information = LookupInformation(uid);
+        auto it = information->attributeIndex.find(name);
+        if (it != information->attributeIndex.end())
         {
-            if (i->name == name)
-            {
-                NS_LOG_LOGIC(IIDL << true);
-                return true;
-            }
+            *owner = uid;
+            *index = it->second;
+            NS_LOG_LOGIC(IIDL << true);
+            return true;
         }
-        IidInformation* parent = LookupInformation(information->parent);
-        if (parent == information)
+        if (information->parent == uid)
         {
             // top of inheritance tree
             NS_LOG_LOGIC(IIDL << false);
             return false;
         }
         // check parent
-        information = parent;
+        uid = information->parent;
     }
-    NS_LOG_LOGIC(IIDL << false);
-    return false;
+}
+
+bool
+IidManager::HasAttribute(uint16_t uid, std::string name)
+{
+    NS_LOG_FUNCTION(IID << uid << name);
+    uint16_t owner;
+    std::size_t index;
+    return FindAttribute(uid, name, &owner, &index);
 }
 
 void
@@ -712,6 +850,7 @@ IidManager::AddAttribute(uint16_t uid,
     info.checker = checker;
     info.supportLevel = supportLevel;
     info.supportMsg = supportMsg;
+    information->attributeIndex[name] = information->attributes.size();
     information->attributes.push_back(info);
     NS_LOG_LOGIC(IIDL << information->attributes.size() - 1);
 }
@@ -748,32 +887,41 @@ IidManager::GetAttribute(uint16_t uid, std::size_t i) const
 }
 
 bool
-IidManager::HasTraceSource(uint16_t uid, std::string name)
+IidManager::FindTraceSource(uint16_t uid,
+                            const std::string& name,
+                            uint16_t* owner,
+                            std::size_t* index) const
 {
     NS_LOG_FUNCTION(IID << uid << name);
-    IidInformation* information = LookupInformation(uid);
     while (true)
     {
-        for (auto i = information->traceSources.begin(); i != information->traceSources.end(); ++i)
+        IidInformation* information = LookupInformation(uid);
+        auto it = information->traceSourceIndex.find(name);
+        if (it != information->traceSourceIndex.end())
         {
-            if (i->name == name)
-            {
-                NS_LOG_LOGIC(IIDL << true);
-                return true;
-            }
+            *owner = uid;
+            *index = it->second;
+            NS_LOG_LOGIC(IIDL << true);
+            return true;
         }
-        IidInformation* parent = LookupInformation(information->parent);
-        if (parent == information)
+        if (information->parent == uid)
         {
             // top of inheritance tree
             NS_LOG_LOGIC(IIDL << false);
             return false;
         }
         // check parent
-        information = parent;
+        uid = information->parent;
     }
-    NS_LOG_LOGIC(IIDL << false);
-    return false;
+}
+
+bool
+IidManager::HasTraceSource(uint16_t uid, std::string name)
+{
+    NS_LOG_FUNCTION(IID << uid << name);
+    uint16_t owner;
+    std::size_t index;
+    return FindTraceSource(uid, name, &owner, &index);
 }
 
 void
@@ -800,6 +948,7 @@ IidManager::AddTraceSource(uint16_t uid,
     source.callback = callback;
     source.supportLevel = supportLevel;
     source.supportMsg = supportMsg;
+    information->traceSourceIndex[name] = information->traceSources.size();
     information->traceSources.push_back(source);
     NS_LOG_LOGIC(IIDL << information->traceSources.size() - 1);
 }
@@ -858,6 +1007,15 @@ TypeId::TypeId(uint16_t tid)
     NS_LOG_FUNCTION(this << tid);
 }
 
+TypeId::LazyRegistration::LazyRegistration(const char* name, void (*registration)())
+    : name(name),
+      registration(registration),
+      next(nullptr)
+{
+    *g_pendingRegistrationsEnd = this;
+    g_pendingRegistrationsEnd = &next;
+}
+
 TypeId
 TypeId::AddDeprecatedName(const std::string& name)
 {
@@ -872,7 +1030,7 @@ TypeId
 TypeId::LookupByName(std::string name)
 {
     NS_LOG_FUNCTION(name);
-    uint16_t uid = IidManager::Get()->GetUid(name);
+    uint16_t uid = IidManager::Get()->LookupUid(name);
     NS_ASSERT_MSG(uid, "Assert in TypeId::LookupByName: " << name << " not found");
     if (IidManager::Get()->GetDeprecatedName(uid) == name)
     {
@@ -886,7 +1044,7 @@ bool
 TypeId::LookupByNameFailSafe(std::string name, TypeId* tid)
 {
     NS_LOG_FUNCTION(name << tid->GetUid());
-    uint16_t uid = IidManager::Get()->GetUid(name);
+    uint16_t uid = IidManager::Get()->LookupUid(name);
     if (uid == 0)
     {
         return false;
@@ -903,6 +1061,7 @@ TypeId::LookupByNameFailSafe(std::string name, TypeId* tid)
 TypeId
 TypeId::LookupByHash(hash_t hash)
 {
+    IidManager::Get()->RegisterAllPending();
     uint16_t uid = IidManager::Get()->GetUid(hash);
     NS_ASSERT_MSG(uid != 0,
                   "Assert in TypeId::LookupByHash: 0x" << std::hex << hash << std::dec
@@ -913,6 +1072,7 @@ TypeId::LookupByHash(hash_t hash)
 bool
 TypeId::LookupByHashFailSafe(hash_t hash, TypeId* tid)
 {
+    IidManager::Get()->RegisterAllPending();
     uint16_t uid = IidManager::Get()->GetUid(hash);
     if (uid == 0)
     {
@@ -926,6 +1086,7 @@ uint16_t
 TypeId::GetRegisteredN()
 {
     NS_LOG_FUNCTION_NOARGS();
+    IidManager::Get()->RegisterAllPending();
     return IidManager::Get()->GetRegisteredN();
 }
 
@@ -939,27 +1100,11 @@ TypeId::GetRegistered(uint16_t i)
 std::tuple<bool, TypeId, TypeId::AttributeInformation>
 TypeId::FindAttribute(const TypeId& tid, const std::string& name)
 {
-    TypeId currentTid = tid;
-    TypeId parentTid;
-    while (true)
+    uint16_t owner;
+    std::size_t index;
+    if (IidManager::Get()->FindAttribute(tid.m_tid, name, &owner, &index))
     {
-        for (std::size_t i = 0; i < currentTid.GetAttributeN(); ++i)
-        {
-            const AttributeInformation& attributeInfo = currentTid.GetAttribute(i);
-            if (attributeInfo.name == name)
-            {
-                return {true, currentTid, attributeInfo};
-            }
-        }
-
-        parentTid = currentTid.GetParent();
-
-        if (parentTid == currentTid)
-        {
-            break;
-        }
-
-        currentTid = parentTid;
+        return {true, TypeId(owner), IidManager::Get()->GetAttribute(owner, index)};
     }
     return {false, TypeId(), AttributeInformation()};
 }
@@ -1068,6 +1213,7 @@ TypeId::GetName() const
 TypeId::hash_t
 TypeId::GetHash() const
 {
+    IidManager::Get()->RegisterAllPending();
     hash_t hash = IidManager::Get()->GetHash(m_tid);
     return hash;
 }
@@ -1229,38 +1375,26 @@ Ptr<const TraceSourceAccessor>
 TypeId::LookupTraceSourceByName(std::string name, TraceSourceInformation* info) const
 {
     NS_LOG_FUNCTION(this << name);
-    TypeId tid;
-    TypeId nextTid = *this;
-    TypeId::TraceSourceInformation tmp;
-    do
+    uint16_t owner;
+    std::size_t index;
+    if (!IidManager::Get()->FindTraceSource(m_tid, name, &owner, &index))
     {
-        tid = nextTid;
-        for (std::size_t i = 0; i < tid.GetTraceSourceN(); i++)
-        {
-            tmp = tid.GetTraceSource(i);
-            if (tmp.name == name)
-            {
-                if (tmp.supportLevel == SupportLevel::SUPPORTED)
-                {
-                    *info = tmp;
-                    return tmp.accessor;
-                }
-                else if (tmp.supportLevel == SupportLevel::DEPRECATED)
-                {
-                    std::cerr << "TraceSource '" << name << "' is deprecated: " << tmp.supportMsg
-                              << std::endl;
-                    *info = tmp;
-                    return tmp.accessor;
-                }
-                else if (tmp.supportLevel == SupportLevel::OBSOLETE)
-                {
-                    NS_FATAL_ERROR("TraceSource '" << name << "' is obsolete, with no fallback: "
-                                                   << tmp.supportMsg);
-                }
-            }
-        }
-        nextTid = tid.GetParent();
-    } while (nextTid != tid);
+        return nullptr;
+    }
+    TypeId::TraceSourceInformation tmp = IidManager::Get()->GetTraceSource(owner, index);
+    if (tmp.supportLevel == SupportLevel::SUPPORTED)
+    {
+        *info = tmp;
+        return tmp.accessor;
+    }
+    else if (tmp.supportLevel == SupportLevel::DEPRECATED)
+    {
+        std::cerr << "TraceSource '" << name << "' is deprecated: " << tmp.supportMsg << std::endl;
+        *info = tmp;
+        return tmp.accessor;
+    }
+    NS_FATAL_ERROR("TraceSource '" << name << "' is obsolete, with no fallback: "
+                                   << tmp.supportMsg);
     return nullptr;
 }
 
@@ -177,6 +177,35 @@ class TypeId
      */
     static TypeId GetRegistered(uint16_t i);
 
+    /**
+     * @brief A TypeId registered on its first lookup.
+     *
+     * NS_OBJECT_ENSURE_REGISTERED() defines one for each class, so that
+     * loading a module does not build the TypeIds of all its classes.  A
+     * TypeId is still built when the GetTypeId method of its class is called,
+     * e.g., by CreateObject(), and the pending registration of a class runs
+     * when LookupByName() is called with its name.  The pending registrations
+     * all run when a name is not found, and before LookupByHash(), GetHash()
+     * and GetRegisteredN(), since the hashes and the indexes of the TypeIds
+     * are only final once all of them are known.
+     */
+    struct LazyRegistration
+    {
+        /**
+         * Add a pending registration.
+         *
+         * This constructor runs during static initialization, and must not log.
+         *
+         * @param [in] name The name of the class, without the ns3:: namespace.
+         * @param [in] registration The function calling GetTypeId.
+         */
+        LazyRegistration(const char* name, void (*registration)());
+
+        const char* name;       //!< The name of the class.
+        void (*registration)(); //!< The function calling GetTypeId.
+        LazyRegistration* next; //!< The next pending registration.
+    };
+
     /**
      * Constructor.
      *
@@ -5,6 +5,7 @@
  */
 
 #include "ns3/callback.h"
+#include "ns3/simple-ref-count.h"
 #include "ns3/test.h"
 
 #include <stdint.h>
@@ -1177,6 +1178,190 @@ MakeCallbackTemplatesTestCase::DoRun()
     that.CheckParentalRights();
 }
 
+/**
+ * @ingroup callback-tests
+ *
+ * Test the callable objects stored inline in the callback implementation.
+ */
+class InlineCallbackTestCase : public TestCase
+{
+  public:
+    InlineCallbackTestCase();
+
+    ~InlineCallbackTestCase() override
+    {
+    }
+
+    /**
+     * Counts the copies of a callable object.
+     */
+    struct CountedFunctor
+    {
+        /**
+         * Constructor.
+         * @param copies The counter of copies.
+         */
+        CountedFunctor(int* copies)
+            : m_copies(copies)
+        {
+        }
+
+        /**
+         * Copy constructor.
+         * @param o The other functor.
+         */
+        CountedFunctor(const CountedFunctor& o)
+            : m_copies(o.m_copies)
+        {
+            ++*m_copies;
+        }
+
+        /**
+         * Function call operator.
+         * @param a The argument.
+         * @return The argument, doubled.
+         */
+        int operator()(int a) const
+        {
+            return 2 * a;
+        }
+
+        int* m_copies; //!< The counter of copies
+    };
+
+    /**
+     * Releases the only callback bound to it from one of its methods.
+     */
+    struct ReleasedObject : public SimpleRefCount<ReleasedObject>
+    {
+        /**
+         * Constructor.
+         * @param holder The callback bound to this object.
+         * @param destroyed Set when this object is destroyed.
+         */
+        ReleasedObject(Callback<bool>* holder, bool* destroyed)
+            : m_holder(holder),
+              m_destroyed(destroyed)
+        {
+        }
+
+        /** Destructor. */
+        ~ReleasedObject()
+        {
+            *m_destroyed = true;
+        }
+
+        /**
+         * Release the callback bound to this object.
+         * @return Whether this object was destroyed during the call.
+         */
+        bool Release()
+        {
+            bool* destroyed = m_destroyed;
+            m_holder->Nullify();
+            return *destroyed;
+        }
+
+        Callback<bool>* m_holder; //!< The callback bound to this object
+        bool* m_destroyed;        //!< Set when this object is destroyed
+    };
+
+  private:
+    void DoRun() override;
+};
+
+/**
+ * Non-member function used to test bound callbacks.
+ *
+ * @param a first argument
+ * @param b second argument
+ * @param c third argument
+ * @return the sum of the arguments
+ */
+int
+InlineCallbackTarget(int a, int b, int c)
+{
+    return a + b + c;
+}
+
+InlineCallbackTestCase::InlineCallbackTestCase()
+    : TestCase("Check callable objects stored inline")
+{
+}
+
+void
+InlineCallbackTestCase::DoRun()
+{
+    //
+    // Make sure that MakeBoundCallback() and Bind() build callbacks which
+    // compare equal, and which do not compare equal to the unbound callback.
+    //
+    Callback<int, int, int, int> target1 = MakeCallback(&InlineCallbackTarget);
+    Callback<int, int> target1a = MakeBoundCallback(&InlineCallbackTarget, 1, 2);
+    Callback<int, int> target1b = target1.Bind(1, 2);
+    Callback<int, int> target1c = target1.Bind(1).Bind(2);
+    NS_TEST_ASSERT_MSG_EQ(target1a.IsEqual(target1b), true, "Equality test failed");
+    NS_TEST_ASSERT_MSG_EQ(target1b.IsEqual(target1a), true, "Equality test failed");
+    NS_TEST_ASSERT_MSG_EQ(target1c.IsEqual(target1a), true, "Equality test failed");
+    NS_TEST_ASSERT_MSG_EQ(target1a(3), 6, "Bound callback returned an unexpected value");
+    NS_TEST_ASSERT_MSG_EQ(target1c(3), 6, "Bound callback returned an unexpected value");
+    Callback<int, int> target1d = MakeBoundCallback(&InlineCallbackTarget, 2, 1);
+    NS_TEST_ASSERT_MSG_EQ(target1d.IsEqual(target1b), false, "Equality test failed");
+    Callback<int, int, int> target1e = MakeBoundCallback(&InlineCallbackTarget, 1);
+    NS_TEST_ASSERT_MSG_EQ(target1e.IsEqual(target1), false, "Equality test failed");
+
+    //
+    // Make sure that a mutable lambda keeps its state across invocations,
+    // and that the copies of a callback share that state.
+    //
+    Callback<int> target2([n = 0]() mutable { return ++n; });
+    NS_TEST_ASSERT_MSG_EQ(target2(), 1, "Mutable lambda returned an unexpected value");
+    NS_TEST_ASSERT_MSG_EQ(target2(), 2, "Mutable lambda returned an unexpected value");
+    Callback<int> target2a = target2;
+    NS_TEST_ASSERT_MSG_EQ(target2a(), 3, "Copy of a mutable lambda lost its state");
+    NS_TEST_ASSERT_MSG_EQ(target2(), 4, "Copy of a mutable lambda did not share its state");
+    Callback<int, int> target2b([sum = 0](int a) mutable { return sum += a; });
+    Callback<int> target2c = target2b.Bind(5);
+    NS_TEST_ASSERT_MSG_EQ(target2c(), 5, "Bound mutable lambda returned an unexpected value");
+    NS_TEST_ASSERT_MSG_EQ(target2c(), 10, "Bound mutable lambda returned an unexpected value");
+    NS_TEST_ASSERT_MSG_EQ(target2b(1), 11, "Bound mutable lambda did not share its state");
+
+    //
+    // Make sure that copying and moving a callback neither copies the
+    // callable object stored inline nor changes its behavior.
+    //
+    int copies = 0;
+    CountedFunctor functor(&copies);
+    Callback<int, int> target3(functor);
+    int stored = copies;
+    NS_TEST_ASSERT_MSG_GT(stored, 0, "The callable object was not stored by copy");
+    Callback<int, int> target3a = target3;
+    Callback<int, int> target3b(std::move(target3a));
+    Callback<int, int> target3c;
+    target3c = target3b;
+    Callback<int, int> target3d;
+    target3d = std::move(target3c);
+    NS_TEST_ASSERT_MSG_EQ(copies, stored, "Copying a callback copied the callable object");
+    NS_TEST_ASSERT_MSG_EQ(target3b(2), 4, "Moved callback returned an unexpected value");
+    NS_TEST_ASSERT_MSG_EQ(target3d(3), 6, "Moved callback returned an unexpected value");
+    NS_TEST_ASSERT_MSG_EQ(target3d.IsEqual(target3), true, "Equality test failed");
+    Callback<int> target3e = target3d.Bind(4);
+    NS_TEST_ASSERT_MSG_EQ(target3e(), 8, "Bound callback returned an unexpected value");
+    NS_TEST_ASSERT_MSG_EQ(copies, stored, "Binding a callback copied the callable object");
+
+    //
+    // Make sure that the bound object outlives a call releasing the
+    // callback, as TCP sockets do when closed from their receive callback.
+    //
+    bool destroyed = false;
+    Callback<bool> target4;
+    target4 = MakeCallback(&ReleasedObject::Release,
+                           Create<ReleasedObject>(&target4, &destroyed));
+    NS_TEST_ASSERT_MSG_EQ(target4(), false, "The bound object was destroyed during the call");
+    NS_TEST_ASSERT_MSG_EQ(target4.IsNull(), true, "The callback was not released");
+    NS_TEST_ASSERT_MSG_EQ(destroyed, true, "The bound object was not destroyed after the call");
+}
+
 /**
  * @ingroup callback-tests
  *
@@ -1197,6 +1382,7 @@ CallbackTestSuite::CallbackTestSuite()
     AddTestCase(new CallbackEqualityTestCase, TestCase::Duration::QUICK);
     AddTestCase(new NullifyCallbackTestCase, TestCase::Duration::QUICK);
     AddTestCase(new MakeCallbackTemplatesTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new InlineCallbackTestCase, TestCase::Duration::QUICK);
 }
 
 static CallbackTestSuite g_gallbackTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,212 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/checkpoint.h"
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+/**
+ * @file
+ * @ingroup core-tests
+ * @ingroup checkpoint
+ * @ingroup checkpoint-tests
+ * Checkpoint test suite.
+ */
+
+/**
+ * @ingroup core-tests
+ * @defgroup checkpoint-tests Checkpoint tests
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * @ingroup checkpoint-tests
+ * A model with a counter and a timer, saved in a checkpoint.
+ */
+class CheckpointTestModel : public Checkpointable
+{
+  public:
+    /** Start the timer. */
+    void Start()
+    {
+        m_event = Simulator::Schedule(Seconds(1), &CheckpointTestModel::Tick, this);
+    }
+
+    /** Count a tick and restart the timer. */
+    void Tick()
+    {
+        m_ticks.push_back(Simulator::Now());
+        Start();
+    }
+
+    void SaveCheckpoint(CheckpointWriter& writer) const override
+    {
+        writer.WriteU32(m_ticks.size());
+        writer.WriteTime(Simulator::Now() + Simulator::GetDelayLeft(m_event));
+    }
+
+    void RestoreCheckpoint(CheckpointReader& reader) override
+    {
+        m_ticks.resize(reader.ReadU32());
+        Time next = reader.ReadTime();
+        m_event = Simulator::Schedule(next - Simulator::Now(), &CheckpointTestModel::Tick, this);
+    }
+
+    std::vector<Time> m_ticks; //!< The tick times.
+    EventId m_event;           //!< The timer.
+};
+
+/**
+ * @ingroup checkpoint-tests
+ * Check the values written by CheckpointWriter are read back.
+ */
+class CheckpointValuesTestCase : public TestCase
+{
+  public:
+    CheckpointValuesTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+CheckpointValuesTestCase::CheckpointValuesTestCase()
+    : TestCase("Checkpoint values are read back")
+{
+}
+
+void
+CheckpointValuesTestCase::DoRun()
+{
+    CheckpointWriter writer;
+    writer.WriteU8(200);
+    writer.WriteU32(0xdeadbeef);
+    writer.WriteU64(0x0123456789abcdef);
+    writer.WriteDouble(-0.125);
+    writer.WriteString("");
+    writer.WriteString("section");
+    writer.WriteTime(NanoSeconds(-7));
+    const uint8_t bytes[] = {1, 2, 3};
+    writer.Write(bytes, sizeof(bytes));
+
+    CheckpointReader reader(writer.GetData());
+    NS_TEST_EXPECT_MSG_EQ(+reader.ReadU8(), 200, "Wrong u8");
+    NS_TEST_EXPECT_MSG_EQ(reader.ReadU32(), 0xdeadbeef, "Wrong u32");
+    NS_TEST_EXPECT_MSG_EQ(reader.ReadU64(), 0x0123456789abcdef, "Wrong u64");
+    NS_TEST_EXPECT_MSG_EQ(reader.ReadDouble(), -0.125, "Wrong double");
+    NS_TEST_EXPECT_MSG_EQ(reader.ReadString(), "", "Wrong empty string");
+    NS_TEST_EXPECT_MSG_EQ(reader.ReadString(), "section", "Wrong string");
+    NS_TEST_EXPECT_MSG_EQ(reader.ReadTime(), NanoSeconds(-7), "Wrong time");
+    uint8_t read[3];
+    reader.Read(read, sizeof(read));
+    NS_TEST_EXPECT_MSG_EQ(+read[2], 3, "Wrong bytes");
+    NS_TEST_EXPECT_MSG_EQ(reader.IsEnd(), true, "Values left");
+}
+
+/**
+ * @ingroup checkpoint-tests
+ * Check that a simulation restored from a checkpoint file continues as the
+ * original one.
+ */
+class CheckpointRestoreTestCase : public TestCase
+{
+  public:
+    CheckpointRestoreTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+CheckpointRestoreTestCase::CheckpointRestoreTestCase()
+    : TestCase("Restored simulation continues as the original one")
+{
+}
+
+void
+CheckpointRestoreTestCase::DoRun()
+{
+    std::string filename = CreateTempDirFilename("test.ckpt");
+
+    // The original simulation, saved at 3.5 s and run until 6.5 s
+    CheckpointTestModel original;
+    Ptr<NormalRandomVariable> originalVariable = CreateObject<NormalRandomVariable>();
+    originalVariable->SetStream(1);
+    originalVariable->GetValue(); // a second value is cached
+    original.Start();
+    Simulator::Stop(Seconds(3.5));
+    Simulator::Run();
+    {
+        Checkpoint checkpoint;
+        checkpoint.Add("model", original);
+        checkpoint.Add("variable", *originalVariable);
+        checkpoint.Save(filename);
+    }
+    Simulator::Stop(Seconds(3));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    // The restored simulation
+    Checkpoint checkpoint = Checkpoint::Load(filename);
+    NS_TEST_EXPECT_MSG_EQ(checkpoint.GetTime(), Seconds(3.5), "Wrong checkpoint time");
+    NS_TEST_EXPECT_MSG_EQ(checkpoint.Has("model"), true, "Missing section");
+    NS_TEST_EXPECT_MSG_EQ(checkpoint.Has("other"), false, "Unexpected section");
+    Simulator::SetStartTime(checkpoint.GetTime());
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), Seconds(3.5), "Wrong start time");
+
+    CheckpointTestModel restored;
+    Ptr<NormalRandomVariable> restoredVariable = CreateObject<NormalRandomVariable>();
+    restoredVariable->SetStream(2);
+    checkpoint.Restore("model", restored);
+    checkpoint.Restore("variable", *restoredVariable);
+    Simulator::Stop(Seconds(3));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_ASSERT_MSG_EQ(restored.m_ticks.size(), original.m_ticks.size(), "Wrong tick count");
+    for (std::size_t i = 3; i < original.m_ticks.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(restored.m_ticks[i], original.m_ticks[i], "Wrong tick " << i);
+    }
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(restoredVariable->GetValue(),
+                              originalVariable->GetValue(),
+                              "Wrong random value " << i);
+    }
+}
+
+/**
+ * @ingroup checkpoint-tests
+ * Checkpoint test suite.
+ */
+class CheckpointTestSuite : public TestSuite
+{
+  public:
+    CheckpointTestSuite();
+};
+
+CheckpointTestSuite::CheckpointTestSuite()
+    : TestSuite("checkpoint", Type::UNIT)
+{
+    AddTestCase(new CheckpointValuesTestCase);
+    AddTestCase(new CheckpointRestoreTestCase);
+}
+
+/**
+ * @ingroup checkpoint-tests
+ * CheckpointTestSuite instance variable.
+ */
+static CheckpointTestSuite g_checkpointTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
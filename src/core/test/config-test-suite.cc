@@ -853,6 +853,81 @@ SearchAttributesOfParentObjectsTestCase::DoRun()
     NS_TEST_ASSERT_MSG_EQ(iv.Get(), 42, "Object Attribute \"X\" not settable in derived class");
 }
 
+/**
+ * @ingroup config-tests
+ * Test the lookup of single indexes in object vectors, and
+ * Config::ConnectEach().
+ */
+class ConnectEachConfigTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    ConnectEachConfigTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+ConnectEachConfigTestCase::ConnectEachConfigTestCase()
+    : TestCase("Check single index lookups and Config::ConnectEach")
+{
+}
+
+void
+ConnectEachConfigTestCase::DoRun()
+{
+    Ptr<ConfigTestObject> root = CreateObject<ConfigTestObject>();
+    Config::RegisterRootNamespaceObject(root);
+    std::vector<Ptr<ConfigTestObject>> objects;
+    for (uint32_t i = 0; i < 4; i++)
+    {
+        objects.push_back(CreateObject<ConfigTestObject>());
+        root->AddNodeB(objects.back());
+    }
+
+    IntegerValue iv;
+    Config::Set("/NodesB/2/A", IntegerValue(3));
+    objects[2]->GetAttribute("A", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), 3, "Object Attribute \"A\" not set through its index");
+    objects[1]->GetAttribute("A", iv);
+    NS_TEST_ASSERT_MSG_EQ(iv.Get(), 10, "Object Attribute \"A\" set on the wrong object");
+    NS_TEST_ASSERT_MSG_EQ(Config::LookupMatches("/NodesB/3").GetN(), 1, "Index not found");
+    NS_TEST_ASSERT_MSG_EQ(Config::LookupMatches("/NodesB/4").GetN(), 0, "Out of range index");
+    NS_TEST_ASSERT_MSG_EQ(Config::LookupMatches("/NodesB/03").GetMatchedPath(0),
+                          "/NodesB/3/",
+                          "Wrong matched path");
+
+    // Connect a sink bound to its index to the objects, except the first one.
+    std::vector<int16_t> values(objects.size(), 0);
+    std::vector<std::string> contexts;
+    auto sink = [&values](std::size_t i, int16_t, int16_t newValue) { values[i] = newValue; };
+    std::size_t connected =
+        Config::ConnectEach("/NodesB/*/Source",
+                            [&](Ptr<Object> object, const std::string& context) -> CallbackBase {
+                                contexts.push_back(context);
+                                if (object == objects[0])
+                                {
+                                    return Callback<void, int16_t, int16_t>();
+                                }
+                                std::size_t i = contexts.size() - 1;
+                                return Callback<void, int16_t, int16_t>(
+                                    [&sink, i](int16_t o, int16_t n) { sink(i, o, n); });
+                            });
+    NS_TEST_ASSERT_MSG_EQ(connected, 3, "Wrong number of connected trace sources");
+    NS_TEST_ASSERT_MSG_EQ(contexts.size(), 4, "Wrong number of matches");
+    NS_TEST_ASSERT_MSG_EQ(contexts[1], "/NodesB/1/Source", "Wrong context");
+
+    for (std::size_t i = 0; i < objects.size(); i++)
+    {
+        objects[i]->SetAttribute("Source", IntegerValue(i + 1));
+    }
+    NS_TEST_ASSERT_MSG_EQ(values[0], 0, "Trace 0 fired unexpectedly");
+    NS_TEST_ASSERT_MSG_EQ(values[1], 2, "Trace 1 did not fire as expected");
+    NS_TEST_ASSERT_MSG_EQ(values[3], 4, "Trace 3 did not fire as expected");
+
+    Config::UnregisterRootNamespaceObject(root);
+}
+
 /**
  * @ingroup config-tests
  * The Test Suite that glues all of the Test Cases together.
@@ -871,6 +946,7 @@ ConfigTestSuite::ConfigTestSuite()
     AddTestCase(new UnderRootNamespaceConfigTestCase);
     AddTestCase(new ObjectVectorConfigTestCase);
     AddTestCase(new SearchAttributesOfParentObjectsTestCase);
+    AddTestCase(new ConnectEachConfigTestCase);
 }
 
 /**
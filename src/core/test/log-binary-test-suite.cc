@@ -0,0 +1,212 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/log.h"
+#include "ns3/nstime.h"
+#include "ns3/object.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+/**
+ * @file
+ * @ingroup core-tests
+ * @ingroup logging
+ * @ingroup logging-tests
+ * Binary log test suite.
+ */
+
+/**
+ * @ingroup core-tests
+ * @defgroup logging-tests Logging tests
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+NS_LOG_COMPONENT_DEFINE("BinaryLogTestSuite");
+
+#undef NS_LOG_APPEND_CONTEXT
+/** Prefix the messages of this file with a context. */
+#define NS_LOG_APPEND_CONTEXT std::clog << "[test] "
+
+/**
+ * @ingroup logging-tests
+ * Check that a binary log is decoded as the messages printed on std::clog.
+ */
+class BinaryLogTestCase : public TestCase
+{
+  public:
+    BinaryLogTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** Log messages with all the kinds of values. */
+    void LogMessages();
+
+    /**
+     * Log the messages at 1.5 s in the context of node 3, then at 2 s
+     * without context.
+     */
+    void Simulate();
+
+    Ptr<Object> m_object; //!< An object logged as a parameter.
+};
+
+BinaryLogTestCase::BinaryLogTestCase()
+    : TestCase("Binary log decodes as the text log")
+{
+}
+
+void
+BinaryLogTestCase::LogMessages()
+{
+    NS_LOG_FUNCTION(this << 7 << "name" << uint8_t(5) << true << -2.5 << std::string("s"));
+    NS_LOG_FUNCTION_NOARGS();
+    NS_LOG_INFO("int " << -3 << " uint " << 4U << " double " << 0.1 << " bool " << false
+                       << " char " << 'c' << " string " << std::string("abc"));
+    NS_LOG_WARN("pointer " << static_cast<void*>(this) << " null "
+                           << static_cast<void*>(nullptr));
+    NS_LOG_DEBUG("time " << Seconds(1) << " after " << 2 << " " << 0.5);
+    NS_LOG_ERROR("hex " << std::hex << 255 << " width " << std::setw(4) << 7 << " "
+                        << std::boolalpha << true);
+
+    NS_LOG_FUNCTION(m_object << Seconds(3) << "after" << 4);
+
+    // Enough messages to fill the buffer several times
+    for (uint32_t i = 0; i < 10000; i++)
+    {
+        NS_LOG_LOGIC("message " << i);
+    }
+}
+
+void
+BinaryLogTestCase::Simulate()
+{
+    Simulator::ScheduleWithContext(3, Seconds(1.5), &BinaryLogTestCase::LogMessages, this);
+    Simulator::Schedule(Seconds(2), &BinaryLogTestCase::LogMessages, this);
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+void
+BinaryLogTestCase::DoRun()
+{
+    LogComponentEnable("BinaryLogTestSuite", LogLevel(LOG_LEVEL_ALL | LOG_PREFIX_ALL));
+    m_object = CreateObject<Object>();
+
+    std::string filename = CreateTempDirFilename("binary-log.bin");
+    BinaryLog::Open(filename);
+    NS_TEST_ASSERT_MSG_EQ(BinaryLog::IsEnabled(), true, "Binary log not open");
+    Simulate();
+    BinaryLog::Close();
+    NS_TEST_ASSERT_MSG_EQ(BinaryLog::IsEnabled(), false, "Binary log not closed");
+
+    std::ifstream is(filename, std::ios::binary);
+    std::ostringstream decoded;
+    NS_TEST_ASSERT_MSG_EQ(BinaryLog::Decode(is, decoded), true, "Malformed binary log");
+
+    // The same messages, printed on std::clog
+    std::ostringstream text;
+    std::streambuf* clog = std::clog.rdbuf(text.rdbuf());
+    Simulate();
+    std::clog.rdbuf(clog);
+    LogComponentDisable("BinaryLogTestSuite", LogLevel(LOG_LEVEL_ALL | LOG_PREFIX_ALL));
+    m_object->Dispose();
+    m_object = nullptr;
+
+    std::istringstream decodedLines(decoded.str());
+    std::istringstream textLines(text.str());
+    std::string decodedLine;
+    std::string textLine;
+    uint32_t lines = 0;
+    while (std::getline(textLines, textLine))
+    {
+        NS_TEST_ASSERT_MSG_EQ(bool(std::getline(decodedLines, decodedLine)),
+                              true,
+                              "Missing line " << lines);
+        NS_TEST_ASSERT_MSG_EQ(decodedLine, textLine, "Wrong line " << lines);
+        lines++;
+    }
+    NS_TEST_EXPECT_MSG_EQ(bool(std::getline(decodedLines, decodedLine)), false, "Extra lines");
+    NS_TEST_EXPECT_MSG_EQ(lines, 2 * 10007, "Wrong number of messages");
+}
+
+/**
+ * @ingroup logging-tests
+ * Check that a truncated binary log is reported.
+ */
+class BinaryLogTruncatedTestCase : public TestCase
+{
+  public:
+    BinaryLogTruncatedTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+BinaryLogTruncatedTestCase::BinaryLogTruncatedTestCase()
+    : TestCase("Truncated binary log")
+{
+}
+
+void
+BinaryLogTruncatedTestCase::DoRun()
+{
+    LogComponentEnable("BinaryLogTestSuite", LOG_LEVEL_INFO);
+    std::string filename = CreateTempDirFilename("truncated-log.bin");
+    BinaryLog::Open(filename);
+    NS_LOG_INFO("first " << 1);
+    NS_LOG_INFO("second " << 2);
+    BinaryLog::Close();
+    LogComponentDisable("BinaryLogTestSuite", LogLevel(LOG_LEVEL_ALL | LOG_PREFIX_ALL));
+
+    std::ifstream is(filename, std::ios::binary);
+    std::string contents((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    std::ostringstream decoded;
+    std::istringstream complete(contents);
+    NS_TEST_ASSERT_MSG_EQ(BinaryLog::Decode(complete, decoded), true, "Malformed binary log");
+    NS_TEST_EXPECT_MSG_EQ(decoded.str(), "[test] first 1\n[test] second 2\n", "Wrong messages");
+
+    std::istringstream truncated(contents.substr(0, contents.size() - 3));
+    NS_TEST_EXPECT_MSG_EQ(BinaryLog::Decode(truncated, decoded), false, "Truncation not detected");
+
+    std::istringstream empty;
+    NS_TEST_EXPECT_MSG_EQ(BinaryLog::Decode(empty, decoded), true, "Empty binary log");
+}
+
+/**
+ * @ingroup logging-tests
+ * Binary log test suite.
+ */
+class BinaryLogTestSuite : public TestSuite
+{
+  public:
+    BinaryLogTestSuite();
+};
+
+BinaryLogTestSuite::BinaryLogTestSuite()
+    : TestSuite("log-binary", Type::UNIT)
+{
+    AddTestCase(new BinaryLogTestCase);
+    AddTestCase(new BinaryLogTruncatedTestCase);
+}
+
+/**
+ * @ingroup logging-tests
+ * BinaryLogTestSuite instance variable.
+ */
+static BinaryLogTestSuite g_binaryLogTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
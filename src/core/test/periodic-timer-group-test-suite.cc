@@ -0,0 +1,254 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/nstime.h"
+#include "ns3/periodic-timer-group.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <memory>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup timer-tests
+ * PeriodicTimerGroup test suite.
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * @ingroup timer-tests
+ * @brief Check the expiration times of the timers of a PeriodicTimerGroup.
+ */
+class PeriodicTimerGroupTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    PeriodicTimerGroupTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Record an expiration.
+     * @param timer The timer index.
+     */
+    void Expire(uint32_t timer);
+
+    /** Add two timers to the group. */
+    void AddTimers();
+
+    PeriodicTimerGroup* m_group;                    //!< The group under test
+    std::vector<PeriodicTimerGroup::TimerId> m_ids; //!< Identifiers of the timers
+    std::vector<std::vector<Time>> m_expirations;   //!< Expiration times of the timers
+};
+
+PeriodicTimerGroupTestCase::PeriodicTimerGroupTestCase()
+    : TestCase("Check the expiration times of the periodic timers")
+{
+}
+
+void
+PeriodicTimerGroupTestCase::Expire(uint32_t timer)
+{
+    m_expirations[timer].push_back(Simulator::Now());
+    if (timer == 1 && m_expirations[timer].size() == 2)
+    {
+        // A timer may remove itself.
+        m_group->Remove(m_ids[timer]);
+    }
+}
+
+void
+PeriodicTimerGroupTestCase::AddTimers()
+{
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        uint32_t timer = m_ids.size();
+        m_ids.push_back(m_group->Add(MakeCallback(&PeriodicTimerGroupTestCase::Expire, this)
+                                         .Bind(timer)));
+        m_expirations.emplace_back();
+    }
+}
+
+void
+PeriodicTimerGroupTestCase::DoRun()
+{
+    // Single bucket: the timers expire at the multiples of the period.
+    auto group = std::make_unique<PeriodicTimerGroup>(Seconds(1));
+    m_group = group.get();
+    Simulator::Schedule(MilliSeconds(300), &PeriodicTimerGroupTestCase::AddTimers, this);
+    Simulator::Schedule(MilliSeconds(1700), &PeriodicTimerGroupTestCase::AddTimers, this);
+    Simulator::Stop(MilliSeconds(4500));
+    uint64_t events = Simulator::GetEventCount();
+    Simulator::Run();
+
+    NS_TEST_ASSERT_MSG_EQ(m_expirations.size(), 4, "Wrong number of timers");
+    NS_TEST_EXPECT_MSG_EQ(m_expirations[0].size(), 4, "Timer 0 expires at 1, 2, 3 and 4 s");
+    NS_TEST_EXPECT_MSG_EQ(m_expirations[0][0], Seconds(1), "Wrong first expiration");
+    NS_TEST_EXPECT_MSG_EQ(m_expirations[0][3], Seconds(4), "Wrong last expiration");
+    NS_TEST_EXPECT_MSG_EQ(m_expirations[1].size(), 2, "Timer 1 removed itself");
+    NS_TEST_EXPECT_MSG_EQ(m_expirations[2].size(), 3, "Timer 2 expires at 2, 3 and 4 s");
+    NS_TEST_EXPECT_MSG_EQ(m_expirations[2][0], Seconds(2), "Wrong first expiration");
+    NS_TEST_EXPECT_MSG_EQ(group->GetN(), 3, "Wrong number of timers");
+    // 2 AddTimers, 4 expirations, and the stop event.
+    NS_TEST_EXPECT_MSG_EQ(Simulator::GetEventCount() - events, 7, "Wrong number of events");
+    group.reset();
+    Simulator::Destroy();
+
+    // Four buckets: the timers expire at the offset of their bucket.
+    m_ids.clear();
+    m_expirations.clear();
+    auto buckets = std::make_unique<PeriodicTimerGroup>(Seconds(1), 4);
+    m_group = buckets.get();
+    Simulator::Schedule(MilliSeconds(300), &PeriodicTimerGroupTestCase::AddTimers, this);
+    Simulator::Schedule(MilliSeconds(600), &PeriodicTimerGroupTestCase::AddTimers, this);
+    Simulator::Stop(MilliSeconds(2500));
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(m_expirations[0].size(), 2, "Timer 0 expires at 1.25 and 2.25 s");
+    NS_TEST_EXPECT_MSG_EQ(m_expirations[0][0], MilliSeconds(1250), "Wrong bucket");
+    NS_TEST_EXPECT_MSG_EQ(m_expirations[2][0], MilliSeconds(1500), "Wrong bucket");
+
+    buckets->Remove(m_ids[0]);
+    buckets->Remove(m_ids[0]);
+    NS_TEST_EXPECT_MSG_EQ(buckets->GetN(), 2, "Wrong number of timers after removal");
+    buckets.reset();
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup timer-tests
+ * @brief Check the shared groups.
+ */
+class PeriodicTimerGroupSharedTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    PeriodicTimerGroupSharedTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+PeriodicTimerGroupSharedTestCase::PeriodicTimerGroupSharedTestCase()
+    : TestCase("Check the shared periodic timer groups")
+{
+}
+
+void
+PeriodicTimerGroupSharedTestCase::DoRun()
+{
+    PeriodicTimerGroup& group = PeriodicTimerGroup::GetShared(Seconds(1));
+    NS_TEST_EXPECT_MSG_EQ(&PeriodicTimerGroup::GetShared(Seconds(1)), &group, "Not shared");
+    NS_TEST_EXPECT_MSG_NE(&PeriodicTimerGroup::GetShared(Seconds(2)), &group, "Wrong period");
+    NS_TEST_EXPECT_MSG_NE(&PeriodicTimerGroup::GetShared(Seconds(1), 2), &group, "Wrong buckets");
+    NS_TEST_EXPECT_MSG_EQ(group.GetPeriod(), Seconds(1), "Wrong period");
+
+    uint32_t count = 0;
+    group.Add(Callback<void>([&count]() { count++; }));
+    Simulator::Stop(Seconds(3));
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(count, 2, "Wrong number of expirations");
+    Simulator::Destroy();
+
+    NS_TEST_EXPECT_MSG_EQ(PeriodicTimerGroup::GetShared(Seconds(1)).GetN(),
+                          0,
+                          "The shared groups must be deleted by Simulator::Destroy()");
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup timer-tests
+ * @brief Check the removal of many timers, which are erased lazily.
+ */
+class PeriodicTimerGroupRemoveTestCase : public TestCase
+{
+  public:
+    /** Constructor. */
+    PeriodicTimerGroupRemoveTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+PeriodicTimerGroupRemoveTestCase::PeriodicTimerGroupRemoveTestCase()
+    : TestCase("Check the removal of many periodic timers")
+{
+}
+
+void
+PeriodicTimerGroupRemoveTestCase::DoRun()
+{
+    PeriodicTimerGroup group(Seconds(1));
+    std::vector<uint32_t> counts(10, 0);
+    std::vector<PeriodicTimerGroup::TimerId> ids;
+    for (uint32_t i = 0; i < counts.size(); i++)
+    {
+        ids.push_back(group.Add(Callback<void>([&counts, i]() { counts[i]++; })));
+    }
+    // Remove the odd timers, then timer 0, which erases the removed timers
+    // once more than half of them are removed.
+    for (uint32_t i = 1; i < ids.size(); i += 2)
+    {
+        group.Remove(ids[i]);
+    }
+    group.Remove(ids[0]);
+    NS_TEST_EXPECT_MSG_EQ(group.GetN(), 4, "Wrong number of timers");
+    // The timers left keep their position after the erasure.
+    group.Remove(ids[4]);
+    NS_TEST_EXPECT_MSG_EQ(group.GetN(), 3, "Wrong number of timers");
+
+    Simulator::Stop(MilliSeconds(1500));
+    Simulator::Run();
+    for (uint32_t i = 0; i < counts.size(); i++)
+    {
+        bool kept = (i == 2 || i == 6 || i == 8);
+        NS_TEST_EXPECT_MSG_EQ(counts[i], kept ? 1 : 0, "Wrong expirations of timer " << i);
+    }
+
+    // A timer added after all the timers are removed expires alone.
+    group.Remove(ids[2]);
+    group.Remove(ids[6]);
+    group.Remove(ids[8]);
+    NS_TEST_EXPECT_MSG_EQ(group.GetN(), 0, "Wrong number of timers");
+    group.Add(Callback<void>([&counts]() { counts[0]++; }));
+    Simulator::Stop(Seconds(2));
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(counts[0], 2, "The new timer expires at 2 and 3 s");
+    NS_TEST_EXPECT_MSG_EQ(counts[2], 1, "A removed timer expired");
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup timer-tests
+ * @brief PeriodicTimerGroup test suite.
+ */
+class PeriodicTimerGroupTestSuite : public TestSuite
+{
+  public:
+    /** Constructor. */
+    PeriodicTimerGroupTestSuite()
+        : TestSuite("periodic-timer-group", Type::UNIT)
+    {
+        AddTestCase(new PeriodicTimerGroupTestCase());
+        AddTestCase(new PeriodicTimerGroupSharedTestCase());
+        AddTestCase(new PeriodicTimerGroupRemoveTestCase());
+    }
+};
+
+/**
+ * @ingroup timer-tests
+ * PeriodicTimerGroupTestSuite instance variable.
+ */
+static PeriodicTimerGroupTestSuite g_periodicTimerGroupTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -0,0 +1,182 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/object-factory.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/rng-stream.h"
+#include "ns3/test.h"
+
+#include <vector>
+
+/**
+ * @file
+ * @ingroup core-tests
+ * @ingroup randomvariable
+ * @ingroup rng-tests
+ * Test for the block draws of the random variable streams.
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * @ingroup rng-tests
+ * Check that RngStream::RandU01(std::span<double>) generates the sequence of
+ * RandU01(), and leaves the stream in the same state.
+ */
+class RngStreamBlockTestCase : public TestCase
+{
+  public:
+    RngStreamBlockTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+RngStreamBlockTestCase::RngStreamBlockTestCase()
+    : TestCase("RngStream block draws match the single draws")
+{
+}
+
+void
+RngStreamBlockTestCase::DoRun()
+{
+    RngStream single(1, 2, 3);
+    RngStream block(1, 2, 3);
+
+    // Blocks of various sizes, including an empty one.
+    for (std::size_t size : {0, 1, 7, 64, 1000})
+    {
+        std::vector<double> values(size);
+        block.RandU01(values);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(values[i],
+                                  single.RandU01(),
+                                  "Value " << i << " of a block of " << size << " differs");
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(block.RandU01(), single.RandU01(), "The stream states differ");
+}
+
+/**
+ * @ingroup rng-tests
+ * Check that RandomVariableStream::GetValues() returns the values of as many
+ * GetValue() calls.
+ */
+class GetValuesTestCase : public TestCase
+{
+  public:
+    GetValuesTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Compare the values of two identical random variables.
+     * @param [in] single The random variable read with GetValue().
+     * @param [in] block The random variable read with GetValues().
+     * @param [in] name The name of the random variable, for the messages.
+     */
+    void Compare(Ptr<RandomVariableStream> single,
+                 Ptr<RandomVariableStream> block,
+                 const std::string& name);
+};
+
+GetValuesTestCase::GetValuesTestCase()
+    : TestCase("GetValues() matches the GetValue() calls")
+{
+}
+
+void
+GetValuesTestCase::Compare(Ptr<RandomVariableStream> single,
+                           Ptr<RandomVariableStream> block,
+                           const std::string& name)
+{
+    single->SetStream(42);
+    block->SetStream(42);
+    std::vector<double> values(100);
+    for (uint32_t round = 0; round < 3; round++)
+    {
+        block->GetValues(values);
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(values[i],
+                                  single->GetValue(),
+                                  name << ": value " << i << " of block " << round << " differs");
+        }
+    }
+    NS_TEST_EXPECT_MSG_EQ(block->GetValue(), single->GetValue(), name << ": the streams differ");
+}
+
+void
+GetValuesTestCase::DoRun()
+{
+    // Specialized implementations.
+    for (bool antithetic : {false, true})
+    {
+        Ptr<UniformRandomVariable> single = CreateObject<UniformRandomVariable>();
+        Ptr<UniformRandomVariable> block = CreateObject<UniformRandomVariable>();
+        for (auto uniform : {single, block})
+        {
+            uniform->SetAttribute("Min", DoubleValue(-3));
+            uniform->SetAttribute("Max", DoubleValue(7));
+            uniform->SetAttribute("Antithetic", BooleanValue(antithetic));
+        }
+        Compare(single, block, antithetic ? "antithetic uniform" : "uniform");
+
+        std::vector<double> values(6);
+        block->GetValues(0, 256, values);
+        for (std::size_t i = 0; i < values.size(); i++)
+        {
+            NS_TEST_ASSERT_MSG_EQ(static_cast<uint32_t>(values[i]),
+                                  single->GetInteger(0, 255),
+                                  "Block of integers differs at " << i);
+        }
+    }
+
+    Ptr<ConstantRandomVariable> constant = CreateObject<ConstantRandomVariable>();
+    constant->SetAttribute("Constant", DoubleValue(5));
+    Compare(constant,
+            CreateObjectWithAttributes<ConstantRandomVariable>("Constant", DoubleValue(5)),
+            "constant");
+
+    // Base implementation.
+    Compare(CreateObject<ExponentialRandomVariable>(),
+            CreateObject<ExponentialRandomVariable>(),
+            "exponential");
+    Compare(CreateObject<NormalRandomVariable>(), CreateObject<NormalRandomVariable>(), "normal");
+}
+
+/**
+ * @ingroup rng-tests
+ * Test suite for the block draws of the random variable streams.
+ */
+class RandomVariableGetValuesTestSuite : public TestSuite
+{
+  public:
+    RandomVariableGetValuesTestSuite();
+};
+
+RandomVariableGetValuesTestSuite::RandomVariableGetValuesTestSuite()
+    : TestSuite("random-variable-get-values", Type::UNIT)
+{
+    AddTestCase(new RngStreamBlockTestCase);
+    AddTestCase(new GetValuesTestCase);
+}
+
+/**
+ * @ingroup rng-tests
+ * RandomVariableGetValuesTestSuite instance variable.
+ */
+static RandomVariableGetValuesTestSuite g_randomVariableGetValuesTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
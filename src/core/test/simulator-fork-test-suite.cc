@@ -0,0 +1,132 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup simulator-tests
+ * Simulator::ForkAt() test suite.
+ */
+
+namespace ns3
+{
+
+namespace tests
+{
+
+/**
+ * @ingroup simulator-tests
+ * Check that the branches forked at some time continue the simulation from
+ * the state reached by the parent.
+ */
+class SimulatorForkTestCase : public TestCase
+{
+  public:
+    SimulatorForkTestCase();
+
+  private:
+    void DoRun() override;
+
+    /** Count a tick every second. */
+    void Tick();
+
+    /**
+     * Run a branch for a number of seconds.
+     * @param [in] i The index of the branch.
+     */
+    void Branch(uint32_t i);
+
+    /**
+     * Report the ticks of a branch.
+     * @param [in] i The index of the branch.
+     * @returns The index of the branch and the number of ticks.
+     */
+    std::string Result(uint32_t i);
+
+    uint32_t m_ticks; //!< The number of ticks.
+};
+
+SimulatorForkTestCase::SimulatorForkTestCase()
+    : TestCase("Branches continue from the fork time")
+{
+}
+
+void
+SimulatorForkTestCase::Tick()
+{
+    m_ticks++;
+    Simulator::Schedule(Seconds(1), &SimulatorForkTestCase::Tick, this);
+}
+
+void
+SimulatorForkTestCase::Branch(uint32_t i)
+{
+    Simulator::Stop(Seconds(i + 1));
+}
+
+std::string
+SimulatorForkTestCase::Result(uint32_t i)
+{
+    return std::to_string(i) + ":" + std::to_string(m_ticks) + "@" +
+           std::to_string(Simulator::Now().GetSeconds());
+}
+
+void
+SimulatorForkTestCase::DoRun()
+{
+    m_ticks = 0;
+    Simulator::Schedule(Seconds(1), &SimulatorForkTestCase::Tick, this);
+    std::vector<std::string> results =
+        Simulator::ForkAt(Seconds(3.5),
+                          3,
+                          MakeCallback(&SimulatorForkTestCase::Branch, this),
+                          MakeCallback(&SimulatorForkTestCase::Result, this));
+
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), Seconds(3.5), "The parent is not at the fork time");
+    NS_TEST_EXPECT_MSG_EQ(m_ticks, 3, "Wrong number of ticks in the parent");
+    NS_TEST_ASSERT_MSG_EQ(results.size(), 3, "Wrong number of results");
+    NS_TEST_EXPECT_MSG_EQ(results[0], "0:4@4.500000", "Wrong result of branch 0");
+    NS_TEST_EXPECT_MSG_EQ(results[1], "1:5@5.500000", "Wrong result of branch 1");
+    NS_TEST_EXPECT_MSG_EQ(results[2], "2:6@6.500000", "Wrong result of branch 2");
+
+    // The parent can continue too
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(m_ticks, 4, "Wrong number of ticks after the fork");
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup simulator-tests
+ * Simulator::ForkAt() test suite.
+ */
+class SimulatorForkTestSuite : public TestSuite
+{
+  public:
+    SimulatorForkTestSuite();
+};
+
+SimulatorForkTestSuite::SimulatorForkTestSuite()
+    : TestSuite("simulator-fork", Type::UNIT)
+{
+#ifndef __WIN32__
+    AddTestCase(new SimulatorForkTestCase);
+#endif
+}
+
+/**
+ * @ingroup simulator-tests
+ * SimulatorForkTestSuite instance variable.
+ */
+static SimulatorForkTestSuite g_simulatorForkTestSuite;
+
+} // namespace tests
+
+} // namespace ns3
@@ -6,12 +6,26 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 #include "ns3/calendar-scheduler.h"
+#include "ns3/boolean.h"
+#include "ns3/dary-heap-scheduler.h"
+#include "ns3/default-simulator-impl.h"
+#include "ns3/event-pool.h"
+#include "ns3/global-value.h"
 #include "ns3/heap-scheduler.h"
+#include "ns3/ladder-scheduler.h"
 #include "ns3/list-scheduler.h"
 #include "ns3/map-scheduler.h"
 #include "ns3/priority-queue-scheduler.h"
+#include "ns3/radix-scheduler.h"
 #include "ns3/simulator.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <array>
+#include <random>
+#include <set>
+#include <thread>
+#include <vector>
 
 using namespace ns3;
 
@@ -651,6 +665,340 @@ SimulatorTemplateTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check the order of the events of a scheduler against a std::set,
+ * with a monotone workload mixing ties, removals and peeks.
+ */
+class SchedulerOrderTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * @param schedulerFactory Scheduler factory.
+     */
+    SchedulerOrderTestCase(ObjectFactory schedulerFactory);
+
+  private:
+    void DoRun() override;
+
+    ObjectFactory m_schedulerFactory; //!< Scheduler factory.
+};
+
+SchedulerOrderTestCase::SchedulerOrderTestCase(ObjectFactory schedulerFactory)
+    : TestCase("Check the event order of " + schedulerFactory.GetTypeId().GetName()),
+      m_schedulerFactory(schedulerFactory)
+{
+}
+
+void
+SchedulerOrderTestCase::DoRun()
+{
+    Ptr<Scheduler> scheduler = m_schedulerFactory.Create<Scheduler>();
+    std::set<Scheduler::Event> reference;
+    // the scheduler never dereferences the implementations
+    auto impl = reinterpret_cast<EventImpl*>(0x1);
+    uint64_t now = 0;
+    uint32_t uid = 0;
+    std::minstd_rand rng(1);
+
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        uint32_t action = rng() % 8;
+        if (action < 4 || reference.empty())
+        {
+            // a few ties, a few far events
+            uint64_t delay = (rng() % 4 == 0) ? 0 : (rng() % 1000) << (rng() % 30);
+            Scheduler::Event ev{impl, {now + delay, uid++, 0}};
+            scheduler->Insert(ev);
+            reference.insert(ev);
+        }
+        else if (action < 7)
+        {
+            NS_TEST_ASSERT_MSG_EQ(scheduler->PeekNext().key.m_uid,
+                                  reference.begin()->key.m_uid,
+                                  "Wrong next event");
+            Scheduler::Event next = scheduler->RemoveNext();
+            NS_TEST_ASSERT_MSG_EQ(next.key.m_uid, reference.begin()->key.m_uid, "Wrong event");
+            now = next.key.m_ts;
+            reference.erase(reference.begin());
+        }
+        else
+        {
+            auto it = reference.begin();
+            std::advance(it, rng() % reference.size());
+            scheduler->Remove(*it);
+            reference.erase(it);
+        }
+        NS_TEST_ASSERT_MSG_EQ(scheduler->IsEmpty(), reference.empty(), "Wrong size");
+    }
+    while (!reference.empty())
+    {
+        Scheduler::Event next = scheduler->RemoveNext();
+        NS_TEST_ASSERT_MSG_EQ(next.key.m_uid, reference.begin()->key.m_uid, "Wrong event");
+        reference.erase(reference.begin());
+    }
+    NS_TEST_EXPECT_MSG_EQ(scheduler->IsEmpty(), true, "Events left in the scheduler");
+}
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check the free lists of the EventPool.
+ */
+class EventPoolTestCase : public TestCase
+{
+  public:
+    EventPoolTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+EventPoolTestCase::EventPoolTestCase()
+    : TestCase("Check the reuse of EventPool blocks")
+{
+}
+
+void
+EventPoolTestCase::DoRun()
+{
+    void* a = EventPool::Allocate(40);
+    NS_TEST_ASSERT_MSG_NE(a, nullptr, "Allocation failed");
+    std::size_t reserved = EventPool::GetReservedBytes();
+    NS_TEST_EXPECT_MSG_GT(reserved, 0, "No chunk has been reserved");
+
+    // Same size class: the last released block is reused.
+    EventPool::Deallocate(a, 40);
+    void* b = EventPool::Allocate(48);
+    NS_TEST_EXPECT_MSG_EQ(b, a, "The released block should be reused");
+
+    // Distinct blocks for live allocations.
+    void* c = EventPool::Allocate(48);
+    NS_TEST_EXPECT_MSG_NE(c, b, "Live blocks must be distinct");
+
+    // Large blocks are not taken from the pool.
+    void* d = EventPool::Allocate(EventPool::MAX_SIZE + 1);
+    NS_TEST_EXPECT_MSG_EQ(EventPool::GetReservedBytes(), reserved, "Large block in the pool");
+    EventPool::Deallocate(d, EventPool::MAX_SIZE + 1);
+
+    EventPool::Deallocate(c, 48);
+    EventPool::Deallocate(b, 48);
+}
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check that the EventPool does not grow when the blocks allocated
+ * by a thread are released by another thread.
+ */
+class EventPoolThreadsTestCase : public TestCase
+{
+  public:
+    EventPoolThreadsTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+EventPoolThreadsTestCase::EventPoolThreadsTestCase()
+    : TestCase("Check the EventPool blocks released by another thread")
+{
+}
+
+void
+EventPoolThreadsTestCase::DoRun()
+{
+    const std::size_t blocks = 1000;
+    const std::size_t size = 48;
+    std::size_t reserved = EventPool::GetReservedBytes();
+    for (uint32_t round = 0; round < 20; round++)
+    {
+        std::vector<void*> allocated;
+        std::thread producer([&allocated, blocks, size]() {
+            for (std::size_t i = 0; i < blocks; i++)
+            {
+                allocated.push_back(EventPool::Allocate(size));
+            }
+        });
+        producer.join();
+        for (auto p : allocated)
+        {
+            EventPool::Deallocate(p, size);
+        }
+    }
+    // The blocks released by this thread are reused by the next producer
+    // threads: the pool holds the live blocks, plus the bounded free lists.
+    NS_TEST_EXPECT_MSG_LT_OR_EQ(EventPool::GetReservedBytes() - reserved,
+                                2 * blocks * size,
+                                "The blocks released by another thread are not reused");
+}
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Run a simulation with the events allocated from the EventPool.
+ *
+ * The \c EventPool global value is read when the first event is allocated,
+ * so this test case is the first of the suite; the pool is not used when
+ * another suite allocated events earlier in the same process.
+ */
+class EventPoolSimulationTestCase : public TestCase
+{
+  public:
+    EventPoolSimulationTestCase();
+
+  private:
+    void DoRun() override;
+    /**
+     * Event which schedules the next one, until the end of the simulation.
+     * @param [in] remaining The number of events still to schedule.
+     * @param [in] payload An argument making the event larger.
+     */
+    void Chain(uint32_t remaining, std::array<uint64_t, 8> payload);
+    /** Event which must have been cancelled. */
+    void Cancelled();
+
+    uint32_t m_executed;  //!< Number of events executed
+    uint32_t m_cancelled; //!< Number of cancelled events executed
+};
+
+EventPoolSimulationTestCase::EventPoolSimulationTestCase()
+    : TestCase("Run a simulation with the events allocated from the EventPool")
+{
+}
+
+void
+EventPoolSimulationTestCase::Chain(uint32_t remaining, std::array<uint64_t, 8> payload)
+{
+    m_executed++;
+    if (remaining == 0)
+    {
+        return;
+    }
+    EventId cancelled = Simulator::Schedule(MicroSeconds(2),
+                                            &EventPoolSimulationTestCase::Cancelled,
+                                            this);
+    Simulator::Schedule(MicroSeconds(1),
+                        &EventPoolSimulationTestCase::Chain,
+                        this,
+                        remaining - 1,
+                        payload);
+    Simulator::Schedule(MicroSeconds(1), [this]() { m_executed++; });
+    cancelled.Cancel();
+}
+
+void
+EventPoolSimulationTestCase::Cancelled()
+{
+    m_cancelled++;
+}
+
+void
+EventPoolSimulationTestCase::DoRun()
+{
+    GlobalValue::Bind("EventPool", BooleanValue(true));
+    bool pooled = EventPool::IsEnabled();
+
+    std::size_t reserved = 0;
+    for (uint32_t run = 0; run < 2; run++)
+    {
+        m_executed = 0;
+        m_cancelled = 0;
+        Simulator::Schedule(Seconds(0),
+                            &EventPoolSimulationTestCase::Chain,
+                            this,
+                            1000,
+                            std::array<uint64_t, 8>{});
+        Simulator::Run();
+        Simulator::Destroy();
+        NS_TEST_EXPECT_MSG_EQ(m_executed, 1 + 2 * 1000, "Wrong number of executed events");
+        NS_TEST_EXPECT_MSG_EQ(m_cancelled, 0, "Cancelled event executed");
+        if (pooled && run == 0)
+        {
+            reserved = EventPool::GetReservedBytes();
+            NS_TEST_EXPECT_MSG_GT(reserved, 0, "The events were not taken from the pool");
+        }
+    }
+    if (pooled)
+    {
+        NS_TEST_EXPECT_MSG_EQ(EventPool::GetReservedBytes(),
+                              reserved,
+                              "The events of the second run did not reuse the pool");
+    }
+}
+
+/**
+ * @ingroup simulator-tests
+ *
+ * @brief Check the counts of the EventProfiler.
+ */
+class EventProfilerTestCase : public TestCase
+{
+  public:
+    EventProfilerTestCase();
+
+  private:
+    void DoRun() override;
+    /** Event counted by the profiler. */
+    void Frequent();
+    /**
+     * Event counted by the profiler.
+     * @param [in] value Unused argument, which makes the event type distinct.
+     */
+    void Rare(int value);
+};
+
+EventProfilerTestCase::EventProfilerTestCase()
+    : TestCase("Check the counts of the event profiler")
+{
+}
+
+void
+EventProfilerTestCase::Frequent()
+{
+}
+
+void
+EventProfilerTestCase::Rare(int /* value */)
+{
+}
+
+void
+EventProfilerTestCase::DoRun()
+{
+    auto impl = DynamicCast<DefaultSimulatorImpl>(Simulator::GetImplementation());
+    NS_TEST_ASSERT_MSG_NE(impl, nullptr, "Wrong simulator implementation");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetEventProfiler(), nullptr, "Profiler enabled by default");
+    impl->SetAttribute("EventProfile", BooleanValue(true));
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        Simulator::ScheduleWithContext(7, Seconds(i), &EventProfilerTestCase::Frequent, this);
+    }
+    Simulator::ScheduleWithContext(2, Seconds(1), &EventProfilerTestCase::Rare, this, 0);
+    Simulator::Run();
+
+    const EventProfiler* profiler = impl->GetEventProfiler();
+    NS_TEST_ASSERT_MSG_NE(profiler, nullptr, "Profiler not enabled");
+    auto functions = profiler->GetFunctions();
+    NS_TEST_ASSERT_MSG_EQ(functions.size(), 2, "Wrong number of event functions");
+    NS_TEST_EXPECT_MSG_EQ(functions[0].count, 3, "Wrong count of the frequent event");
+    NS_TEST_EXPECT_MSG_EQ(functions[1].count, 1, "Wrong count of the rare event");
+    NS_TEST_EXPECT_MSG_NE(functions[1].name.find("int"),
+                          std::string::npos,
+                          "The name should hold the signature: " << functions[1].name);
+    auto contexts = profiler->GetContexts();
+    NS_TEST_ASSERT_MSG_EQ(contexts.size(), 2, "Wrong number of contexts");
+    NS_TEST_EXPECT_MSG_EQ(contexts[0].name, "7", "Wrong most frequent context");
+    NS_TEST_EXPECT_MSG_EQ(contexts[0].count, 3, "Wrong count of context 7");
+
+    // No report on the test output.
+    impl->SetAttribute("EventProfile", BooleanValue(false));
+    Simulator::Destroy();
+}
+
 /**
  * @ingroup simulator-tests
  *
@@ -662,6 +1010,8 @@ class SimulatorTestSuite : public TestSuite
     SimulatorTestSuite()
         : TestSuite("simulator")
     {
+        AddTestCase(new EventPoolSimulationTestCase(), TestCase::Duration::QUICK);
+
         ObjectFactory factory;
         factory.SetTypeId(ListScheduler::GetTypeId());
 
@@ -674,6 +1024,29 @@ class SimulatorTestSuite : public TestSuite
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
         factory.SetTypeId(PriorityQueueScheduler::GetTypeId());
         AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        factory.SetTypeId(DaryHeapScheduler::GetTypeId());
+        AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        factory.Set("Arity", UintegerValue(2));
+        AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        factory = ObjectFactory();
+        factory.SetTypeId(RadixScheduler::GetTypeId());
+        AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+        factory.SetTypeId(LadderScheduler::GetTypeId());
+        AddTestCase(new SimulatorEventsTestCase(factory), TestCase::Duration::QUICK);
+
+        for (auto tid : {MapScheduler::GetTypeId(),
+                         HeapScheduler::GetTypeId(),
+                         CalendarScheduler::GetTypeId(),
+                         DaryHeapScheduler::GetTypeId(),
+                         RadixScheduler::GetTypeId(),
+                         LadderScheduler::GetTypeId()})
+        {
+            AddTestCase(new SchedulerOrderTestCase(ObjectFactory(tid.GetName())),
+                        TestCase::Duration::QUICK);
+        }
+        AddTestCase(new EventPoolTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new EventPoolThreadsTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new EventProfilerTestCase(), TestCase::Duration::QUICK);
     }
 };
 
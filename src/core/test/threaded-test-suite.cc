@@ -19,6 +19,7 @@
 #include <list>
 #include <thread> // sleep_for
 #include <utility>
+#include <vector>
 
 using namespace ns3;
 
@@ -267,6 +268,98 @@ ThreadedSimulatorEventsTestCase::DoRun()
     NS_TEST_EXPECT_MSG_EQ(m_a, m_d, "Bad scheduling");
 }
 
+/**
+ * @ingroup threaded-tests
+ *
+ * @brief Check that the events scheduled by each thread with
+ * DefaultSimulatorImpl keep their order, even when they do not fit in the
+ * lock-free ring.
+ */
+class ThreadedSimulatorOrderTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     *
+     * @param threads The number of threads.
+     * @param events The number of events per thread.
+     */
+    ThreadedSimulatorOrderTestCase(unsigned int threads, uint32_t events);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Record an event.
+     * @param thread The thread which scheduled the event.
+     * @param seq The sequence number of the event in the thread.
+     */
+    void Record(unsigned int thread, uint32_t seq);
+
+    unsigned int m_threads;       //!< The number of threads.
+    uint32_t m_events;            //!< The number of events per thread.
+    std::vector<uint32_t> m_next; //!< The next sequence number expected from each thread.
+    uint32_t m_outOfOrder;        //!< The number of events out of order.
+};
+
+ThreadedSimulatorOrderTestCase::ThreadedSimulatorOrderTestCase(unsigned int threads,
+                                                               uint32_t events)
+    : TestCase("Check the order of " + std::to_string(events) + " events from " +
+               std::to_string(threads) + " threads"),
+      m_threads(threads),
+      m_events(events),
+      m_outOfOrder(0)
+{
+}
+
+void
+ThreadedSimulatorOrderTestCase::Record(unsigned int thread, uint32_t seq)
+{
+    if (m_next[thread] != seq)
+    {
+        m_outOfOrder++;
+    }
+    m_next[thread] = seq + 1;
+}
+
+void
+ThreadedSimulatorOrderTestCase::DoRun()
+{
+    m_next.assign(m_threads, 0);
+    m_outOfOrder = 0;
+    // Create the simulator in the main thread.
+    Simulator::Now();
+
+    std::list<std::thread> threads;
+    for (unsigned int i = 0; i < m_threads; ++i)
+    {
+        threads.emplace_back([this, i]() {
+            for (uint32_t seq = 0; seq < m_events; seq++)
+            {
+                Simulator::ScheduleWithContext(i,
+                                               Time(0),
+                                               &ThreadedSimulatorOrderTestCase::Record,
+                                               this,
+                                               i,
+                                               seq);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    Simulator::Run();
+    Simulator::Destroy();
+
+    NS_TEST_EXPECT_MSG_EQ(m_outOfOrder, 0, "Events out of order");
+    for (unsigned int i = 0; i < m_threads; ++i)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_next[i], m_events, "Events lost");
+    }
+}
+
 /**
  * @ingroup threaded-tests
  *
@@ -304,6 +397,9 @@ class ThreadedSimulatorTestSuite : public TestSuite
                 }
             }
         }
+
+        // More events than the slots of the ring of DefaultSimulatorImpl
+        AddTestCase(new ThreadedSimulatorOrderTestCase(4, 5000), TestCase::Duration::QUICK);
     }
 };
 
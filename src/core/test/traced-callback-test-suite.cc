@@ -7,6 +7,9 @@
 #include "ns3/test.h"
 #include "ns3/traced-callback.h"
 
+#include <memory>
+#include <vector>
+
 using namespace ns3;
 
 /**
@@ -122,6 +125,191 @@ BasicTracedCallbackTestCase::DoRun()
     NS_TEST_ASSERT_MSG_EQ(m_two, true, "Callback CbTwo not called");
 }
 
+/**
+ * @ingroup tracedcallback-tests
+ *
+ * TracedCallback Test case, check the NS_TRACE() macro and the changes of
+ * the chain of Callbacks from a Callback.
+ */
+class FastPathTracedCallbackTestCase : public TestCase
+{
+  public:
+    FastPathTracedCallbackTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+FastPathTracedCallbackTestCase::FastPathTracedCallbackTestCase()
+    : TestCase("Check the TracedCallback fast path and reentrant sinks")
+{
+}
+
+void
+FastPathTracedCallbackTestCase::DoRun()
+{
+    TracedCallback<int> trace;
+    int evaluations = 0;
+    auto argument = [&evaluations]() {
+        evaluations++;
+        return 1;
+    };
+
+    // Without a sink, the arguments are not evaluated.
+    NS_TRACE(trace, argument());
+    NS_TEST_ASSERT_MSG_EQ(evaluations, 0, "Arguments evaluated without a sink");
+
+    int total = 0;
+    trace.ConnectWithoutContext(Callback<void, int>([&total](int value) { total += value; }));
+    NS_TRACE(trace, argument());
+    NS_TEST_ASSERT_MSG_EQ(evaluations, 1, "Arguments not evaluated");
+    NS_TEST_ASSERT_MSG_EQ(total, 1, "Sink not invoked");
+
+    // A sink which connects many other sinks, reallocating the chain.
+    Callback<void, int> other([&total](int value) { total += 10 * value; });
+    Callback<void, int> connect([&trace, &other](int) {
+        for (int i = 0; i < 100; i++)
+        {
+            trace.ConnectWithoutContext(other);
+        }
+    });
+    trace.ConnectWithoutContext(connect);
+    total = 0;
+    trace(1);
+    NS_TEST_ASSERT_MSG_EQ(total, 1001, "Sinks connected by a sink not invoked");
+    trace.DisconnectWithoutContext(connect);
+
+    // A sink which disconnects the other sinks.
+    trace.ConnectWithoutContext(
+        Callback<void, int>([&trace, &other](int) { trace.DisconnectWithoutContext(other); }));
+    total = 0;
+    trace(1);
+    NS_TEST_ASSERT_MSG_EQ(total, 1001, "Sinks not invoked");
+    total = 0;
+    trace(1);
+    NS_TEST_ASSERT_MSG_EQ(total, 1, "Sinks disconnected by a sink invoked");
+
+    // A sink in the middle of the chain which disconnects itself: the next
+    // sink must still be invoked.
+    TracedCallback<int> chain;
+    int first = 0;
+    int middle = 0;
+    int last = 0;
+    Callback<void, int> self;
+    self = Callback<void, int>([&chain, &middle, &self](int) {
+        middle++;
+        chain.DisconnectWithoutContext(self);
+    });
+    chain.ConnectWithoutContext(Callback<void, int>([&first](int) { first++; }));
+    chain.ConnectWithoutContext(self);
+    chain.ConnectWithoutContext(Callback<void, int>([&last](int) { last++; }));
+    chain(1);
+    NS_TEST_ASSERT_MSG_EQ(first, 1, "First sink not invoked");
+    NS_TEST_ASSERT_MSG_EQ(middle, 1, "Middle sink not invoked");
+    NS_TEST_ASSERT_MSG_EQ(last, 1, "Sink after a disconnected sink skipped");
+    chain(1);
+    NS_TEST_ASSERT_MSG_EQ(first, 2, "First sink not invoked");
+    NS_TEST_ASSERT_MSG_EQ(middle, 1, "Disconnected sink invoked");
+    NS_TEST_ASSERT_MSG_EQ(last, 2, "Last sink not invoked");
+    self = Callback<void, int>();
+}
+
+/**
+ * @ingroup tracedcallback-tests
+ *
+ * TracedCallback Test case, check the batched sinks.
+ */
+class BatchedTracedCallbackTestCase : public TestCase
+{
+  public:
+    BatchedTracedCallbackTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Batched sink.
+     * @param records The records.
+     */
+    void Sink(const std::vector<std::tuple<uint32_t, double>>& records);
+
+    std::vector<std::size_t> m_batches; //!< Number of records of each batch
+    uint32_t m_sum;                     //!< Sum of the first fields of the records
+};
+
+BatchedTracedCallbackTestCase::BatchedTracedCallbackTestCase()
+    : TestCase("Check the TracedCallback batched sinks")
+{
+}
+
+void
+BatchedTracedCallbackTestCase::Sink(const std::vector<std::tuple<uint32_t, double>>& records)
+{
+    m_batches.push_back(records.size());
+    for (const auto& record : records)
+    {
+        m_sum += std::get<0>(record);
+    }
+}
+
+void
+BatchedTracedCallbackTestCase::DoRun()
+{
+    m_sum = 0;
+    auto trace = std::make_unique<TracedCallback<uint32_t, double>>();
+    trace->ConnectBatched(MakeCallback(&BatchedTracedCallbackTestCase::Sink, this), 4);
+    NS_TEST_ASSERT_MSG_EQ(trace->IsEmpty(), false, "A batched sink is connected");
+
+    for (uint32_t i = 1; i <= 10; i++)
+    {
+        (*trace)(i, 0.5);
+    }
+    NS_TEST_ASSERT_MSG_EQ(m_batches.size(), 2, "Wrong number of batches");
+    NS_TEST_ASSERT_MSG_EQ(m_sum, 1 + 2 + 3 + 4 + 5 + 6 + 7 + 8, "Wrong records");
+
+    trace->Flush();
+    NS_TEST_ASSERT_MSG_EQ(m_batches.size(), 3, "Records not flushed");
+    NS_TEST_ASSERT_MSG_EQ(m_batches.back(), 2, "Wrong number of flushed records");
+    NS_TEST_ASSERT_MSG_EQ(m_sum, 55, "Wrong flushed records");
+    trace->Flush();
+    NS_TEST_ASSERT_MSG_EQ(m_batches.size(), 3, "Empty batch delivered");
+
+    // The records are delivered when the TracedCallback is destroyed.
+    (*trace)(100, 0.5);
+    trace.reset();
+    NS_TEST_ASSERT_MSG_EQ(m_batches.size(), 4, "Records not delivered by the destructor");
+    NS_TEST_ASSERT_MSG_EQ(m_sum, 155, "Wrong delivered records");
+
+    // The records are delivered when the sink is disconnected.
+    TracedCallback<uint32_t, double> other;
+    other.ConnectBatched(MakeCallback(&BatchedTracedCallbackTestCase::Sink, this), 4);
+    other(1, 0.5);
+    other.DisconnectBatched(MakeCallback(&BatchedTracedCallbackTestCase::Sink, this));
+    NS_TEST_ASSERT_MSG_EQ(m_batches.size(), 5, "Records not delivered by the disconnection");
+    NS_TEST_ASSERT_MSG_EQ(other.IsEmpty(), true, "Batched sink not disconnected");
+    other(1, 0.5);
+    NS_TEST_ASSERT_MSG_EQ(m_sum, 156, "Record delivered after the disconnection");
+
+    // A copy gets the sinks, but not the buffered records, which are
+    // delivered once.
+    auto original = std::make_unique<TracedCallback<uint32_t, double>>();
+    original->ConnectBatched(MakeCallback(&BatchedTracedCallbackTestCase::Sink, this), 4);
+    (*original)(1000, 0.5);
+    auto copy = std::make_unique<TracedCallback<uint32_t, double>>(*original);
+    TracedCallback<uint32_t, double> assigned;
+    assigned = *original;
+    copy.reset();
+    assigned.Flush();
+    NS_TEST_ASSERT_MSG_EQ(m_batches.size(), 5, "Records of the original delivered by a copy");
+    original.reset();
+    NS_TEST_ASSERT_MSG_EQ(m_batches.size(), 6, "Records not delivered by the original");
+    NS_TEST_ASSERT_MSG_EQ(m_sum, 1156, "Records delivered twice");
+    assigned(2000, 0.5);
+    assigned.Flush();
+    NS_TEST_ASSERT_MSG_EQ(m_batches.size(), 7, "Sink not copied");
+    NS_TEST_ASSERT_MSG_EQ(m_sum, 3156, "Wrong records of the copy");
+}
+
 /**
  * @ingroup tracedcallback-tests
  *
@@ -137,6 +325,8 @@ TracedCallbackTestSuite::TracedCallbackTestSuite()
     : TestSuite("traced-callback", Type::UNIT)
 {
     AddTestCase(new BasicTracedCallbackTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new FastPathTracedCallbackTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new BatchedTracedCallbackTestCase, TestCase::Duration::QUICK);
 }
 
 static TracedCallbackTestSuite
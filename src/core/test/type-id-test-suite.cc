@@ -336,6 +336,114 @@ DeprecatedAttributeTestCase::DoRun()
               << std::endl;
 }
 
+/**
+ * @ingroup typeid-tests
+ *
+ * Class whose TypeId is named after the class, in a namespace.
+ */
+class LazyNamedObject : public Object
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::tests::LazyNamedObject").SetParent<Object>();
+        return tid;
+    }
+};
+
+NS_OBJECT_ENSURE_REGISTERED(LazyNamedObject);
+
+/**
+ * @ingroup typeid-tests
+ *
+ * Class whose TypeId is named differently from the class.
+ */
+class LazyRenamedObject : public Object
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid = TypeId("LazyRegistration:Renamed").SetParent<Object>();
+        return tid;
+    }
+};
+
+NS_OBJECT_ENSURE_REGISTERED(LazyRenamedObject);
+
+/**
+ * @ingroup typeid-tests
+ *
+ * Class only looked up by hash.
+ */
+class LazyHashedObject : public Object
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return The object TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::tests::LazyHashedObject").SetParent<Object>();
+        return tid;
+    }
+};
+
+NS_OBJECT_ENSURE_REGISTERED(LazyHashedObject);
+
+/**
+ * @ingroup typeid-tests
+ *
+ * Check that the TypeIds registered on their first lookup are found.
+ */
+class LazyRegistrationTestCase : public TestCase
+{
+  public:
+    LazyRegistrationTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+LazyRegistrationTestCase::LazyRegistrationTestCase()
+    : TestCase("Check lookups of TypeIds registered lazily")
+{
+}
+
+void
+LazyRegistrationTestCase::DoRun()
+{
+    // The registration sets the size of the class
+    TypeId tid = TypeId::LookupByName("ns3::tests::LazyNamedObject");
+    NS_TEST_ASSERT_MSG_EQ(tid, LazyNamedObject::GetTypeId(), "Wrong TypeId found by name");
+    NS_TEST_EXPECT_MSG_EQ(tid.GetSize(), sizeof(LazyNamedObject), "Registration not run");
+
+    // Not named after its class: all the pending registrations run
+    NS_TEST_ASSERT_MSG_EQ(TypeId::LookupByNameFailSafe("LazyRegistration:Renamed", &tid),
+                          true,
+                          "Renamed TypeId not found");
+    NS_TEST_EXPECT_MSG_EQ(tid.GetSize(), sizeof(LazyRenamedObject), "Registration not run");
+
+    // Mask off the hash chaining flag, assuming no other TypeId has this hash
+    ns3::Hasher hasher = ns3::Hasher(Create<Hash::Function::Murmur3>());
+    uint32_t hash = hasher.GetHash32("ns3::tests::LazyHashedObject") & (~0x80000000);
+    NS_TEST_ASSERT_MSG_EQ(TypeId::LookupByHashFailSafe(hash, &tid), true, "Hash not found");
+    NS_TEST_EXPECT_MSG_EQ(tid.GetName(), "ns3::tests::LazyHashedObject", "Wrong TypeId by hash");
+    NS_TEST_EXPECT_MSG_EQ(tid.GetSize(), sizeof(LazyHashedObject), "Registration not run");
+
+    NS_TEST_EXPECT_MSG_EQ(TypeId::LookupByNameFailSafe("ns3::tests::LazyMissingObject", &tid),
+                          false,
+                          "Unknown TypeId found");
+}
+
 /**
  * @ingroup typeid-tests
  *
@@ -441,6 +549,9 @@ TypeIdTestSuite::TypeIdTestSuite()
     // Turn on logging, so we see the result of collisions
     LogComponentEnable("TypeId", ns3::LogLevel(LOG_ERROR | LOG_PREFIX_FUNC));
 
+    // The LazyRegistrationTestCase looks up TypeIds before
+    // the UniqueIdTestCase registers all of them.
+    AddTestCase(new LazyRegistrationTestCase, Duration::QUICK);
     // If the CollisionTestCase is performed before the
     // UniqueIdTestCase, the artificial collisions added by
     // CollisionTestCase will show up in the list of TypeIds
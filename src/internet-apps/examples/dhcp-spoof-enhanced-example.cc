@@ -6,7 +6,9 @@
 #include "ns3/csma-module.h"
 #include "ns3/rogue-dhcp-helper.h"
 #include "ns3/dhcp-starvation-helper.h"
+#include "ns3/reachability-prober-helper.h"
 #include <fstream>
+#include <set>
 #include <sstream>
 
 using namespace ns3;
@@ -80,6 +82,23 @@ void LeaseObtained (std::string context, const Ipv4Address& leasedAddress)
   g_leaseObtained = true;
 }
 
+// Probe every leased address from the legitimate server node
+std::set<Ipv4Address> g_probedAddresses;
+
+void AddProbeTarget (Ptr<ReachabilityProber> prober, const Ipv4Address& leasedAddress)
+{
+  if (g_probedAddresses.insert (leasedAddress).second)
+    {
+      prober->AddTarget (leasedAddress);
+    }
+}
+
+void ReachabilityChanged (uint32_t reachable, uint32_t total)
+{
+  NS_LOG_INFO ("[" << Simulator::Now().As(Time::S) << "] reachable clients: "
+                   << reachable << "/" << total);
+}
+
 void LeaseExpired (std::string context, const Ipv4Address& expiredAddress)
 {
   NS_LOG_INFO ("[" << Simulator::Now().As(Time::S) << "] " 
@@ -184,6 +203,8 @@ main (int argc, char *argv[])
   uint32_t starvationInterval = 10; // Default starvation interval in milliseconds
   bool logEnabled = false;
   bool pcapEnabled = true; // Default to enable PCAP generation
+  bool probeReachability = false; // Probe leased addresses from the legitimate server
+  std::string logBinary = ""; // Binary log file, decoded with print-binary-log
   
   CommandLine cmd;
   cmd.AddValue ("nClients", "Number of clients to simulate", nClients);
@@ -192,7 +213,9 @@ main (int argc, char *argv[])
   cmd.AddValue ("clientStartInterval", "Interval between client start times (seconds)", clientStartInterval);
   cmd.AddValue ("starvInterval", "Starvation attack interval (milliseconds)", starvationInterval);
   cmd.AddValue ("logEnabled", "Enable logging to file", logEnabled);
+  cmd.AddValue ("logBinary", "Write the logs to this binary log instead of std::clog", logBinary);
   cmd.AddValue ("pcapEnabled", "Enable PCAP file generation", pcapEnabled);
+  cmd.AddValue ("probeReachability", "Probe the leased addresses from the legitimate server", probeReachability);
   cmd.Parse (argc, argv);
 
   // Calculate the max address based on number of addresses
@@ -272,6 +295,19 @@ main (int argc, char *argv[])
   rogueHelper.SetAttribute ("StarvationLease", TimeValue (Seconds (5))); // Short lease for starvation attacks
   rogueHelper.Install (rogue);
 
+  // Single prober on the legitimate server node; targets are added as leases are obtained
+  Ptr<ReachabilityProber> prober;
+  if (probeReachability)
+    {
+      ReachabilityProberHelper proberHelper;
+      proberHelper.SetAttribute ("Interval", TimeValue (MilliSeconds (500)));
+      proberHelper.SetAttribute ("Timeout", TimeValue (MilliSeconds (500)));
+      ApplicationContainer proberApps = proberHelper.Install (legit);
+      proberApps.Start (Seconds (0.5));
+      prober = DynamicCast<ReachabilityProber> (proberApps.Get (0));
+      prober->TraceConnectWithoutContext ("Reachability", MakeCallback (&ReachabilityChanged));
+    }
+
   // Create nClients legitimate clients (start at different times to see different outcomes)
   std::vector<DhcpHelper> clientHelpers(nClients);
   std::vector<ApplicationContainer> clientApps(nClients);
@@ -289,10 +325,18 @@ main (int argc, char *argv[])
       // Connect tracing callbacks to monitor lease assignments for each client
       std::string clientName = "Client" + std::to_string(i + 1);
       clientApps[i].Get (0)->TraceConnect ("NewLease", clientName, MakeCallback (&LeaseObtained));
+      if (prober)
+        {
+          clientApps[i].Get (0)->TraceConnectWithoutContext ("NewLease", MakeBoundCallback (&AddProbeTarget, prober));
+        }
     }
 
   if (logEnabled)
   {
+    if (!logBinary.empty ())
+    {
+      BinaryLog::Open (logBinary);
+    }
     LogComponentEnable ("DhcpSpoofEnhancedExample", LOG_LEVEL_INFO);
     LogComponentEnable ("DhcpStarvationClient",   LOG_LEVEL_INFO);
     LogComponentEnable ("RogueDhcpServer",       LOG_LEVEL_INFO);
@@ -417,6 +461,11 @@ main (int argc, char *argv[])
   NS_LOG_INFO ("✅ Legitimate addresses: " << legitimateCount << "/" << nClients);
   NS_LOG_INFO ("🎯 Rogue addresses: " << rogueCount << "/" << nClients);
   NS_LOG_INFO ("❌ No addresses: " << noAddressCount << "/" << nClients);
+  if (prober)
+    {
+      NS_LOG_INFO ("📡 Reachable from legitimate server: " << prober->GetNReachable ()
+                   << "/" << prober->GetNTargets () << " leased addresses");
+    }
   
   if (rogueCount > legitimateCount)
     {
@@ -435,6 +484,7 @@ main (int argc, char *argv[])
     }
   
   Simulator::Destroy ();
+  BinaryLog::Close ();
 
   // Append results to CSV file
   AppendToCSV(nClients, nAddr, starvationStopTime, clientStartInterval, starvationInterval, 
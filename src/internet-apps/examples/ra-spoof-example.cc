@@ -0,0 +1,263 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// Rogue IPv6 router attack, and RA guard mitigation.
+//
+// Network topology: every node is connected to a port of a switch (a bridge).
+//
+//   router    rogue    client 1 ... client n
+//     |         |         |            |
+//   +-------------------------------------+
+//   |         switch (BridgeNetDevice)    |
+//   +-------------------------------------+
+//
+// - The legitimate router advertises 2001:db8:1::/64 with Radvd.
+// - The rogue router advertises 2001:db8:bad::/64 (or a different prefix in
+//   each advertisement, with --prefixFlood) every --raInterval milliseconds,
+//   starting at --rogueStart seconds.
+// - With --raGuard, the switch drops the Router Advertisements that are not
+//   received on the router port.
+//
+// At the end of the simulation, the clients with an address in a rogue prefix
+// and the clients with a default route through the rogue router are counted,
+// and a line is appended to ra-spoof-results.csv (see run_ra_experiments.py).
+
+#include "ns3/bridge-module.h"
+#include "ns3/core-module.h"
+#include "ns3/csma-module.h"
+#include "ns3/internet-apps-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/network-module.h"
+
+#include <fstream>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE("RaSpoofExample");
+
+/// Name of the CSV file the results are appended to
+static const std::string g_csvFileName = "ra-spoof-results.csv";
+
+/**
+ * Append the results of a run to the CSV file, creating the file with a header if needed.
+ *
+ * @param nClients Number of clients
+ * @param raInterval Interval between two rogue RAs (milliseconds)
+ * @param rogueStart Start time of the rogue router (seconds)
+ * @param prefixFlood True if the rogue router advertises a different prefix each time
+ * @param raGuard True if the RA guard is enabled
+ * @param rogueAddressCount Number of clients with an address in a rogue prefix
+ * @param rogueRouteCount Number of clients with a default route through the rogue router
+ * @param legitimateCount Number of clients configured by the legitimate router only
+ * @param droppedRas Number of RAs dropped by the RA guard
+ */
+void
+AppendToCsv(uint32_t nClients,
+            uint32_t raInterval,
+            double rogueStart,
+            bool prefixFlood,
+            bool raGuard,
+            uint32_t rogueAddressCount,
+            uint32_t rogueRouteCount,
+            uint32_t legitimateCount,
+            uint64_t droppedRas)
+{
+    bool newFile = !std::ifstream(g_csvFileName).good();
+    std::ofstream csvFile(g_csvFileName, std::ios::app);
+    if (!csvFile.is_open())
+    {
+        NS_LOG_ERROR("Failed to open " << g_csvFileName);
+        return;
+    }
+    if (newFile)
+    {
+        csvFile << "nClients,raInterval,rogueStart,prefixFlood,raGuard,rogueAddressCount,"
+                << "rogueRouteCount,legitimateCount,droppedRas,roguePercentage\n";
+    }
+    double roguePercentage = nClients ? 100.0 * rogueRouteCount / nClients : 0;
+    csvFile << nClients << "," << raInterval << "," << rogueStart << "," << prefixFlood << ","
+            << raGuard << "," << rogueAddressCount << "," << rogueRouteCount << ","
+            << legitimateCount << "," << droppedRas << "," << roguePercentage << "\n";
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint32_t nClients = 20;
+    uint32_t raInterval = 200;
+    double rogueStart = 1.0;
+    bool prefixFlood = false;
+    bool raGuard = false;
+    double simTime = 10.0;
+    bool logEnabled = false;
+    bool pcapEnabled = false;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("nClients", "Number of clients", nClients);
+    cmd.AddValue("raInterval", "Interval between two rogue RAs (milliseconds)", raInterval);
+    cmd.AddValue("rogueStart", "Start time of the rogue router (seconds)", rogueStart);
+    cmd.AddValue("prefixFlood", "Advertise a different rogue prefix in each RA", prefixFlood);
+    cmd.AddValue("raGuard", "Enable the RA guard on the switch", raGuard);
+    cmd.AddValue("simTime", "Simulation time (seconds)", simTime);
+    cmd.AddValue("logEnabled", "Enable logging", logEnabled);
+    cmd.AddValue("pcapEnabled", "Enable PCAP file generation", pcapEnabled);
+    cmd.Parse(argc, argv);
+
+    if (logEnabled)
+    {
+        LogComponentEnable("RaSpoofExample", LOG_LEVEL_INFO);
+        LogComponentEnable("RogueRadvd", LOG_LEVEL_INFO);
+        LogComponentEnable("RaGuard", LOG_LEVEL_INFO);
+    }
+
+    Ptr<Node> router = CreateObject<Node>();
+    Ptr<Node> rogue = CreateObject<Node>();
+    Ptr<Node> sw = CreateObject<Node>();
+    NodeContainer clients;
+    clients.Create(nClients);
+
+    NodeContainer hosts(router, rogue);
+    hosts.Add(clients);
+
+    InternetStackHelper internet;
+    internet.SetIpv4StackInstall(false);
+    internet.Install(hosts);
+
+    CsmaHelper csma;
+    csma.SetChannelAttribute("DataRate", StringValue("100Mbps"));
+    csma.SetChannelAttribute("Delay", TimeValue(MicroSeconds(10)));
+
+    // One link per switch port; hostDevices.Get(i) is the device of hosts.Get(i).
+    NetDeviceContainer hostDevices;
+    NetDeviceContainer switchPorts;
+    for (uint32_t i = 0; i < hosts.GetN(); i++)
+    {
+        NetDeviceContainer link = csma.Install(NodeContainer(hosts.Get(i), sw));
+        hostDevices.Add(link.Get(0));
+        switchPorts.Add(link.Get(1));
+    }
+    BridgeHelper bridge;
+    bridge.Install(sw, switchPorts);
+
+    if (pcapEnabled)
+    {
+        csma.EnablePcap("ra-spoof", switchPorts);
+    }
+
+    Ipv6AddressHelper ipv6;
+    ipv6.SetBase(Ipv6Address("2001:db8:1::"), Ipv6Prefix(64));
+    Ipv6InterfaceContainer routerInterface = ipv6.Assign(NetDeviceContainer(hostDevices.Get(0)));
+    routerInterface.SetForwarding(0, true);
+    NetDeviceContainer otherDevices;
+    for (uint32_t i = 1; i < hostDevices.GetN(); i++)
+    {
+        otherDevices.Add(hostDevices.Get(i));
+    }
+    ipv6.AssignWithoutAddress(otherDevices);
+
+    // Legitimate router
+    RadvdHelper radvd;
+    radvd.AddAnnouncedPrefix(routerInterface.GetInterfaceIndex(0),
+                             Ipv6Address("2001:db8:1::"),
+                             64);
+    ApplicationContainer radvdApps = radvd.Install(router);
+    radvdApps.Start(Seconds(0.1));
+    radvdApps.Stop(Seconds(simTime));
+
+    // Rogue router
+    RogueRadvdHelper rogueHelper;
+    rogueHelper.SetAttribute("Prefix", Ipv6AddressValue(Ipv6Address("2001:db8:bad::")));
+    rogueHelper.SetAttribute("Interval", TimeValue(MilliSeconds(raInterval)));
+    rogueHelper.SetAttribute("PrefixFlood", BooleanValue(prefixFlood));
+    ApplicationContainer rogueApps = rogueHelper.Install(rogue);
+    rogueApps.Start(Seconds(rogueStart));
+    rogueApps.Stop(Seconds(simTime));
+
+    // RA guard on the switch, trusting only the router port
+    Ptr<RaGuard> guard;
+    if (raGuard)
+    {
+        RaGuardHelper guardHelper;
+        guardHelper.AddTrustedPort(switchPorts.Get(0));
+        guard = DynamicCast<RaGuard>(guardHelper.Install(sw).Get(0));
+    }
+
+    Simulator::Stop(Seconds(simTime));
+    Simulator::Run();
+
+    Ptr<Ipv6L3Protocol> ipv6Rogue = rogue->GetObject<Ipv6L3Protocol>();
+    Ipv6Address rogueRouter = ipv6Rogue->GetInterface(1)->GetLinkLocalAddress().GetAddress();
+    Ipv6StaticRoutingHelper routingHelper;
+
+    uint32_t rogueAddressCount = 0;
+    uint32_t rogueRouteCount = 0;
+    uint32_t legitimateCount = 0;
+    for (uint32_t i = 0; i < nClients; i++)
+    {
+        Ptr<Ipv6L3Protocol> ipv6Client = clients.Get(i)->GetObject<Ipv6L3Protocol>();
+        int32_t interface = ipv6Client->GetInterfaceForDevice(hostDevices.Get(i + 2));
+
+        bool legitAddress = false;
+        bool rogueAddress = false;
+        for (uint32_t j = 0; j < ipv6Client->GetNAddresses(interface); j++)
+        {
+            Ipv6InterfaceAddress address = ipv6Client->GetAddress(interface, j);
+            if (address.GetScope() != Ipv6InterfaceAddress::GLOBAL)
+            {
+                continue;
+            }
+            if (address.GetAddress().CombinePrefix(Ipv6Prefix(64)) == Ipv6Address("2001:db8:1::"))
+            {
+                legitAddress = true;
+            }
+            else
+            {
+                rogueAddress = true;
+            }
+        }
+
+        bool rogueRoute = false;
+        Ptr<Ipv6StaticRouting> routing = routingHelper.GetStaticRouting(ipv6Client);
+        for (uint32_t j = 0; j < routing->GetNRoutes(); j++)
+        {
+            Ipv6RoutingTableEntry route = routing->GetRoute(j);
+            if (route.IsDefault() && route.GetGateway() == rogueRouter)
+            {
+                rogueRoute = true;
+            }
+        }
+
+        NS_LOG_INFO("Client " << i << ": legitimate address " << legitAddress << ", rogue address "
+                              << rogueAddress << ", rogue default route " << rogueRoute);
+        rogueAddressCount += rogueAddress;
+        rogueRouteCount += rogueRoute;
+        legitimateCount += legitAddress && !rogueAddress && !rogueRoute;
+    }
+
+    uint64_t sentRas = DynamicCast<RogueRadvd>(rogueApps.Get(0))->GetNSent();
+    uint64_t droppedRas = guard ? guard->GetNDropped() : 0;
+
+    std::cout << "Rogue RAs sent: " << sentRas << ", dropped by the RA guard: " << droppedRas
+              << std::endl;
+    std::cout << "Clients with a rogue address: " << rogueAddressCount << "/" << nClients
+              << std::endl;
+    std::cout << "Clients with a rogue default route: " << rogueRouteCount << "/" << nClients
+              << std::endl;
+    std::cout << "Clients configured by the legitimate router only: " << legitimateCount << "/"
+              << nClients << std::endl;
+
+    Simulator::Destroy();
+
+    AppendToCsv(nClients,
+                raInterval,
+                rogueStart,
+                prefixFlood,
+                raGuard,
+                rogueAddressCount,
+                rogueRouteCount,
+                legitimateCount,
+                droppedRas);
+
+    return 0;
+}
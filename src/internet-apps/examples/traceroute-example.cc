@@ -69,6 +69,8 @@ class TracerouteExample
     bool pcap;
     /// Print aodv routes if true
     bool printRoutes;
+    /// Send the traceroute probes of all the TTLs at once if true
+    bool parallel;
     /// nodes used in the example
     NodeContainer nodes;
     /// devices used in the example
@@ -108,7 +110,8 @@ TracerouteExample::TracerouteExample()
       step(50),
       totalTime(100),
       pcap(false),
-      printRoutes(false)
+      printRoutes(false),
+      parallel(false)
 {
 }
 
@@ -126,6 +129,7 @@ TracerouteExample::Configure(int argc, char** argv)
     cmd.AddValue("size", "Number of nodes.", size);
     cmd.AddValue("time", "Simulation time, s.", totalTime);
     cmd.AddValue("step", "Grid step, m", step);
+    cmd.AddValue("parallel", "Probe all the TTLs at once.", parallel);
 
     cmd.Parse(argc, argv);
     return true;
@@ -232,6 +236,7 @@ TracerouteExample::InstallApplications()
 {
     V4TraceRouteHelper traceroute(Ipv4Address("10.0.0.10")); // size - 1
     traceroute.SetAttribute("Verbose", BooleanValue(true));
+    traceroute.SetAttribute("Parallel", BooleanValue(parallel));
     ApplicationContainer p = traceroute.Install(nodes.Get(0));
 
     // Used when we wish to dump the traceroute results into a file
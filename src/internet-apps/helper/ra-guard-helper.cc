@@ -0,0 +1,46 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ra-guard-helper.h"
+
+#include "ns3/abort.h"
+#include "ns3/node.h"
+
+namespace ns3
+{
+
+RaGuardHelper::RaGuardHelper()
+    : ApplicationHelper("ns3::RaGuard")
+{
+}
+
+void
+RaGuardHelper::AddTrustedPort(Ptr<NetDevice> port)
+{
+    m_trusted.Add(port);
+}
+
+void
+RaGuardHelper::AddTrustedPorts(const NetDeviceContainer& ports)
+{
+    m_trusted.Add(ports);
+}
+
+Ptr<Application>
+RaGuardHelper::DoInstall(Ptr<Node> node)
+{
+    NS_ABORT_MSG_IF(!node, "Node does not exist");
+    Ptr<RaGuard> guard = m_factory.Create<RaGuard>();
+    for (auto it = m_trusted.Begin(); it != m_trusted.End(); it++)
+    {
+        if ((*it)->GetNode() == node)
+        {
+            guard->AddTrustedPort(*it);
+        }
+    }
+    node->AddApplication(guard);
+    return guard;
+}
+
+} // namespace ns3
@@ -0,0 +1,48 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef RA_GUARD_HELPER_H
+#define RA_GUARD_HELPER_H
+
+#include "ns3/application-helper.h"
+#include "ns3/net-device-container.h"
+#include "ns3/ra-guard.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup raguard
+ * @brief Create a RaGuard application and associate it to a bridge node
+ *
+ * The trusted ports added to the helper are trusted by every installed
+ * application; ports belonging to other nodes are ignored.
+ */
+class RaGuardHelper : public ApplicationHelper
+{
+  public:
+    RaGuardHelper();
+
+    /**
+     * Trust a bridge port, i.e., accept Router Advertisements from it.
+     * @param port The bridge port
+     */
+    void AddTrustedPort(Ptr<NetDevice> port);
+
+    /**
+     * Trust a set of bridge ports.
+     * @param ports The bridge ports
+     */
+    void AddTrustedPorts(const NetDeviceContainer& ports);
+
+  protected:
+    Ptr<Application> DoInstall(Ptr<Node> node) override;
+
+  private:
+    NetDeviceContainer m_trusted; //!< Trusted ports
+};
+
+} // namespace ns3
+
+#endif /* RA_GUARD_HELPER_H */
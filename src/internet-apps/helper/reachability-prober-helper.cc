@@ -0,0 +1,47 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "reachability-prober-helper.h"
+
+#include "ns3/abort.h"
+#include "ns3/ipv4-interface-container.h"
+#include "ns3/node.h"
+
+namespace ns3
+{
+
+ReachabilityProberHelper::ReachabilityProberHelper()
+    : ApplicationHelper("ns3::ReachabilityProber")
+{
+}
+
+void
+ReachabilityProberHelper::AddTarget(Ipv4Address target)
+{
+    m_targets.push_back(target);
+}
+
+void
+ReachabilityProberHelper::AddTargets(const Ipv4InterfaceContainer& targets)
+{
+    for (uint32_t i = 0; i < targets.GetN(); i++)
+    {
+        m_targets.push_back(targets.GetAddress(i));
+    }
+}
+
+Ptr<Application>
+ReachabilityProberHelper::DoInstall(Ptr<Node> node)
+{
+    NS_ABORT_MSG_IF(!node, "Node does not exist");
+    Ptr<ReachabilityProber> prober = m_factory.Create<ReachabilityProber>();
+    for (const auto& target : m_targets)
+    {
+        prober->AddTarget(target);
+    }
+    node->AddApplication(prober);
+    return prober;
+}
+
+} // namespace ns3
@@ -0,0 +1,51 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef REACHABILITY_PROBER_HELPER_H
+#define REACHABILITY_PROBER_HELPER_H
+
+#include "ns3/application-helper.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/reachability-prober.h"
+
+#include <vector>
+
+namespace ns3
+{
+
+class Ipv4InterfaceContainer;
+
+/**
+ * @ingroup reachability-prober
+ * @brief Create a ReachabilityProber application and associate it to a node
+ *
+ * The targets added to the helper are added to every installed application.
+ */
+class ReachabilityProberHelper : public ApplicationHelper
+{
+  public:
+    ReachabilityProberHelper();
+
+    /**
+     * Add a target to probe.
+     * @param target The IPv4 address of the target
+     */
+    void AddTarget(Ipv4Address target);
+
+    /**
+     * Add all the addresses of an interface container as targets.
+     * @param targets The interfaces to probe
+     */
+    void AddTargets(const Ipv4InterfaceContainer& targets);
+
+  protected:
+    Ptr<Application> DoInstall(Ptr<Node> node) override;
+
+  private:
+    std::vector<Ipv4Address> m_targets; //!< Targets to probe
+};
+
+} // namespace ns3
+
+#endif /* REACHABILITY_PROBER_HELPER_H */
@@ -0,0 +1,15 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "rogue-radvd-helper.h"
+
+namespace ns3
+{
+
+RogueRadvdHelper::RogueRadvdHelper()
+    : ApplicationHelper("ns3::RogueRadvd")
+{
+}
+
+} // namespace ns3
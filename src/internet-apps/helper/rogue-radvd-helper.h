@@ -0,0 +1,26 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef ROGUE_RADVD_HELPER_H
+#define ROGUE_RADVD_HELPER_H
+
+#include "ns3/application-helper.h"
+#include "ns3/rogue-radvd.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup rogueradvd
+ * @brief Create a RogueRadvd application and associate it to a node
+ */
+class RogueRadvdHelper : public ApplicationHelper
+{
+  public:
+    RogueRadvdHelper();
+};
+
+} // namespace ns3
+
+#endif /* ROGUE_RADVD_HELPER_H */
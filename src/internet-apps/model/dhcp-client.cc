@@ -81,6 +81,7 @@ DhcpClient::DhcpClient()
     m_timeout = EventId();
     m_collectEvent = EventId();
     m_firstBoot = true;
+    m_leaseRestored = false;
 }
 
 DhcpClient::DhcpClient(Ptr<NetDevice> netDevice)
@@ -97,6 +98,7 @@ DhcpClient::DhcpClient(Ptr<NetDevice> netDevice)
     m_timeout = EventId();
     m_collectEvent = EventId();
     m_firstBoot = true;
+    m_leaseRestored = false;
 }
 
 DhcpClient::~DhcpClient()
@@ -156,9 +158,12 @@ DhcpClient::StartApplication()
 {
     NS_LOG_FUNCTION(this);
 
-    m_remoteAddress = Ipv4Address("255.255.255.255");
-    m_myAddress = Ipv4Address("0.0.0.0");
-    m_gateway = Ipv4Address("0.0.0.0");
+    if (!m_leaseRestored)
+    {
+        m_remoteAddress = Ipv4Address("255.255.255.255");
+        m_myAddress = Ipv4Address("0.0.0.0");
+        m_gateway = Ipv4Address("0.0.0.0");
+    }
     Ptr<Ipv4> ipv4 = GetNode()->GetObject<Ipv4>();
     uint32_t ifIndex = ipv4->GetInterfaceForDevice(m_device);
 
@@ -181,7 +186,7 @@ DhcpClient::StartApplication()
             found = true;
         }
     }
-    if (!found)
+    if (!found && !m_leaseRestored)
     {
         ipv4->AddAddress(ifIndex, Ipv4InterfaceAddress(Ipv4Address("0.0.0.0"), Ipv4Mask("/0")));
     }
@@ -201,6 +206,11 @@ DhcpClient::StartApplication()
         m_device->AddLinkChangeCallback(MakeCallback(&DhcpClient::LinkStateHandler, this));
         m_firstBoot = false;
     }
+    if (m_leaseRestored)
+    {
+        ResumeLease();
+        return;
+    }
     Boot();
 }
 
@@ -538,4 +548,94 @@ DhcpClient::RemoveAndStart()
     StartApplication();
 }
 
+void
+DhcpClient::SaveCheckpoint(CheckpointWriter& writer) const
+{
+    NS_LOG_FUNCTION(this);
+
+    m_ran->SaveCheckpoint(writer);
+    writer.WriteU8(m_timeout.IsPending());
+    if (!m_timeout.IsPending())
+    {
+        return;
+    }
+    writer.WriteU32(m_myAddress.Get());
+    writer.WriteU32(m_myMask.Get());
+    writer.WriteU32(m_server.Get());
+    writer.WriteU32(m_gateway.Get());
+    writer.WriteU32(m_remoteAddress.Get());
+    writer.WriteU32(m_tran);
+    for (const auto& event : {m_refreshEvent, m_rebindEvent, m_timeout})
+    {
+        writer.WriteTime(event.IsPending() ? Simulator::Now() + Simulator::GetDelayLeft(event)
+                                           : Seconds(-1));
+    }
+}
+
+void
+DhcpClient::RestoreCheckpoint(CheckpointReader& reader)
+{
+    NS_LOG_FUNCTION(this);
+
+    m_ran->RestoreCheckpoint(reader);
+    m_leaseRestored = reader.ReadU8();
+    if (!m_leaseRestored)
+    {
+        return;
+    }
+    m_myAddress = Ipv4Address(reader.ReadU32());
+    m_myMask = Ipv4Mask(reader.ReadU32());
+    m_server = Ipv4Address(reader.ReadU32());
+    m_gateway = Ipv4Address(reader.ReadU32());
+    m_remoteAddress = Ipv4Address(reader.ReadU32());
+    m_tran = reader.ReadU32();
+    m_restoredRefresh = reader.ReadTime();
+    m_restoredRebind = reader.ReadTime();
+    m_restoredTimeout = reader.ReadTime();
+}
+
+void
+DhcpClient::ResumeLease()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_leaseRestored = false;
+    Ptr<Ipv4> ipv4 = GetNode()->GetObject<Ipv4>();
+    int32_t ifIndex = ipv4->GetInterfaceForDevice(m_device);
+
+    bool found = false;
+    for (uint32_t i = 0; i < ipv4->GetNAddresses(ifIndex); i++)
+    {
+        if (ipv4->GetAddress(ifIndex, i).GetLocal() == m_myAddress)
+        {
+            found = true;
+        }
+    }
+    if (!found)
+    {
+        ipv4->AddAddress(ifIndex, Ipv4InterfaceAddress(m_myAddress, m_myMask));
+        ipv4->SetUp(ifIndex);
+    }
+    m_socket->Connect(InetSocketAddress(m_remoteAddress, DHCP_PEER_PORT));
+    Ipv4StaticRoutingHelper ipv4RoutingHelper;
+    Ptr<Ipv4StaticRouting> staticRouting = ipv4RoutingHelper.GetStaticRouting(ipv4);
+    staticRouting->SetDefaultRoute(m_gateway, ifIndex, 0);
+    NS_LOG_INFO("Resumed the lease of " << m_myAddress << " from " << m_remoteAddress);
+
+    m_offeredAddress = m_myAddress;
+    m_state = REFRESH_LEASE;
+    Time now = Simulator::Now();
+    if (m_restoredRefresh >= now)
+    {
+        m_refreshEvent = Simulator::Schedule(m_restoredRefresh - now, &DhcpClient::Request, this);
+    }
+    if (m_restoredRebind >= now)
+    {
+        m_rebindEvent = Simulator::Schedule(m_restoredRebind - now, &DhcpClient::Request, this);
+    }
+    m_timeout = Simulator::Schedule(Max(m_restoredTimeout - now, Seconds(0)),
+                                    &DhcpClient::RemoveAndStart,
+                                    this);
+}
+
 } // Namespace ns3
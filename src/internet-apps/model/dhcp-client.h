@@ -16,6 +16,7 @@
 #include "dhcp-header.h"
 
 #include "ns3/application.h"
+#include "ns3/checkpoint.h"
 #include "ns3/traced-value.h"
 
 #include <list>
@@ -33,7 +34,7 @@ class RandomVariableStream;
  * @class DhcpClient
  * @brief Implements the functionality of a DHCP client
  */
-class DhcpClient : public Application
+class DhcpClient : public Application, public Checkpointable
 {
   public:
     /**
@@ -71,6 +72,25 @@ class DhcpClient : public Application
 
     int64_t AssignStreams(int64_t stream) override;
 
+    /**
+     * @brief Save the lease of a bound client, with its timers, and the
+     * state of the transaction ID random variable.
+     *
+     * A client still looking for a lease restarts the discovery when
+     * restored.
+     *
+     * @param writer the section of the client
+     */
+    void SaveCheckpoint(CheckpointWriter& writer) const override;
+
+    /**
+     * @brief Restore the state saved by SaveCheckpoint(), before the
+     * application starts.
+     *
+     * @param reader the section of the client
+     */
+    void RestoreCheckpoint(CheckpointReader& reader) override;
+
   protected:
     void DoDispose() override;
 
@@ -133,6 +153,12 @@ class DhcpClient : public Application
      */
     void RemoveAndStart();
 
+    /**
+     * @brief Configure the restored lease on the interface and reschedule
+     * its timers, rather than booting.
+     */
+    void ResumeLease();
+
     uint8_t m_state;              //!< State of the DHCP client
     bool m_firstBoot;             //!< First boot (used to add the link state change callback)
     Ptr<NetDevice> m_device;      //!< NetDevice pointer
@@ -161,6 +187,10 @@ class DhcpClient : public Application
     bool m_offered;                    //!< Specify if the client has got any offer
     std::list<DhcpHeader> m_offerList; //!< Stores all the offers given to the client
     uint32_t m_tran;                   //!< Stores the current transaction number to be used
+    bool m_leaseRestored;              //!< Whether a lease was restored from a checkpoint
+    Time m_restoredRefresh;            //!< Time of the restored refresh event, if positive
+    Time m_restoredRebind;             //!< Time of the restored rebind event, if positive
+    Time m_restoredTimeout;            //!< Time of the restored lease timeout
     TracedCallback<const Ipv4Address&> m_newLease; //!< Trace of new lease
     TracedCallback<const Ipv4Address&> m_expiry;   //!< Trace of lease expire
 };
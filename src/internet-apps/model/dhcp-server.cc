@@ -14,7 +14,9 @@
 
 #include "dhcp-header.h"
 
+#include "ns3/abort.h"
 #include "ns3/assert.h"
+#include "ns3/boolean.h"
 #include "ns3/ipv4-packet-info-tag.h"
 #include "ns3/ipv4.h"
 #include "ns3/log.h"
@@ -77,11 +79,21 @@ DhcpServer::GetTypeId()
                                           "Address of default gateway",
                                           Ipv4AddressValue(),
                                           MakeIpv4AddressAccessor(&DhcpServer::m_gateway),
-                                          MakeIpv4AddressChecker());
+                                          MakeIpv4AddressChecker())
+                            .AddAttribute("CoalescedTimer",
+                                          "Update the leases from the one second "
+                                          "PeriodicTimerGroup shared by all the servers, "
+                                          "rather than from an event per server.",
+                                          BooleanValue(false),
+                                          MakeBooleanAccessor(&DhcpServer::m_coalescedTimer),
+                                          MakeBooleanChecker());
     return tid;
 }
 
 DhcpServer::DhcpServer()
+    : m_coalescedTimer(false),
+      m_timerId(0),
+      m_poolRestored(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -98,6 +110,12 @@ DhcpServer::DoDispose()
     Application::DoDispose();
 }
 
+bool
+DhcpServer::IsTimerCoalesced() const
+{
+    return m_coalescedTimer;
+}
+
 void
 DhcpServer::StartApplication()
 {
@@ -133,7 +151,10 @@ DhcpServer::StartApplication()
             // set infinite GRANTED_LEASED_TIME for my address
 
             myOwnAddress = ipv4->GetAddress(ifIndex, addrIndex).GetLocal();
-            m_leasedAddresses[Address()] = std::make_pair(myOwnAddress, 0xffffffff);
+            if (!m_poolRestored)
+            {
+                m_leasedAddresses[Address()] = std::make_pair(myOwnAddress, 0xffffffff);
+            }
             break;
         }
     }
@@ -146,19 +167,31 @@ DhcpServer::StartApplication()
     m_socket->Bind(local);
     m_socket->SetRecvPktInfo(true);
 
-    uint32_t range = m_maxAddress.Get() - m_minAddress.Get() + 1;
-    for (uint32_t searchSeq = 0; searchSeq < range; searchSeq++)
+    if (!m_poolRestored)
     {
-        Ipv4Address poolAddress(m_minAddress.Get() + searchSeq);
-        if (poolAddress != myOwnAddress)
+        uint32_t range = m_maxAddress.Get() - m_minAddress.Get() + 1;
+        for (uint32_t searchSeq = 0; searchSeq < range; searchSeq++)
         {
-            NS_LOG_LOGIC("Adding " << poolAddress << " to the pool");
-            m_availableAddresses.push_back(poolAddress);
+            Ipv4Address poolAddress(m_minAddress.Get() + searchSeq);
+            if (poolAddress != myOwnAddress)
+            {
+                NS_LOG_LOGIC("Adding " << poolAddress << " to the pool");
+                m_availableAddresses.push_back(poolAddress);
+            }
         }
     }
+    m_poolRestored = false;
 
     m_socket->SetRecvCallback(MakeCallback(&DhcpServer::NetHandler, this));
-    m_expiredEvent = Simulator::Schedule(Seconds(1), &DhcpServer::TimerHandler, this);
+    if (m_coalescedTimer)
+    {
+        m_timerId = PeriodicTimerGroup::GetShared(Seconds(1)).Add(
+            MakeCallback(&DhcpServer::TimerHandler, this));
+    }
+    else
+    {
+        m_expiredEvent = Simulator::Schedule(Seconds(1), &DhcpServer::TimerHandler, this);
+    }
 }
 
 void
@@ -173,6 +206,96 @@ DhcpServer::StopApplication()
 
     m_leasedAddresses.clear();
     m_expiredEvent.Cancel();
+    if (m_timerId)
+    {
+        PeriodicTimerGroup::GetShared(Seconds(1)).Remove(m_timerId);
+        m_timerId = 0;
+    }
+}
+
+/**
+ * Write a hardware address in a checkpoint section.
+ *
+ * @param writer the section
+ * @param address the address
+ */
+static void
+WriteAddress(CheckpointWriter& writer, const Address& address)
+{
+    uint8_t buffer[Address::MAX_SIZE + 2];
+    uint32_t size = address.CopyAllTo(buffer, sizeof(buffer));
+    writer.WriteU8(size);
+    writer.Write(buffer, size);
+}
+
+/**
+ * Read a hardware address written by WriteAddress().
+ *
+ * @param reader the section
+ * @return the address
+ */
+static Address
+ReadAddress(CheckpointReader& reader)
+{
+    uint8_t buffer[Address::MAX_SIZE + 2];
+    uint8_t size = reader.ReadU8();
+    NS_ABORT_MSG_IF(size > sizeof(buffer), "Invalid hardware address in the checkpoint");
+    reader.Read(buffer, size);
+    Address address;
+    address.CopyAllFrom(buffer, size);
+    return address;
+}
+
+void
+DhcpServer::SaveCheckpoint(CheckpointWriter& writer) const
+{
+    NS_LOG_FUNCTION(this);
+
+    writer.WriteU32(m_leasedAddresses.size());
+    for (const auto& [chaddr, lease] : m_leasedAddresses)
+    {
+        WriteAddress(writer, chaddr);
+        writer.WriteU32(lease.first.Get());
+        writer.WriteU32(lease.second);
+    }
+    writer.WriteU32(m_expiredAddresses.size());
+    for (const auto& chaddr : m_expiredAddresses)
+    {
+        WriteAddress(writer, chaddr);
+    }
+    writer.WriteU32(m_availableAddresses.size());
+    for (const auto& address : m_availableAddresses)
+    {
+        writer.WriteU32(address.Get());
+    }
+}
+
+void
+DhcpServer::RestoreCheckpoint(CheckpointReader& reader)
+{
+    NS_LOG_FUNCTION(this);
+
+    m_leasedAddresses.clear();
+    uint32_t n = reader.ReadU32();
+    for (uint32_t i = 0; i < n; i++)
+    {
+        Address chaddr = ReadAddress(reader);
+        Ipv4Address address(reader.ReadU32());
+        m_leasedAddresses[chaddr] = std::make_pair(address, reader.ReadU32());
+    }
+    m_expiredAddresses.clear();
+    n = reader.ReadU32();
+    for (uint32_t i = 0; i < n; i++)
+    {
+        m_expiredAddresses.push_back(ReadAddress(reader));
+    }
+    m_availableAddresses.clear();
+    n = reader.ReadU32();
+    for (uint32_t i = 0; i < n; i++)
+    {
+        m_availableAddresses.emplace_back(reader.ReadU32());
+    }
+    m_poolRestored = true;
 }
 
 void
@@ -197,7 +320,10 @@ DhcpServer::TimerHandler()
             }
         }
     }
-    m_expiredEvent = Simulator::Schedule(Seconds(1), &DhcpServer::TimerHandler, this);
+    if (!m_coalescedTimer)
+    {
+        m_expiredEvent = Simulator::Schedule(Seconds(1), &DhcpServer::TimerHandler, this);
+    }
 }
 
 void
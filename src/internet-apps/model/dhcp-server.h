@@ -16,7 +16,9 @@
 #include "dhcp-header.h"
 
 #include "ns3/application.h"
+#include "ns3/checkpoint.h"
 #include "ns3/ipv4-address.h"
+#include "ns3/periodic-timer-group.h"
 
 #include <map>
 
@@ -33,7 +35,7 @@ class Packet;
  * @class DhcpServer
  * @brief Implements the functionality of a DHCP server
  */
-class DhcpServer : public Application
+class DhcpServer : public Application, public Checkpointable
 {
   public:
     /**
@@ -53,9 +55,31 @@ class DhcpServer : public Application
      */
     void AddStaticDhcpEntry(Address chaddr, Ipv4Address addr);
 
+    /**
+     * @brief Save the address pool: the leased addresses with their remaining
+     * lease time, the expired leases and the available addresses.
+     *
+     * @param writer the section of the server
+     */
+    void SaveCheckpoint(CheckpointWriter& writer) const override;
+
+    /**
+     * @brief Restore the address pool saved by SaveCheckpoint(), before the
+     * application starts.
+     *
+     * @param reader the section of the server
+     */
+    void RestoreCheckpoint(CheckpointReader& reader) override;
+
   protected:
     void DoDispose() override;
 
+    /**
+     * @brief Whether the leases are updated from the shared PeriodicTimerGroup
+     * @return the value of the CoalescedTimer attribute
+     */
+    bool IsTimerCoalesced() const;
+
   private:
     void StartApplication() override;
     void StopApplication() override;
@@ -120,6 +144,9 @@ class DhcpServer : public Application
     Time m_renew;                          //!< The renewal time for an address
     Time m_rebind;                         //!< The rebinding time for an address
     EventId m_expiredEvent;                //!< The Event to trigger TimerHandler
+    bool m_coalescedTimer;                 //!< Use the shared one second PeriodicTimerGroup
+    PeriodicTimerGroup::TimerId m_timerId; //!< The timer in the shared group, or 0
+    bool m_poolRestored;                   //!< Whether the pool was restored from a checkpoint
 };
 
 } // namespace ns3
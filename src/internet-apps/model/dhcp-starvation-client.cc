@@ -73,8 +73,10 @@ DhcpStarvationClient::SendDiscover (void)
   hdr.ResetOpt ();
   hdr.SetType (DhcpHeader::DHCPDISCOVER);
   hdr.SetTran (m_rand->GetValue ());
-  // random MAC
-  uint8_t mac[6]; for (int i = 0; i < 6; ++i) { mac[i] = m_rand->GetInteger (0,255); }
+  // random MAC, drawn as one block: same values as six GetInteger (0,255)
+  double draws[6];
+  m_rand->GetValues (0, 256, draws);
+  uint8_t mac[6]; for (int i = 0; i < 6; ++i) { mac[i] = static_cast<uint32_t> (draws[i]); }
   hdr.SetChaddr (Address (1, mac, 6));
   packet->AddHeader (hdr);
   m_socket->SendTo (packet, 0, InetSocketAddress (Ipv4Address ("255.255.255.255"), 67));
@@ -92,6 +92,18 @@ Ping::GetTypeId()
                           TimeValue(Seconds(1)),
                           MakeTimeAccessor(&Ping::m_timeout),
                           MakeTimeChecker())
+            .AddAttribute("WindowSize",
+                          "Number of in-flight echo requests tracked for RTT computation. "
+                          "Must be a power of two; replies to older requests are ignored.",
+                          UintegerValue(1024),
+                          MakeUintegerAccessor(&Ping::m_windowSize),
+                          MakeUintegerChecker<uint32_t>(1, 65536))
+            .AddAttribute("ReportInterval",
+                          "Time between periodic summaries of the last interval "
+                          "(zero disables them)",
+                          TimeValue(Seconds(0)),
+                          MakeTimeAccessor(&Ping::m_reportInterval),
+                          MakeTimeChecker())
             .AddAttribute("Tos",
                           "The Type of Service used to send the ICMP Echo Requests. "
                           "All 8 bits of the TOS byte are set (including ECN bits).",
@@ -113,6 +125,11 @@ Ping::GetTypeId()
             .AddTraceSource("Report",
                             "Summary report at close of application.",
                             MakeTraceSourceAccessor(&Ping::m_reportTrace),
+                            "ns3::Ping::ReportTrace")
+            .AddTraceSource("IntervalReport",
+                            "Summary report of the last interval, "
+                            "if ReportInterval is not zero.",
+                            MakeTraceSourceAccessor(&Ping::m_intervalReportTrace),
                             "ns3::Ping::ReportTrace");
     return tid;
 }
@@ -206,25 +223,11 @@ Ping::Receive(Ptr<Socket> socket)
                 uint64_t appSignature = Read64(buf);
                 delete[] buf;
 
-                if (appSignature == m_appSignature)
+                Time delta;
+                bool dupReply = false;
+                if (appSignature == m_appSignature &&
+                    AcknowledgeEcho(echo.GetSequenceNumber(), delta, dupReply))
                 {
-                    Time sendTime = m_sent.at(echo.GetSequenceNumber()).txTime;
-                    NS_ASSERT(Simulator::Now() >= sendTime);
-                    Time delta = Simulator::Now() - sendTime;
-
-                    bool dupReply = false;
-                    if (m_sent.at(echo.GetSequenceNumber()).acked)
-                    {
-                        m_duplicate++;
-                        dupReply = true;
-                    }
-                    else
-                    {
-                        m_recv++;
-                        m_sent.at(echo.GetSequenceNumber()).acked = true;
-                    }
-
-                    m_avgRtt.Update(delta.GetMilliSeconds());
                     m_rttTrace(echo.GetSequenceNumber(), delta);
 
                     if (m_verbose == VerboseMode::VERBOSE)
@@ -305,25 +308,11 @@ Ping::Receive(Ptr<Socket> socket)
                 uint64_t appSignature = Read64(buf);
                 delete[] buf;
 
-                if (appSignature == m_appSignature)
+                Time delta;
+                bool dupReply = false;
+                if (appSignature == m_appSignature &&
+                    AcknowledgeEcho(echo.GetSeq(), delta, dupReply))
                 {
-                    Time sendTime = m_sent.at(echo.GetSeq()).txTime;
-                    NS_ASSERT(Simulator::Now() >= sendTime);
-                    Time delta = Simulator::Now() - sendTime;
-
-                    bool dupReply = false;
-                    if (m_sent.at(echo.GetSeq()).acked)
-                    {
-                        m_duplicate++;
-                        dupReply = true;
-                    }
-                    else
-                    {
-                        m_recv++;
-                        m_sent.at(echo.GetSeq()).acked = true;
-                    }
-
-                    m_avgRtt.Update(delta.GetMilliSeconds());
                     m_rttTrace(echo.GetSeq(), delta);
 
                     if (m_verbose == VerboseMode::VERBOSE)
@@ -368,6 +357,41 @@ Ping::Receive(Ptr<Socket> socket)
     }
 }
 
+bool
+Ping::AcknowledgeEcho(uint16_t seq, Time& rtt, bool& duplicate)
+{
+    NS_LOG_FUNCTION(this << seq);
+
+    EchoRequestData& request = m_sent[seq & (m_windowSize - 1)];
+    if (!request.valid || request.seq != seq)
+    {
+        NS_LOG_INFO("Echo reply seq = " << seq << " is outside the in-flight window, ignoring");
+        return false;
+    }
+
+    NS_ASSERT(Simulator::Now() >= request.txTime);
+    rtt = Simulator::Now() - request.txTime;
+
+    duplicate = request.acked;
+    if (duplicate)
+    {
+        m_duplicate++;
+    }
+    else
+    {
+        m_recv++;
+        m_intervalRecv++;
+        request.acked = true;
+    }
+
+    m_rttStats.Update(rtt.GetMilliSeconds());
+    if (m_reportInterval.IsStrictlyPositive())
+    {
+        m_intervalRttStats.Update(rtt.GetMilliSeconds());
+    }
+    return true;
+}
+
 // Writes data to buffer in little-endian format; least significant byte
 // of data is at lowest buffer address
 void
@@ -485,27 +509,36 @@ Ping::Send()
         // replies.
         m_socket->SetAttribute("Protocol", UintegerValue(Ipv6Header::IPV6_ICMPV6));
     }
+    EchoRequestData& request = m_sent[m_seq & (m_windowSize - 1)];
     if (returnValue > 0)
     {
-        m_sent.emplace_back(Simulator::Now(), false);
+        request.txTime = Simulator::Now();
+        request.seq = m_seq;
+        request.valid = true;
+        request.acked = false;
         m_txTrace(m_seq, p);
     }
     else
     {
+        // Do not match replies to an older request occupying the same slot.
+        request.valid = false;
         NS_LOG_INFO("Send failure; socket return value: " << returnValue);
     }
     m_seq++;
+    m_transmitted++;
+    m_intervalTransmitted++;
     delete[] data;
 
-    if (m_count == 0 || m_seq < m_count)
+    if (m_count == 0 || m_transmitted < m_count)
     {
         m_next = Simulator::Schedule(m_interval, &Ping::Send, this);
     }
 
     // We have sent all the requests. Schedule a shutdown after the linger time
-    if (m_count > 0 && m_seq == m_count)
+    if (m_count > 0 && m_transmitted == m_count)
     {
-        Time lingerTime = m_avgRtt.Count() > 0 ? MilliSeconds(2 * m_avgRtt.Max()) : m_timeout;
+        const auto& rtt = m_rttStats.m_avg;
+        Time lingerTime = rtt.Count() > 0 ? MilliSeconds(2 * rtt.Max()) : m_timeout;
         Simulator::Schedule(lingerTime, &Ping::StopApplication, this);
     }
 }
@@ -596,16 +629,18 @@ Ping::StartApplication()
         }
     }
 
-    // Guess how large should be the data storage and pre-book it.
-    if (m_count == 0)
-    {
-        Time delta = m_stopTime - Now();
-        int64_t guessedTx = Div(delta, m_interval) + 1;
-        m_sent.reserve(guessedTx);
-    }
-    else
+    // The sequence number wraps around at 2^16, so the window must divide it.
+    NS_ABORT_MSG_IF((m_windowSize & (m_windowSize - 1)) != 0,
+                    "WindowSize must be a power of two, got " << m_windowSize);
+    m_sent.assign(m_windowSize, EchoRequestData());
+
+    if (m_reportInterval.IsStrictlyPositive())
     {
-        m_sent.reserve(m_count);
+        m_intervalStart = Simulator::Now();
+        m_intervalTransmitted = 0;
+        m_intervalRecv = 0;
+        m_intervalRttStats.Reset();
+        m_intervalEvent = Simulator::Schedule(m_reportInterval, &Ping::IntervalReport, this);
     }
 
     Send();
@@ -623,6 +658,10 @@ Ping::StopApplication()
     {
         m_next.Cancel();
     }
+    if (m_intervalEvent.IsPending())
+    {
+        m_intervalEvent.Cancel();
+    }
     if (m_socket)
     {
         m_socket->Close();
@@ -653,36 +692,106 @@ Ping::PrintReport()
             Inet6SocketAddress realFrom = Ipv6Address::ConvertFrom(m_destination);
             os << "\n--- " << realFrom.GetIpv6() << " ping statistics ---\n";
         }
-        os << m_seq << " packets transmitted, " << m_recv << " received, ";
+        os << m_transmitted << " packets transmitted, " << m_recv << " received, ";
         if (m_duplicate)
         {
             os << m_duplicate << " duplicates, ";
         }
 
         // note: integer math to match Linux implementation and avoid turning a 99.9% into a 100%.
-        os << ((m_seq - m_recv) * 100 / m_seq) << "% packet loss, "
+        os << ((m_transmitted - m_recv) * 100 / m_transmitted) << "% packet loss, "
            << "time " << (Simulator::Now() - m_started).GetMilliSeconds() << "ms\n";
 
-        if (m_avgRtt.Count() > 0)
+        const auto& rtt = m_rttStats.m_avg;
+        if (rtt.Count() > 0)
         {
-            os << "rtt min/avg/max/mdev = " << m_avgRtt.Min() << "/" << m_avgRtt.Avg() << "/"
-               << m_avgRtt.Max() << "/" << m_avgRtt.Stddev() << " ms\n";
+            os << "rtt min/avg/max/mdev = " << rtt.Min() << "/" << rtt.Avg() << "/" << rtt.Max()
+               << "/" << rtt.Stddev() << " ms\n";
+            os << "rtt p50/p90/p99 = " << m_rttStats.m_p50.Estimate() << "/"
+               << m_rttStats.m_p90.Estimate() << "/" << m_rttStats.m_p99.Estimate() << " ms\n";
         }
         std::cout << os.str();
     }
     PingReport report;
-    report.m_transmitted = m_seq;
+    report.m_transmitted = m_transmitted;
     report.m_received = m_recv;
     // note: integer math to match Linux implementation and avoid turning a 99.9% into a 100%.
-    report.m_loss = (m_seq - m_recv) * 100 / m_seq;
+    report.m_loss = (m_transmitted - m_recv) * 100 / m_transmitted;
     report.m_duration = (Simulator::Now() - m_started);
-    report.m_rttMin = m_avgRtt.Min();
-    report.m_rttAvg = m_avgRtt.Avg();
-    report.m_rttMax = m_avgRtt.Max();
-    report.m_rttMdev = m_avgRtt.Stddev();
+    m_rttStats.Fill(report);
     m_reportTrace(report);
 }
 
+void
+Ping::IntervalReport()
+{
+    NS_LOG_FUNCTION(this);
+
+    PingReport report;
+    report.m_transmitted = m_intervalTransmitted;
+    report.m_received = m_intervalRecv;
+    // Replies may belong to requests sent in a previous interval.
+    if (m_intervalTransmitted > m_intervalRecv)
+    {
+        report.m_loss = (m_intervalTransmitted - m_intervalRecv) * 100 / m_intervalTransmitted;
+    }
+    report.m_duration = Simulator::Now() - m_intervalStart;
+    m_intervalRttStats.Fill(report);
+
+    if (m_verbose == VerboseMode::VERBOSE || m_verbose == VerboseMode::QUIET)
+    {
+        std::ostringstream os;
+        os.precision(4);
+        os << "[" << Simulator::Now().As(Time::S) << "] " << report.m_transmitted
+           << " packets transmitted, " << report.m_received << " received, " << report.m_loss
+           << "% packet loss";
+        if (m_intervalRttStats.m_avg.Count() > 0)
+        {
+            os << ", rtt min/avg/max/mdev = " << report.m_rttMin << "/" << report.m_rttAvg << "/"
+               << report.m_rttMax << "/" << report.m_rttMdev << " ms, p50/p90/p99 = "
+               << report.m_rttP50 << "/" << report.m_rttP90 << "/" << report.m_rttP99 << " ms";
+        }
+        std::cout << os.str() << "\n";
+    }
+    m_intervalReportTrace(report);
+
+    m_intervalStart = Simulator::Now();
+    m_intervalTransmitted = 0;
+    m_intervalRecv = 0;
+    m_intervalRttStats.Reset();
+    m_intervalEvent = Simulator::Schedule(m_reportInterval, &Ping::IntervalReport, this);
+}
+
+void
+Ping::RttStatistics::Update(double rtt)
+{
+    m_avg.Update(rtt);
+    m_p50.Update(rtt);
+    m_p90.Update(rtt);
+    m_p99.Update(rtt);
+}
+
+void
+Ping::RttStatistics::Reset()
+{
+    m_avg.Reset();
+    m_p50.Reset();
+    m_p90.Reset();
+    m_p99.Reset();
+}
+
+void
+Ping::RttStatistics::Fill(PingReport& report) const
+{
+    report.m_rttMin = m_avg.Min();
+    report.m_rttAvg = m_avg.Avg();
+    report.m_rttMax = m_avg.Max();
+    report.m_rttMdev = m_avg.Stddev();
+    report.m_rttP50 = m_p50.Estimate();
+    report.m_rttP90 = m_p90.Estimate();
+    report.m_rttP99 = m_p99.Estimate();
+}
+
 void
 Ping::SetRouters(const std::vector<Ipv6Address>& routers)
 {
@@ -16,9 +16,10 @@
 
 #include "ns3/application.h"
 #include "ns3/average.h"
+#include "ns3/p2-quantile-estimator.h"
 #include "ns3/traced-callback.h"
 
-#include <map>
+#include <vector>
 
 namespace ns3
 {
@@ -40,6 +41,13 @@ class Socket;
  * application, and can also export statistics via a trace source.
  * The ping packet count, packet size, and interval between pings can
  * be controlled via attributes of this class.
+ *
+ * Outstanding echo requests are kept in a fixed-size window indexed by
+ * sequence number, and RTT statistics (including percentiles) are computed
+ * with streaming estimators, so that memory usage does not grow with the
+ * number of echo requests sent.  Replies to requests that fell out of the
+ * window are ignored.  Optionally, a summary of the last interval can be
+ * printed and traced periodically.
  */
 class Ping : public Application
 {
@@ -87,6 +95,9 @@ class Ping : public Application
         double m_rttAvg{0};        //!< rtt avg value
         double m_rttMax{0};        //!< rtt max value
         double m_rttMdev{0};       //!< rtt mdev value
+        double m_rttP50{0};        //!< rtt 50th percentile estimate
+        double m_rttP90{0};        //!< rtt 90th percentile estimate
+        double m_rttP99{0};        //!< rtt 99th percentile estimate
     };
 
     /**
@@ -188,6 +199,48 @@ class Ping : public Application
      */
     void PrintReport();
 
+    /**
+     * Print and trace the statistics of the last reporting interval, then
+     * schedule the next interval report.
+     */
+    void IntervalReport();
+
+    /**
+     * @brief Record an echo reply for an in-flight echo request.
+     * @param [in] seq The ICMP sequence number of the reply
+     * @param [out] rtt The RTT sample
+     * @param [out] duplicate True if the request had been acknowledged already
+     * @return false if the request is not (or no longer) in the in-flight window
+     */
+    bool AcknowledgeEcho(uint16_t seq, Time& rtt, bool& duplicate);
+
+    /**
+     * @brief Streaming RTT statistics, in milliseconds.
+     */
+    class RttStatistics
+    {
+      public:
+        /**
+         * Add an RTT sample
+         * @param rtt The RTT sample, in milliseconds
+         */
+        void Update(double rtt);
+
+        /// Reset the statistics
+        void Reset();
+
+        /**
+         * Fill in the RTT fields of a report
+         * @param report The report to fill in
+         */
+        void Fill(PingReport& report) const;
+
+        Average<double> m_avg;              //!< min, avg, max and mdev
+        P2QuantileEstimator m_p50{0.5};     //!< 50th percentile
+        P2QuantileEstimator m_p90{0.9};     //!< 90th percentile
+        P2QuantileEstimator m_p99{0.99};    //!< 99th percentile
+    };
+
     /// Sender Local Address
     Address m_interfaceAddress;
     /// Remote address
@@ -207,6 +260,8 @@ class Ping : public Application
     uint8_t m_tos;
     /// ICMP ECHO sequence number
     uint16_t m_seq{0};
+    /// Number of echo requests sent (the sequence number wraps around)
+    uint32_t m_transmitted{0};
     /// Callbacks for tracing the packet Tx events
     TracedCallback<uint16_t, Ptr<Packet>> m_txTrace;
     /// TracedCallback for RTT samples
@@ -215,6 +270,8 @@ class Ping : public Application
     TracedCallback<uint16_t, DropReason> m_dropTrace;
     /// TracedCallback for final ping report
     TracedCallback<const PingReport&> m_reportTrace;
+    /// TracedCallback for periodic interval reports
+    TracedCallback<const PingReport&> m_intervalReportTrace;
     /// Variable to stor verbose mode
     VerboseMode m_verbose{VerboseMode::VERBOSE};
     /// Received packets counter
@@ -223,10 +280,22 @@ class Ping : public Application
     uint32_t m_duplicate{0};
     /// Start time to report total ping time
     Time m_started;
-    /// Average rtt is ms
-    Average<double> m_avgRtt;
+    /// RTT statistics in ms
+    RttStatistics m_rttStats;
     /// Next packet will be sent
     EventId m_next;
+    /// Time between interval reports (zero disables them)
+    Time m_reportInterval{0};
+    /// Next interval report
+    EventId m_intervalEvent;
+    /// Start time of the current reporting interval
+    Time m_intervalStart;
+    /// Echo requests sent in the current reporting interval
+    uint32_t m_intervalTransmitted{0};
+    /// Echo replies received in the current reporting interval
+    uint32_t m_intervalRecv{0};
+    /// RTT statistics of the current reporting interval, in ms
+    RttStatistics m_intervalRttStats;
 
     /**
      * @brief Sent echo request data.
@@ -234,23 +303,16 @@ class Ping : public Application
     class EchoRequestData
     {
       public:
-        /**
-         * Constructor.
-         * @param txTimePar Echo request Tx time.
-         * @param ackedPar True if the Echo request has been acknowledged at least once.
-         */
-        EchoRequestData(Time txTimePar, bool ackedPar)
-            : txTime(txTimePar),
-              acked(ackedPar)
-        {
-        }
-
         Time txTime;       //!< Tx time
+        uint16_t seq{0};   //!< ICMP sequence number
+        bool valid{false}; //!< True if the slot holds a sent echo request
         bool acked{false}; //!< True if packet has been acknowledged
     };
 
-    /// All sent but not answered packets. Map icmp seqno -> when sent, acked at least once.
+    /// In-flight window of sent echo requests, indexed by icmp seqno modulo the window size.
     std::vector<EchoRequestData> m_sent;
+    /// Size of the in-flight window (a power of two).
+    uint32_t m_windowSize{1024};
     /// Number of packets to be sent.
     uint32_t m_count{0};
     /// Time to wait for a response, in seconds. The option affects only timeout in absence of any
@@ -0,0 +1,197 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ra-guard.h"
+
+#include "ns3/abort.h"
+#include "ns3/bridge-net-device.h"
+#include "ns3/icmpv6-header.h"
+#include "ns3/ipv6-header.h"
+#include "ns3/ipv6-l3-protocol.h"
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/trace-source-accessor.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("RaGuard");
+
+NS_OBJECT_ENSURE_REGISTERED(RaGuard);
+
+/// Number of bytes of an IPv6 packet inspected to find the ICMPv6 header
+static constexpr uint32_t RA_GUARD_INSPECTED_BYTES = 128;
+
+TypeId
+RaGuard::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::RaGuard")
+            .SetParent<Application>()
+            .SetGroupName("Internet-Apps")
+            .AddConstructor<RaGuard>()
+            .AddTraceSource("Drop",
+                            "A frame received on an untrusted port has been dropped.",
+                            MakeTraceSourceAccessor(&RaGuard::m_dropTrace),
+                            "ns3::RaGuard::DropTracedCallback");
+    return tid;
+}
+
+RaGuard::RaGuard()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+RaGuard::~RaGuard()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+RaGuard::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    StopApplication();
+    m_bridge = nullptr;
+    m_trusted.clear();
+    Application::DoDispose();
+}
+
+void
+RaGuard::SetBridge(Ptr<BridgeNetDevice> bridge)
+{
+    NS_LOG_FUNCTION(this << bridge);
+    m_bridge = bridge;
+}
+
+void
+RaGuard::AddTrustedPort(Ptr<NetDevice> port)
+{
+    NS_LOG_FUNCTION(this << port);
+    uint32_t index = port->GetIfIndex();
+    if (index >= m_trusted.size())
+    {
+        m_trusted.resize(index + 1, false);
+    }
+    m_trusted[index] = true;
+}
+
+bool
+RaGuard::IsTrustedPort(Ptr<NetDevice> port) const
+{
+    uint32_t index = port->GetIfIndex();
+    return index < m_trusted.size() && m_trusted[index];
+}
+
+uint64_t
+RaGuard::GetNDropped() const
+{
+    return m_dropped;
+}
+
+void
+RaGuard::StartApplication()
+{
+    NS_LOG_FUNCTION(this);
+
+    if (!m_bridge)
+    {
+        for (uint32_t i = 0; i < GetNode()->GetNDevices() && !m_bridge; i++)
+        {
+            m_bridge = DynamicCast<BridgeNetDevice>(GetNode()->GetDevice(i));
+        }
+    }
+    NS_ABORT_MSG_IF(!m_bridge, "RaGuard: no BridgeNetDevice on node " << GetNode()->GetId());
+    m_bridge->SetIngressFilter(MakeCallback(&RaGuard::Filter, this));
+}
+
+void
+RaGuard::StopApplication()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_bridge)
+    {
+        m_bridge->SetIngressFilter(BridgeNetDevice::IngressFilterCallback());
+    }
+}
+
+bool
+RaGuard::Filter(Ptr<NetDevice> port,
+                Ptr<const Packet> packet,
+                uint16_t protocol,
+                const Address& src,
+                const Address& dst)
+{
+    if (protocol != Ipv6L3Protocol::PROT_NUMBER || IsTrustedPort(port) ||
+        !IsRouterAdvertisement(packet))
+    {
+        return true;
+    }
+
+    NS_LOG_LOGIC("Drop Router Advertisement from " << src << " on untrusted port "
+                                                   << port->GetIfIndex());
+    m_dropped++;
+    m_dropTrace(port, packet);
+    return false;
+}
+
+bool
+RaGuard::IsRouterAdvertisement(Ptr<const Packet> packet)
+{
+    uint8_t buffer[RA_GUARD_INSPECTED_BYTES];
+    uint32_t size = packet->CopyData(buffer, RA_GUARD_INSPECTED_BYTES);
+    if (size < 40)
+    {
+        // Truncated IPv6 header.
+        return true;
+    }
+
+    // Each step advances of at least 8 bytes, so the walk is bounded by the inspected bytes.
+    uint8_t nextHeader = buffer[6];
+    uint32_t offset = 40;
+    while (true)
+    {
+        switch (nextHeader)
+        {
+        case Ipv6Header::IPV6_ICMPV6:
+            return offset >= size || buffer[offset] == Icmpv6Header::ICMPV6_ND_ROUTER_ADVERTISEMENT;
+        case Ipv6Header::IPV6_EXT_HOP_BY_HOP:
+        case Ipv6Header::IPV6_EXT_ROUTING:
+        case Ipv6Header::IPV6_EXT_DESTINATION:
+            if (offset + 2 > size)
+            {
+                return true;
+            }
+            nextHeader = buffer[offset];
+            offset += (buffer[offset + 1] + 1) * 8;
+            break;
+        case Ipv6Header::IPV6_EXT_AUTHENTICATION:
+            if (offset + 2 > size)
+            {
+                return true;
+            }
+            nextHeader = buffer[offset];
+            offset += (buffer[offset + 1] + 2) * 4;
+            break;
+        case Ipv6Header::IPV6_EXT_FRAGMENTATION:
+            if (offset + 8 > size)
+            {
+                return true;
+            }
+            if (((buffer[offset + 2] << 8) | buffer[offset + 3]) & 0xfff8)
+            {
+                // Only the first fragment carries the upper-layer header.
+                return false;
+            }
+            nextHeader = buffer[offset];
+            offset += 8;
+            break;
+        default:
+            return false;
+        }
+    }
+}
+
+} // namespace ns3
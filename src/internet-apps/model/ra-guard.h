@@ -0,0 +1,129 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef RA_GUARD_H
+#define RA_GUARD_H
+
+#include "ns3/address.h"
+#include "ns3/application.h"
+#include "ns3/traced-callback.h"
+
+#include <vector>
+
+namespace ns3
+{
+
+class BridgeNetDevice;
+class NetDevice;
+class Packet;
+
+/**
+ * @ingroup internet-apps
+ * @defgroup raguard RaGuard
+ */
+
+/**
+ * @ingroup raguard
+ *
+ * @brief IPv6 Router Advertisement guard (RFC 6105) for a bridge.
+ *
+ * The application is installed on a node with a BridgeNetDevice (a switch),
+ * and it filters the frames entering the bridge: ICMPv6 Router
+ * Advertisements are forwarded only if they are received on a trusted port,
+ * i.e., a port facing a legitimate router.  All the other frames are
+ * forwarded as usual.
+ *
+ * The classification of a frame costs O(1): only the first bytes of IPv6
+ * frames are inspected, and at most a bounded number of extension headers
+ * are walked.  As suggested by RFC 7113, a frame received on an untrusted
+ * port whose header chain can not be parsed within the inspected bytes is
+ * dropped.
+ */
+class RaGuard : public Application
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    RaGuard();
+    ~RaGuard() override;
+
+    /**
+     * @brief Set the bridge to protect.
+     *
+     * If no bridge is set, the first BridgeNetDevice of the node is used.
+     *
+     * @param bridge The bridge
+     */
+    void SetBridge(Ptr<BridgeNetDevice> bridge);
+
+    /**
+     * @brief Trust a bridge port, i.e., accept Router Advertisements from it.
+     * @param port The bridge port
+     */
+    void AddTrustedPort(Ptr<NetDevice> port);
+
+    /**
+     * @param port The bridge port
+     * @return true if the port is trusted
+     */
+    bool IsTrustedPort(Ptr<NetDevice> port) const;
+
+    /**
+     * @return the number of frames dropped so far
+     */
+    uint64_t GetNDropped() const;
+
+    /**
+     * TracedCallback signature for dropped frames
+     *
+     * @param [in] port The port the frame was received from
+     * @param [in] packet The dropped frame payload
+     */
+    typedef void (*DropTracedCallback)(Ptr<const NetDevice> port, Ptr<const Packet> packet);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    void StartApplication() override;
+    void StopApplication() override;
+
+    /**
+     * @brief Ingress filter of the bridge.
+     * @param port the incoming port
+     * @param packet the frame payload
+     * @param protocol the Ethertype
+     * @param src the source address
+     * @param dst the destination address
+     * @return false if the frame must be dropped
+     */
+    bool Filter(Ptr<NetDevice> port,
+                Ptr<const Packet> packet,
+                uint16_t protocol,
+                const Address& src,
+                const Address& dst);
+
+    /**
+     * @brief Check if an IPv6 packet is (or might be) a Router Advertisement.
+     * @param packet the IPv6 packet
+     * @return true if the packet is a Router Advertisement, or if its header
+     * chain can not be parsed
+     */
+    static bool IsRouterAdvertisement(Ptr<const Packet> packet);
+
+    Ptr<BridgeNetDevice> m_bridge;  //!< The protected bridge
+    std::vector<bool> m_trusted;    //!< Trusted ports, indexed by device index
+    uint64_t m_dropped{0};          //!< Number of dropped frames
+
+    /// TracedCallback for dropped frames
+    TracedCallback<Ptr<const NetDevice>, Ptr<const Packet>> m_dropTrace;
+};
+
+} // namespace ns3
+
+#endif /* RA_GUARD_H */
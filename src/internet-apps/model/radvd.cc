@@ -11,6 +11,7 @@
 #include "radvd.h"
 
 #include "ns3/abort.h"
+#include "ns3/boolean.h"
 #include "ns3/icmpv6-header.h"
 #include "ns3/inet6-socket-address.h"
 #include "ns3/ipv6-address.h"
@@ -29,8 +30,11 @@
 #include "ns3/simulator.h"
 #include "ns3/socket.h"
 #include "ns3/string.h"
+#include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -51,8 +55,36 @@ Radvd::GetTypeId()
                 "Uniform variable to provide jitter between min and max values of AdvInterval",
                 StringValue("ns3::UniformRandomVariable"),
                 MakePointerAccessor(&Radvd::m_jitter),
-                MakePointerChecker<UniformRandomVariable>());
-    ;
+                MakePointerChecker<UniformRandomVariable>())
+            .AddAttribute("SharedScheduler",
+                          "Drive the RAs of all the interfaces with a single timer queue",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&Radvd::m_sharedScheduler),
+                          MakeBooleanChecker())
+            .AddAttribute("CoalescingWindow",
+                          "RAs due within this window are sent by the same event "
+                          "(only with SharedScheduler)",
+                          TimeValue(MilliSeconds(0)),
+                          MakeTimeAccessor(&Radvd::m_coalescingWindow),
+                          MakeTimeChecker(Time(0)))
+            .AddAttribute("RsRateLimit",
+                          "Maximum number of Router Solicitations processed per second on "
+                          "each interface (0 means no limit)",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&Radvd::m_rsRateLimit),
+                          MakeUintegerChecker<uint32_t>())
+            .AddTraceSource("RaTx",
+                            "A RA has been sent.",
+                            MakeTraceSourceAccessor(&Radvd::m_raTxTrace),
+                            "ns3::Radvd::RaTxTracedCallback")
+            .AddTraceSource("RsRx",
+                            "A Router Solicitation has been processed.",
+                            MakeTraceSourceAccessor(&Radvd::m_rsRxTrace),
+                            "ns3::Radvd::RsTracedCallback")
+            .AddTraceSource("RsDrop",
+                            "A Router Solicitation has been dropped by the rate limit.",
+                            MakeTraceSourceAccessor(&Radvd::m_rsDropTrace),
+                            "ns3::Radvd::RsTracedCallback");
     return tid;
 }
 
@@ -115,9 +147,34 @@ Radvd::StartApplication()
         m_recvSocket->SetRecvPktInfo(true);
     }
 
+    m_states.clear();
+    m_stateIndex.clear();
     for (auto it = m_configurations.begin(); it != m_configurations.end(); it++)
     {
-        if ((*it)->IsSendAdvert())
+        if (m_stateIndex.find((*it)->GetInterface()) == m_stateIndex.end())
+        {
+            InterfaceState state;
+            state.config = *it;
+            state.nextUnsolicited = Time::Max();
+            state.nextSolicited = Time::Max();
+            state.rsTokens = m_rsRateLimit;
+            state.rsLastRefill = Simulator::Now();
+            m_stateIndex[(*it)->GetInterface()] = m_states.size();
+            m_states.push_back(state);
+        }
+        else
+        {
+            NS_ABORT_MSG_IF(m_sharedScheduler,
+                            "SharedScheduler requires one configuration per interface");
+        }
+
+        if ((*it)->IsSendAdvert() && m_sharedScheduler)
+        {
+            uint32_t state = m_stateIndex[(*it)->GetInterface()];
+            m_states[state].nextUnsolicited = Simulator::Now();
+            PushTimer(state, Simulator::Now(), false);
+        }
+        else if ((*it)->IsSendAdvert())
         {
             m_unsolicitedEventIds[(*it)->GetInterface()] =
                 Simulator::Schedule(Seconds(0.),
@@ -142,6 +199,11 @@ Radvd::StartApplication()
             m_sendSockets[(*it)->GetInterface()]->ShutdownRecv();
         }
     }
+
+    if (m_sharedScheduler)
+    {
+        ArmTimer();
+    }
 }
 
 void
@@ -165,6 +227,14 @@ Radvd::StopApplication()
         Simulator::Cancel((*it).second);
     }
     m_solicitedEventIds.clear();
+
+    m_timerEvent.Cancel();
+    m_timers = decltype(m_timers)();
+    for (auto& state : m_states)
+    {
+        state.nextUnsolicited = Time::Max();
+        state.nextSolicited = Time::Max();
+    }
 }
 
 void
@@ -194,6 +264,43 @@ Radvd::Send(Ptr<RadvdInterface> config, Ipv6Address dst, bool reschedule)
         config->SetLastRaTxTime(Simulator::Now());
     }
 
+    SendRa(config, dst, !reschedule);
+
+    if (reschedule)
+    {
+        uint64_t delay = GetUnsolicitedDelay(config);
+        NS_LOG_INFO("Reschedule in " << delay << " milliseconds");
+        Time t = MilliSeconds(delay);
+        m_unsolicitedEventIds[config->GetInterface()] =
+            Simulator::Schedule(t,
+                                &Radvd::Send,
+                                this,
+                                config,
+                                Ipv6Address::GetAllNodesMulticast(),
+                                true);
+    }
+}
+
+uint64_t
+Radvd::GetUnsolicitedDelay(Ptr<RadvdInterface> config)
+{
+    auto delay = static_cast<uint64_t>(
+        m_jitter->GetValue(config->GetMinRtrAdvInterval(), config->GetMaxRtrAdvInterval()) + 0.5);
+    if (config->IsInitialRtrAdv())
+    {
+        if (delay > MAX_INITIAL_RTR_ADVERT_INTERVAL)
+        {
+            delay = MAX_INITIAL_RTR_ADVERT_INTERVAL;
+        }
+    }
+    return delay;
+}
+
+void
+Radvd::SendRa(Ptr<RadvdInterface> config, Ipv6Address dst, bool solicited)
+{
+    NS_LOG_FUNCTION(this << dst << solicited);
+
     Icmpv6RA raHdr;
     Icmpv6OptionLinkLayerAddress llaHdr;
     Icmpv6OptionMtu mtuHdr;
@@ -281,30 +388,140 @@ Radvd::Send(Ptr<RadvdInterface> config, Ipv6Address dst, bool reschedule)
     /* send RA */
     NS_LOG_LOGIC("Send RA to " << dst);
     m_sendSockets[config->GetInterface()]->SendTo(p, 0, Inet6SocketAddress(dst, 0));
+    m_raTxTrace(config->GetInterface(), solicited);
+}
 
-    if (reschedule)
+bool
+Radvd::AcceptRs(uint32_t interface)
+{
+    NS_LOG_FUNCTION(this << interface);
+
+    auto found = m_stateIndex.find(interface);
+    if (m_rsRateLimit == 0 || found == m_stateIndex.end())
+    {
+        return true;
+    }
+
+    // Token bucket holding up to one second worth of Router Solicitations.
+    InterfaceState& state = m_states[found->second];
+    Time now = Simulator::Now();
+    state.rsTokens = std::min<double>(m_rsRateLimit,
+                                      state.rsTokens +
+                                          (now - state.rsLastRefill).GetSeconds() * m_rsRateLimit);
+    state.rsLastRefill = now;
+    if (state.rsTokens < 1)
+    {
+        return false;
+    }
+    state.rsTokens -= 1;
+    return true;
+}
+
+void
+Radvd::ScheduleSolicitedRa(uint32_t interface)
+{
+    NS_LOG_FUNCTION(this << interface);
+
+    auto found = m_stateIndex.find(interface);
+    if (found == m_stateIndex.end())
     {
-        auto delay = static_cast<uint64_t>(
-            m_jitter->GetValue(config->GetMinRtrAdvInterval(), config->GetMaxRtrAdvInterval()) +
-            0.5);
-        if (config->IsInitialRtrAdv())
+        return;
+    }
+    InterfaceState& state = m_states[found->second];
+
+    /* calculate minimum delay between RA */
+    auto delay = static_cast<uint64_t>(m_jitter->GetValue(0, MAX_RA_DELAY_TIME) + 0.5);
+    Time t = Simulator::Now() + MilliSeconds(delay); /* absolute time of solicited RA */
+    if (Simulator::Now() < state.config->GetLastRaTxTime() + MilliSeconds(MIN_DELAY_BETWEEN_RAS))
+    {
+        t += MilliSeconds(MIN_DELAY_BETWEEN_RAS);
+    }
+
+    /* a pending solicited RA, or an earlier periodic RA, answers this RS as well */
+    if (state.nextSolicited != Time::Max() || t > state.nextUnsolicited)
+    {
+        return;
+    }
+
+    /* as with the per-interface events, the minimum delay between RAs only decides whether
+     * the next periodic RA answers the RS: the solicited RA itself is due after the jitter,
+     * in particular on the interfaces which never send periodic RAs.
+     */
+    Time due = Simulator::Now() + MilliSeconds(delay);
+    NS_LOG_INFO("schedule new RA");
+    state.nextSolicited = due;
+    PushTimer(found->second, due, true);
+    ArmTimer();
+}
+
+void
+Radvd::PushTimer(uint32_t state, Time due, bool solicited)
+{
+    m_timers.push({due, state, solicited});
+}
+
+void
+Radvd::ArmTimer()
+{
+    if (m_timers.empty())
+    {
+        return;
+    }
+    Time due = m_timers.top().due;
+    if (m_timerEvent.IsPending())
+    {
+        if (TimeStep(m_timerEvent.GetTs()) <= due)
         {
-            if (delay > MAX_INITIAL_RTR_ADVERT_INTERVAL)
+            return;
+        }
+        m_timerEvent.Cancel();
+    }
+    m_timerEvent = Simulator::Schedule(due - Simulator::Now(), &Radvd::TimerExpired, this);
+}
+
+void
+Radvd::TimerExpired()
+{
+    NS_LOG_FUNCTION(this);
+
+    Time horizon = Simulator::Now() + m_coalescingWindow;
+    while (!m_timers.empty() && m_timers.top().due <= horizon)
+    {
+        TimerEntry entry = m_timers.top();
+        m_timers.pop();
+
+        InterfaceState& state = m_states[entry.state];
+        Time& due = entry.solicited ? state.nextSolicited : state.nextUnsolicited;
+        if (due != entry.due)
+        {
+            continue; // stale entry
+        }
+        due = Time::Max();
+
+        if (entry.solicited)
+        {
+            if (state.nextUnsolicited <= horizon)
             {
-                delay = MAX_INITIAL_RTR_ADVERT_INTERVAL;
+                continue; // merged with the periodic RA sent in this batch
             }
+            SendRa(state.config, Ipv6Address::GetAllNodesMulticast(), true);
         }
+        else
+        {
+            state.config->SetLastRaTxTime(Simulator::Now());
+            SendRa(state.config, Ipv6Address::GetAllNodesMulticast(), false);
+            if (state.nextSolicited <= horizon)
+            {
+                state.nextSolicited = Time::Max(); // merged with this RA
+            }
 
-        NS_LOG_INFO("Reschedule in " << delay << " milliseconds");
-        Time t = MilliSeconds(delay);
-        m_unsolicitedEventIds[config->GetInterface()] =
-            Simulator::Schedule(t,
-                                &Radvd::Send,
-                                this,
-                                config,
-                                Ipv6Address::GetAllNodesMulticast(),
-                                true);
+            uint64_t delay = GetUnsolicitedDelay(state.config);
+            NS_LOG_INFO("Reschedule in " << delay << " milliseconds");
+            state.nextUnsolicited = Simulator::Now() + MilliSeconds(delay);
+            PushTimer(entry.state, state.nextUnsolicited, false);
+        }
     }
+    ArmTimer();
 }
 
 void
@@ -344,6 +561,20 @@ Radvd::HandleRead(Ptr<Socket> socket)
                 NS_LOG_INFO("Received ICMPv6 Router Solicitation from "
                             << hdr.GetSource() << " code = " << (uint32_t)rsHdr.GetCode());
 
+                if (!AcceptRs(ipInterfaceIndex))
+                {
+                    NS_LOG_INFO("Router Solicitation dropped by the rate limit");
+                    m_rsDropTrace(ipInterfaceIndex, hdr.GetSource());
+                    break;
+                }
+                m_rsRxTrace(ipInterfaceIndex, hdr.GetSource());
+
+                if (m_sharedScheduler)
+                {
+                    ScheduleSolicitedRa(ipInterfaceIndex);
+                    break;
+                }
+
                 for (auto it = m_configurations.begin(); it != m_configurations.end(); it++)
                 {
                     if (ipInterfaceIndex == (*it)->GetInterface())
@@ -14,8 +14,12 @@
 #include "radvd-interface.h"
 
 #include "ns3/application.h"
+#include "ns3/traced-callback.h"
 
 #include <map>
+#include <queue>
+#include <unordered_map>
+#include <vector>
 
 namespace ns3
 {
@@ -31,6 +35,17 @@ class Socket;
 /**
  * @ingroup radvd
  * @brief Router advertisement daemon.
+ *
+ * By default each interface has its own events for unsolicited RAs and for
+ * solicited RAs.  With the \c SharedScheduler attribute, the RAs of all the
+ * interfaces are instead driven by a single timer queue with at most one
+ * pending simulator event: the RAs due within \c CoalescingWindow of each
+ * other are sent by the same event, and a solicited RA is merged with an
+ * unsolicited RA of the same interface falling in that window.
+ *
+ * Independently of the scheduler, \c RsRateLimit bounds the number of Router
+ * Solicitations processed per second on each interface; the excess ones are
+ * dropped before any RA is scheduled.
  */
 class Radvd : public Application
 {
@@ -76,6 +91,22 @@ class Radvd : public Application
 
     int64_t AssignStreams(int64_t stream) override;
 
+    /**
+     * TracedCallback signature for RA transmissions
+     *
+     * @param [in] interface The interface index
+     * @param [in] solicited True if the RA answers a Router Solicitation
+     */
+    typedef void (*RaTxTracedCallback)(uint32_t interface, bool solicited);
+
+    /**
+     * TracedCallback signature for received and dropped Router Solicitations
+     *
+     * @param [in] interface The interface index
+     * @param [in] source The source address of the Router Solicitation
+     */
+    typedef void (*RsTracedCallback)(uint32_t interface, const Ipv6Address& source);
+
   protected:
     void DoDispose() override;
 
@@ -114,12 +145,93 @@ class Radvd : public Application
               Ipv6Address dst = Ipv6Address::GetAllNodesMulticast(),
               bool reschedule = false);
 
+    /**
+     * @brief Build and send a RA.
+     * @param config interface configuration
+     * @param dst destination address
+     * @param solicited true if the RA answers a Router Solicitation
+     */
+    void SendRa(Ptr<RadvdInterface> config, Ipv6Address dst, bool solicited);
+
+    /**
+     * @brief Draw the delay before the next unsolicited RA.
+     * @param config interface configuration
+     * @return the delay in milliseconds
+     */
+    uint64_t GetUnsolicitedDelay(Ptr<RadvdInterface> config);
+
     /**
      * @brief Handle received packet, especially router solicitation
      * @param socket socket to read data from
      */
     void HandleRead(Ptr<Socket> socket);
 
+    /**
+     * @brief Check the Router Solicitation rate limit of an interface.
+     * @param interface the interface index
+     * @return true if the Router Solicitation can be processed
+     */
+    bool AcceptRs(uint32_t interface);
+
+    /**
+     * @brief Schedule a solicited RA with the shared scheduler.
+     * @param interface the interface index
+     */
+    void ScheduleSolicitedRa(uint32_t interface);
+
+    /**
+     * @brief Add an entry to the shared timer queue.
+     * @param state index of the interface state
+     * @param due absolute time of the RA
+     * @param solicited true for a solicited RA
+     */
+    void PushTimer(uint32_t state, Time due, bool solicited);
+
+    /**
+     * @brief Make sure the shared timer event fires at the earliest due entry.
+     */
+    void ArmTimer();
+
+    /**
+     * @brief Send all the RAs due within the coalescing window.
+     */
+    void TimerExpired();
+
+    /**
+     * @brief Per-interface state for the shared scheduler and the RS rate limit.
+     */
+    struct InterfaceState
+    {
+        Ptr<RadvdInterface> config; //!< Interface configuration
+        Time nextUnsolicited;       //!< Due time of the next unsolicited RA (Time::Max if none)
+        Time nextSolicited;         //!< Due time of the next solicited RA (Time::Max if none)
+        double rsTokens{0};         //!< Available RS tokens
+        Time rsLastRefill;          //!< Last refill of the RS tokens
+    };
+
+    /**
+     * @brief Entry of the shared timer queue.
+     *
+     * Entries are not removed when the RA is cancelled or rescheduled: an
+     * entry whose due time does not match the interface state is stale and
+     * is skipped.
+     */
+    struct TimerEntry
+    {
+        Time due;       //!< Absolute due time
+        uint32_t state; //!< Index of the interface state
+        bool solicited; //!< True for a solicited RA
+
+        /**
+         * @param o the other entry
+         * @return true if this entry is due after the other one
+         */
+        bool operator>(const TimerEntry& o) const
+        {
+            return due > o.due;
+        }
+    };
+
     /**
      * @brief Raw socket to receive RS.
      */
@@ -149,6 +261,29 @@ class Radvd : public Application
      * @brief Variable to provide jitter in advertisement interval
      */
     Ptr<UniformRandomVariable> m_jitter;
+
+    /// Use a single timer queue for the RAs of all the interfaces
+    bool m_sharedScheduler;
+    /// RAs due within this window are sent together (shared scheduler only)
+    Time m_coalescingWindow;
+    /// Maximum Router Solicitations processed per second and interface (0 means no limit)
+    uint32_t m_rsRateLimit;
+
+    /// Per-interface states
+    std::vector<InterfaceState> m_states;
+    /// Map: interface number, index of its state
+    std::unordered_map<uint32_t, uint32_t> m_stateIndex;
+    /// Shared timer queue
+    std::priority_queue<TimerEntry, std::vector<TimerEntry>, std::greater<>> m_timers;
+    /// The single pending event of the shared scheduler
+    EventId m_timerEvent;
+
+    /// Trace of RA transmissions
+    TracedCallback<uint32_t, bool> m_raTxTrace;
+    /// Trace of Router Solicitations processed
+    TracedCallback<uint32_t, const Ipv6Address&> m_rsRxTrace;
+    /// Trace of Router Solicitations dropped by the rate limit
+    TracedCallback<uint32_t, const Ipv6Address&> m_rsDropTrace;
 };
 
 } /* namespace ns3 */
@@ -0,0 +1,312 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "reachability-prober.h"
+
+#include "ns3/abort.h"
+#include "ns3/icmpv4.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/ipv4-header.h"
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/socket.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/uinteger.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("ReachabilityProber");
+
+NS_OBJECT_ENSURE_REGISTERED(ReachabilityProber);
+
+TypeId
+ReachabilityProber::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::ReachabilityProber")
+            .SetParent<Application>()
+            .SetGroupName("Internet-Apps")
+            .AddConstructor<ReachabilityProber>()
+            .AddAttribute("Interval",
+                          "Time between two batches of probes",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&ReachabilityProber::m_interval),
+                          MakeTimeChecker(TimeStep(1)))
+            .AddAttribute("Timeout",
+                          "Time to wait for a reply before declaring a target unreachable",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&ReachabilityProber::m_timeout),
+                          MakeTimeChecker())
+            .AddAttribute("BatchSize",
+                          "Number of targets probed in each batch (zero means all the targets)",
+                          UintegerValue(0),
+                          MakeUintegerAccessor(&ReachabilityProber::m_batchSize),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("Size",
+                          "The number of data bytes of each probe",
+                          UintegerValue(56),
+                          MakeUintegerAccessor(&ReachabilityProber::m_size),
+                          MakeUintegerChecker<uint32_t>(4))
+            .AddAttribute("Identifier",
+                          "The ICMP identifier of the echo requests",
+                          UintegerValue(0xcafe),
+                          MakeUintegerAccessor(&ReachabilityProber::m_id),
+                          MakeUintegerChecker<uint16_t>())
+            .AddTraceSource("Reachability",
+                            "The number of reachable targets and of targets, after each batch.",
+                            MakeTraceSourceAccessor(&ReachabilityProber::m_reachabilityTrace),
+                            "ns3::ReachabilityProber::ReachabilityTrace")
+            .AddTraceSource("Rtt",
+                            "The target address and RTT sample.",
+                            MakeTraceSourceAccessor(&ReachabilityProber::m_rttTrace),
+                            "ns3::ReachabilityProber::RttTrace");
+    return tid;
+}
+
+ReachabilityProber::ReachabilityProber()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+ReachabilityProber::~ReachabilityProber()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+ReachabilityProber::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    StopApplication();
+    m_socket = nullptr;
+    m_targets.clear();
+    m_deadlines.clear();
+    Application::DoDispose();
+}
+
+uint32_t
+ReachabilityProber::AddTarget(Ipv4Address address)
+{
+    NS_LOG_FUNCTION(this << address);
+    Target target;
+    target.address = address;
+    m_targets.push_back(target);
+    return m_targets.size() - 1;
+}
+
+uint32_t
+ReachabilityProber::GetNTargets() const
+{
+    return m_targets.size();
+}
+
+uint32_t
+ReachabilityProber::GetNReachable() const
+{
+    return m_nReachable;
+}
+
+double
+ReachabilityProber::GetReachableFraction() const
+{
+    if (m_targets.empty())
+    {
+        return 0;
+    }
+    return static_cast<double>(m_nReachable) / m_targets.size();
+}
+
+bool
+ReachabilityProber::IsReachable(uint32_t index) const
+{
+    NS_ASSERT_MSG(index < m_targets.size(), "Invalid target index " << index);
+    return m_targets[index].reachable;
+}
+
+void
+ReachabilityProber::StartApplication()
+{
+    NS_LOG_FUNCTION(this);
+
+    m_socket = Socket::CreateSocket(GetNode(), TypeId::LookupByName("ns3::Ipv4RawSocketFactory"));
+    NS_ASSERT_MSG(m_socket, "ReachabilityProber::StartApplication: can not create socket.");
+    m_socket->SetAttribute("Protocol", UintegerValue(1)); // icmp
+    m_socket->SetRecvCallback(MakeCallback(&ReachabilityProber::Receive, this));
+
+    m_data.assign(m_size, 0);
+    Tick();
+}
+
+void
+ReachabilityProber::StopApplication()
+{
+    NS_LOG_FUNCTION(this);
+    if (m_tick.IsPending())
+    {
+        m_tick.Cancel();
+    }
+    if (m_socket)
+    {
+        m_socket->Close();
+        m_socket->SetRecvCallback(MakeNullCallback<void, Ptr<Socket>>());
+    }
+}
+
+void
+ReachabilityProber::Tick()
+{
+    NS_LOG_FUNCTION(this);
+
+    ExpireProbes();
+
+    uint32_t nTargets = m_targets.size();
+    uint32_t batch = (m_batchSize == 0 || m_batchSize > nTargets) ? nTargets : m_batchSize;
+    for (uint32_t i = 0; i < batch; i++)
+    {
+        uint32_t index = m_next;
+        m_next = (m_next + 1) % nTargets;
+
+        if (!m_targets[index].pending)
+        {
+            SendProbe(index);
+        }
+    }
+
+    NS_LOG_INFO("Reachable targets: " << m_nReachable << "/" << nTargets);
+    m_reachabilityTrace(m_nReachable, nTargets);
+
+    m_tick = Simulator::Schedule(m_interval, &ReachabilityProber::Tick, this);
+}
+
+void
+ReachabilityProber::ExpireProbes()
+{
+    NS_LOG_FUNCTION(this);
+
+    while (!m_deadlines.empty() && m_deadlines.front().time <= Simulator::Now())
+    {
+        Deadline deadline = m_deadlines.front();
+        m_deadlines.pop_front();
+
+        Target& target = m_targets[deadline.index];
+        if (!target.pending || target.seq != deadline.seq)
+        {
+            continue;
+        }
+        target.pending = false;
+        if (target.reachable)
+        {
+            NS_LOG_INFO("Target " << target.address << " became unreachable");
+            target.reachable = false;
+            m_nReachable--;
+        }
+    }
+}
+
+void
+ReachabilityProber::SendProbe(uint32_t index)
+{
+    NS_LOG_FUNCTION(this << index);
+
+    Target& target = m_targets[index];
+    target.seq++;
+
+    // The target index is written in little-endian order at the start of the payload.
+    m_data[0] = (index >> 0) & 0xff;
+    m_data[1] = (index >> 8) & 0xff;
+    m_data[2] = (index >> 16) & 0xff;
+    m_data[3] = (index >> 24) & 0xff;
+
+    Icmpv4Echo echo;
+    echo.SetSequenceNumber(target.seq);
+    echo.SetIdentifier(m_id);
+    echo.SetData(Create<Packet>(m_data.data(), m_size));
+
+    Ptr<Packet> p = Create<Packet>();
+    p->AddHeader(echo);
+    Icmpv4Header header;
+    header.SetType(Icmpv4Header::ICMPV4_ECHO);
+    header.SetCode(0);
+    if (Node::ChecksumEnabled())
+    {
+        header.EnableChecksum();
+    }
+    p->AddHeader(header);
+
+    if (m_socket->SendTo(p, 0, InetSocketAddress(target.address, 0)) > 0)
+    {
+        target.txTime = Simulator::Now();
+        target.pending = true;
+        m_deadlines.push_back({target.txTime + m_timeout, index, target.seq});
+    }
+    else
+    {
+        NS_LOG_INFO("Failed to send a probe to " << target.address);
+    }
+}
+
+void
+ReachabilityProber::Receive(Ptr<Socket> socket)
+{
+    NS_LOG_FUNCTION(this << socket);
+
+    Address from;
+    while (Ptr<Packet> packet = socket->RecvFrom(from))
+    {
+        if (!InetSocketAddress::IsMatchingType(from))
+        {
+            continue;
+        }
+        Ipv4Address source = InetSocketAddress::ConvertFrom(from).GetIpv4();
+
+        Ipv4Header ipv4Hdr;
+        packet->RemoveHeader(ipv4Hdr);
+        Icmpv4Header icmp;
+        packet->RemoveHeader(icmp);
+        if (icmp.GetType() != Icmpv4Header::ICMPV4_ECHO_REPLY)
+        {
+            continue;
+        }
+        Icmpv4Echo echo;
+        packet->RemoveHeader(echo);
+        uint32_t dataSize = echo.GetDataSize();
+        if (echo.GetIdentifier() != m_id || dataSize < 4)
+        {
+            continue;
+        }
+        if (m_data.size() < dataSize)
+        {
+            m_data.resize(dataSize);
+        }
+        echo.GetData(m_data.data());
+        uint32_t index = m_data[0] | (m_data[1] << 8) | (m_data[2] << 16) |
+                         (static_cast<uint32_t>(m_data[3]) << 24);
+
+        if (index >= m_targets.size())
+        {
+            continue;
+        }
+        Target& target = m_targets[index];
+        if (target.address != source || !target.pending ||
+            target.seq != echo.GetSequenceNumber())
+        {
+            NS_LOG_LOGIC("Stale or unexpected reply from " << source);
+            continue;
+        }
+
+        target.pending = false;
+        if (!target.reachable)
+        {
+            NS_LOG_INFO("Target " << target.address << " became reachable");
+            target.reachable = true;
+            m_nReachable++;
+        }
+        m_rttTrace(target.address, Simulator::Now() - target.txTime);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,183 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef REACHABILITY_PROBER_H
+#define REACHABILITY_PROBER_H
+
+#include "ns3/application.h"
+#include "ns3/event-id.h"
+#include "ns3/ipv4-address.h"
+#include "ns3/nstime.h"
+#include "ns3/traced-callback.h"
+
+#include <deque>
+#include <vector>
+
+namespace ns3
+{
+
+class Socket;
+
+/**
+ * @ingroup internet-apps
+ * @defgroup reachability-prober ReachabilityProber
+ */
+
+/**
+ * @ingroup reachability-prober
+ *
+ * @brief Probe the reachability of many IPv4 hosts from a single application.
+ *
+ * The application sends ICMP echo requests to a list of targets through one
+ * raw socket.  Probes are batched: every \c Interval a single event sends a
+ * probe to the next \c BatchSize targets (all of them if \c BatchSize is
+ * zero), in round-robin order.  A target becomes reachable when it answers a
+ * probe, and unreachable when a probe is not answered within \c Timeout.
+ * Every batch expires the timed out probes of all the targets, not only of the
+ * targets of the batch.  A target with a probe still pending (and not timed
+ * out) is not probed again.
+ *
+ * After each batch, the number of reachable targets and the total number of
+ * targets are reported through the \c Reachability trace source, which gives
+ * the reachable fraction over time.
+ *
+ * The target index is carried in the echo payload, so matching a reply to its
+ * target is O(1) regardless of the number of targets.  Targets can be added
+ * while the application is running, e.g., when a DHCP client obtains a lease.
+ */
+class ReachabilityProber : public Application
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    ReachabilityProber();
+    ~ReachabilityProber() override;
+
+    /**
+     * @brief Add a host to probe.
+     * @param address The IPv4 address of the host
+     * @return the index of the target
+     */
+    uint32_t AddTarget(Ipv4Address address);
+
+    /**
+     * @return the number of targets
+     */
+    uint32_t GetNTargets() const;
+
+    /**
+     * @return the number of targets currently reachable
+     */
+    uint32_t GetNReachable() const;
+
+    /**
+     * @return the fraction of targets currently reachable (0 if there are no targets)
+     */
+    double GetReachableFraction() const;
+
+    /**
+     * @param index The index of the target
+     * @return true if the target is currently reachable
+     */
+    bool IsReachable(uint32_t index) const;
+
+    /**
+     * TracedCallback signature for Reachability trace
+     *
+     * @param [in] reachable The number of reachable targets
+     * @param [in] total The number of targets
+     */
+    typedef void (*ReachabilityTrace)(uint32_t reachable, uint32_t total);
+
+    /**
+     * TracedCallback signature for Rtt trace
+     *
+     * @param [in] target The address of the target
+     * @param [in] rtt The RTT sample
+     */
+    typedef void (*RttTrace)(Ipv4Address target, Time rtt);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    void StartApplication() override;
+    void StopApplication() override;
+
+    /**
+     * @brief Expire unanswered probes, send the probes of one batch and report.
+     */
+    void Tick();
+
+    /**
+     * @brief Send one echo request to a target.
+     * @param index The index of the target
+     */
+    void SendProbe(uint32_t index);
+
+    /**
+     * @brief Receive ICMPv4 echo replies.
+     * @param socket the receiving socket
+     */
+    void Receive(Ptr<Socket> socket);
+
+    /**
+     * @brief Probing state of a target.
+     */
+    struct Target
+    {
+        Ipv4Address address;    //!< Address of the target
+        Time txTime;            //!< Tx time of the last probe
+        uint16_t seq{0};        //!< Sequence number of the last probe
+        bool pending{false};    //!< True if the last probe has not been answered
+        bool reachable{false};  //!< True if the target is reachable
+    };
+
+    /**
+     * @brief Deadline of a probe.
+     *
+     * All the probes have the same timeout, so the deadlines are in the
+     * order of the probes.  A deadline is stale once its probe is answered
+     * or replaced by a later probe.
+     */
+    struct Deadline
+    {
+        Time time;      //!< Time at which the probe times out
+        uint32_t index; //!< Index of the target
+        uint16_t seq;   //!< Sequence number of the probe
+    };
+
+    /**
+     * @brief Mark the targets whose probe timed out as unreachable.
+     */
+    void ExpireProbes();
+
+    std::vector<Target> m_targets;    //!< The targets
+    std::deque<Deadline> m_deadlines; //!< Deadlines of the pending probes, earliest first
+    uint32_t m_next{0};               //!< Index of the next target to probe
+    uint32_t m_nReachable{0};         //!< Number of reachable targets
+
+    Time m_interval;      //!< Time between batches
+    Time m_timeout;       //!< Time to wait for a reply
+    uint32_t m_batchSize; //!< Targets probed per batch (0 means all)
+    uint32_t m_size;      //!< Echo payload size
+    uint16_t m_id;        //!< ICMP identifier of the probes
+
+    Ptr<Socket> m_socket;        //!< The raw socket
+    EventId m_tick;              //!< Next batch
+    std::vector<uint8_t> m_data; //!< Echo payload buffer, reused across probes
+
+    /// TracedCallback for the number of reachable targets after each batch
+    TracedCallback<uint32_t, uint32_t> m_reachabilityTrace;
+    /// TracedCallback for RTT samples
+    TracedCallback<Ipv4Address, Time> m_rttTrace;
+};
+
+} // namespace ns3
+
+#endif /* REACHABILITY_PROBER_H */
@@ -48,6 +48,7 @@ RogueDhcpServer::GetTypeId (void)
 }
 
 RogueDhcpServer::RogueDhcpServer ()
+  : m_timerId (0)
 {
   // Initialize pool ranges
   m_poolStart = Ipv4Address("10.0.0.100").Get ();
@@ -74,7 +75,15 @@ RogueDhcpServer::StartApplication (void)
   m_socket->SetRecvCallback (MakeCallback (&RogueDhcpServer::NetHandler, this));
   
   // schedule lease expiry
-  m_timerEvent = Simulator::Schedule (Seconds (1.0), &RogueDhcpServer::TimerHandler, this);
+  if (IsTimerCoalesced ())
+    {
+      m_timerId = PeriodicTimerGroup::GetShared (Seconds (1.0)).Add (
+        MakeCallback (&RogueDhcpServer::TimerHandler, this));
+    }
+  else
+    {
+      m_timerEvent = Simulator::Schedule (Seconds (1.0), &RogueDhcpServer::TimerHandler, this);
+    }
 }
 
 void
@@ -91,6 +100,11 @@ RogueDhcpServer::StopApplication (void)
     {
       Simulator::Cancel (m_timerEvent);
     }
+  if (m_timerId)
+    {
+      PeriodicTimerGroup::GetShared (Seconds (1.0)).Remove (m_timerId);
+      m_timerId = 0;
+    }
 }
 
 void
@@ -128,7 +142,10 @@ RogueDhcpServer::TimerHandler (void)
       ++it;
     }
   }
-  m_timerEvent = Simulator::Schedule (Seconds (1.0), &RogueDhcpServer::TimerHandler, this);
+  if (!IsTimerCoalesced ())
+    {
+      m_timerEvent = Simulator::Schedule (Seconds (1.0), &RogueDhcpServer::TimerHandler, this);
+    }
 }
 
 Ipv4Address
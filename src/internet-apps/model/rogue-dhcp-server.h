@@ -31,6 +31,7 @@ private:
   Time m_defaultLease;
   Ipv4Mask m_netmask;
   EventId m_timerEvent;
+  PeriodicTimerGroup::TimerId m_timerId; // The timer in the shared group, or 0
   Ptr<Socket> m_socket;  // Our own socket for intercepting packets
   
   // Anti-starvation features
@@ -0,0 +1,215 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "rogue-radvd.h"
+
+#include "ns3/abort.h"
+#include "ns3/boolean.h"
+#include "ns3/icmpv6-header.h"
+#include "ns3/inet6-socket-address.h"
+#include "ns3/ipv6-header.h"
+#include "ns3/ipv6-interface.h"
+#include "ns3/ipv6-l3-protocol.h"
+#include "ns3/log.h"
+#include "ns3/net-device.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/socket.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/uinteger.h"
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("RogueRadvd");
+
+NS_OBJECT_ENSURE_REGISTERED(RogueRadvd);
+
+TypeId
+RogueRadvd::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::RogueRadvd")
+            .SetParent<Application>()
+            .SetGroupName("Internet-Apps")
+            .AddConstructor<RogueRadvd>()
+            .AddAttribute("Interface",
+                          "The IPv6 interface index to send the advertisements on",
+                          UintegerValue(1),
+                          MakeUintegerAccessor(&RogueRadvd::m_interface),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("Prefix",
+                          "The advertised prefix",
+                          Ipv6AddressValue(Ipv6Address("2001:db8:bad::")),
+                          MakeIpv6AddressAccessor(&RogueRadvd::m_prefix),
+                          MakeIpv6AddressChecker())
+            .AddAttribute("PrefixLength",
+                          "The length of the advertised prefix",
+                          UintegerValue(64),
+                          MakeUintegerAccessor(&RogueRadvd::m_prefixLength),
+                          MakeUintegerChecker<uint8_t>(16, 128))
+            .AddAttribute("Interval",
+                          "Time between two Router Advertisements",
+                          TimeValue(Seconds(1)),
+                          MakeTimeAccessor(&RogueRadvd::m_interval),
+                          MakeTimeChecker(TimeStep(1)))
+            .AddAttribute("RouterLifetime",
+                          "The advertised router lifetime in seconds (0 means not a default "
+                          "router)",
+                          UintegerValue(1800),
+                          MakeUintegerAccessor(&RogueRadvd::m_routerLifetime),
+                          MakeUintegerChecker<uint16_t>())
+            .AddAttribute("ValidLifetime",
+                          "The advertised prefix valid lifetime in seconds",
+                          UintegerValue(2592000),
+                          MakeUintegerAccessor(&RogueRadvd::m_validLifetime),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("PreferredLifetime",
+                          "The advertised prefix preferred lifetime in seconds",
+                          UintegerValue(604800),
+                          MakeUintegerAccessor(&RogueRadvd::m_preferredLifetime),
+                          MakeUintegerChecker<uint32_t>())
+            .AddAttribute("PrefixFlood",
+                          "Advertise a different prefix in each Router Advertisement",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&RogueRadvd::m_prefixFlood),
+                          MakeBooleanChecker())
+            .AddTraceSource("Tx",
+                            "A Router Advertisement has been sent.",
+                            MakeTraceSourceAccessor(&RogueRadvd::m_txTrace),
+                            "ns3::RogueRadvd::TxTracedCallback");
+    return tid;
+}
+
+RogueRadvd::RogueRadvd()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+RogueRadvd::~RogueRadvd()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+RogueRadvd::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    m_socket = nullptr;
+    Application::DoDispose();
+}
+
+uint64_t
+RogueRadvd::GetNSent() const
+{
+    return m_sent;
+}
+
+void
+RogueRadvd::StartApplication()
+{
+    NS_LOG_FUNCTION(this);
+
+    Ptr<Ipv6L3Protocol> ipv6 = GetNode()->GetObject<Ipv6L3Protocol>();
+    NS_ABORT_MSG_IF(!ipv6, "RogueRadvd requires IPv6 on node " << GetNode()->GetId());
+    NS_ABORT_MSG_IF(m_interface >= ipv6->GetNInterfaces(),
+                    "RogueRadvd: invalid interface " << m_interface);
+    Ptr<Ipv6Interface> iface = ipv6->GetInterface(m_interface);
+    m_source = iface->GetLinkLocalAddress().GetAddress();
+    m_linkAddress = iface->GetDevice()->GetAddress();
+
+    if (!m_socket)
+    {
+        m_socket =
+            Socket::CreateSocket(GetNode(), TypeId::LookupByName("ns3::Ipv6RawSocketFactory"));
+        NS_ASSERT_MSG(m_socket, "RogueRadvd::StartApplication: can not create socket.");
+        m_socket->Bind(Inet6SocketAddress(m_source, 0));
+        m_socket->SetAttribute("Protocol", UintegerValue(Ipv6Header::IPV6_ICMPV6));
+        m_socket->ShutdownRecv();
+    }
+
+    SendRa();
+}
+
+void
+RogueRadvd::StopApplication()
+{
+    NS_LOG_FUNCTION(this);
+    m_sendEvent.Cancel();
+    if (m_socket)
+    {
+        m_socket->Close();
+        m_socket = nullptr;
+    }
+}
+
+Ipv6Address
+RogueRadvd::GetNextPrefix() const
+{
+    if (!m_prefixFlood)
+    {
+        return m_prefix;
+    }
+
+    // Add the number of sent advertisements to the last bits of the prefix:
+    // the two bytes holding the last bit of the prefix are read as a 16-bit
+    // value, in which the counter is shifted to end at the last bit of the
+    // prefix.  The counter thus spans 9 to 16 bits, depending on the prefix
+    // length, and wraps around; the bits after the prefix are cleared.
+    uint8_t buf[16];
+    m_prefix.GetBytes(buf);
+    uint32_t last = (m_prefixLength - 1) / 8;
+    uint32_t shift = 7 - (m_prefixLength - 1) % 8;
+    uint32_t value = ((buf[last - 1] << 8) | buf[last]) + (static_cast<uint32_t>(m_sent) << shift);
+    buf[last - 1] = (value >> 8) & 0xff;
+    buf[last] = value & 0xff;
+    return Ipv6Address(buf).CombinePrefix(Ipv6Prefix(m_prefixLength));
+}
+
+void
+RogueRadvd::SendRa()
+{
+    NS_LOG_FUNCTION(this);
+
+    Ipv6Address prefix = GetNextPrefix();
+    Ipv6Address dst = Ipv6Address::GetAllNodesMulticast();
+
+    Ptr<Packet> p = Create<Packet>();
+
+    Icmpv6OptionLinkLayerAddress llaHdr(true, m_linkAddress);
+    p->AddHeader(llaHdr);
+
+    Icmpv6OptionPrefixInformation prefixHdr;
+    prefixHdr.SetPrefix(prefix);
+    prefixHdr.SetPrefixLength(m_prefixLength);
+    prefixHdr.SetValidTime(m_validLifetime);
+    prefixHdr.SetPreferredTime(m_preferredLifetime);
+    prefixHdr.SetFlags(Icmpv6OptionPrefixInformation::ONLINK |
+                       Icmpv6OptionPrefixInformation::AUTADDRCONF);
+    p->AddHeader(prefixHdr);
+
+    Icmpv6RA raHdr;
+    raHdr.SetCurHopLimit(64);
+    raHdr.SetLifeTime(m_routerLifetime);
+    raHdr.CalculatePseudoHeaderChecksum(m_source,
+                                        dst,
+                                        p->GetSize() + raHdr.GetSerializedSize(),
+                                        Ipv6Header::IPV6_ICMPV6);
+    p->AddHeader(raHdr);
+
+    /* Router advertisements MUST always have a ttl of 255 */
+    SocketIpTtlTag ttl;
+    ttl.SetTtl(255);
+    p->AddPacketTag(ttl);
+
+    NS_LOG_LOGIC("Send rogue RA for " << prefix << "/" << +m_prefixLength);
+    m_socket->SendTo(p, 0, Inet6SocketAddress(dst, 0));
+    m_sent++;
+    m_txTrace(prefix);
+
+    m_sendEvent = Simulator::Schedule(m_interval, &RogueRadvd::SendRa, this);
+}
+
+} // namespace ns3
@@ -0,0 +1,107 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef ROGUE_RADVD_H
+#define ROGUE_RADVD_H
+
+#include "ns3/address.h"
+#include "ns3/application.h"
+#include "ns3/event-id.h"
+#include "ns3/ipv6-address.h"
+#include "ns3/nstime.h"
+#include "ns3/traced-callback.h"
+
+namespace ns3
+{
+
+class Packet;
+class Socket;
+
+/**
+ * @ingroup internet-apps
+ * @defgroup rogueradvd RogueRadvd
+ */
+
+/**
+ * @ingroup rogueradvd
+ *
+ * @brief Rogue IPv6 router: sends unsolicited Router Advertisements.
+ *
+ * The application models the IPv6 counterpart of a rogue DHCP server: every
+ * \c Interval it multicasts a Router Advertisement announcing itself as a
+ * default router (with \c RouterLifetime) and advertising \c Prefix for
+ * stateless address autoconfiguration.  Hosts on the link accepting the
+ * advertisement install a default route through the rogue node and configure
+ * an address in the rogue prefix.
+ *
+ * When \c PrefixFlood is set, each advertisement carries a different prefix
+ * (derived from \c Prefix), which models the "RA flood" attack where every
+ * host configures an ever increasing number of addresses and routes.
+ *
+ * Unlike Radvd, solicitations are not answered and advertisements are not
+ * rate limited: the rate is set only by \c Interval.
+ */
+class RogueRadvd : public Application
+{
+  public:
+    /**
+     * @brief Get the type ID.
+     * @return the object TypeId
+     */
+    static TypeId GetTypeId();
+
+    RogueRadvd();
+    ~RogueRadvd() override;
+
+    /**
+     * @return the number of Router Advertisements sent so far
+     */
+    uint64_t GetNSent() const;
+
+    /**
+     * TracedCallback signature for sent Router Advertisements
+     *
+     * @param [in] prefix The advertised prefix
+     */
+    typedef void (*TxTracedCallback)(const Ipv6Address& prefix);
+
+  protected:
+    void DoDispose() override;
+
+  private:
+    void StartApplication() override;
+    void StopApplication() override;
+
+    /**
+     * @brief Send one Router Advertisement and schedule the next one.
+     */
+    void SendRa();
+
+    /**
+     * @return the prefix to advertise in the next Router Advertisement
+     */
+    Ipv6Address GetNextPrefix() const;
+
+    uint32_t m_interface;         //!< Interface to send the advertisements on
+    Ipv6Address m_prefix;         //!< Advertised prefix
+    uint8_t m_prefixLength;       //!< Length of the advertised prefix
+    Time m_interval;              //!< Time between two advertisements
+    uint16_t m_routerLifetime;    //!< Router lifetime, in seconds
+    uint32_t m_validLifetime;     //!< Prefix valid lifetime, in seconds
+    uint32_t m_preferredLifetime; //!< Prefix preferred lifetime, in seconds
+    bool m_prefixFlood;           //!< Advertise a different prefix each time
+
+    Ptr<Socket> m_socket;  //!< Socket bound to the link-local address of the interface
+    Ipv6Address m_source;  //!< Link-local address of the interface
+    Address m_linkAddress; //!< Link-layer address of the interface
+    EventId m_sendEvent;   //!< Next advertisement
+    uint64_t m_sent{0};    //!< Number of advertisements sent
+
+    /// TracedCallback for sent advertisements
+    TracedCallback<const Ipv6Address&> m_txTrace;
+};
+
+} // namespace ns3
+
+#endif /* ROGUE_RADVD_H */
@@ -80,7 +80,14 @@ V4TraceRoute::GetTypeId()
                           "The waiting time for a route response before a timeout.",
                           TimeValue(Seconds(5)),
                           MakeTimeAccessor(&V4TraceRoute::m_waitIcmpReplyTimeout),
-                          MakeTimeChecker());
+                          MakeTimeChecker())
+            .AddAttribute("Parallel",
+                          "Send the probes of all the TTLs at once, and print the route "
+                          "when all the probes up to the destination are answered "
+                          "(or after Timeout).",
+                          BooleanValue(false),
+                          MakeBooleanAccessor(&V4TraceRoute::m_parallel),
+                          MakeBooleanChecker());
     return tid;
 }
 
@@ -94,7 +101,11 @@ V4TraceRoute::V4TraceRoute()
       m_maxProbes(3),
       m_ttl(1),
       m_maxTtl(30),
-      m_waitIcmpReplyTimeout(Seconds(5))
+      m_waitIcmpReplyTimeout(Seconds(5)),
+      m_parallel(false),
+      m_firstSeq(0),
+      m_destTtl(0),
+      m_unanswered(0)
 {
     m_osRoute.clear();
     m_routeIpv4.clear();
@@ -143,6 +154,11 @@ V4TraceRoute::StartApplication()
     status = m_socket->Bind(src);
     NS_ASSERT(status != -1);
 
+    if (m_parallel)
+    {
+        SendAllProbes();
+        return;
+    }
     m_next = Simulator::ScheduleNow(&V4TraceRoute::StartWaitReplyTimer, this);
 }
 
@@ -226,6 +242,29 @@ V4TraceRoute::Receive(Ptr<Socket> socket)
         Icmpv4Header icmp;
         p->RemoveHeader(icmp);
 
+        if (m_parallel)
+        {
+            if (icmp.GetType() == Icmpv4Header::ICMPV4_TIME_EXCEEDED)
+            {
+                Icmpv4TimeExceeded timeoutResp;
+                p->RemoveHeader(timeoutResp);
+                uint8_t data[8];
+                timeoutResp.GetData(data);
+                RecordAnswer((data[6] << 8) | data[7], realFrom.GetIpv4(), false);
+            }
+            else if (icmp.GetType() == Icmpv4Header::ICMPV4_ECHO_REPLY &&
+                     m_remote == realFrom.GetIpv4())
+            {
+                Icmpv4Echo echo;
+                p->RemoveHeader(echo);
+                if (echo.GetIdentifier() == 0 && echo.GetDataSize() == m_size)
+                {
+                    RecordAnswer(echo.GetSequenceNumber(), realFrom.GetIpv4(), true);
+                }
+            }
+            continue;
+        }
+
         if (icmp.GetType() == Icmpv4Header::ICMPV4_TIME_EXCEEDED)
         {
             Icmpv4TimeExceeded timeoutResp;
@@ -363,10 +402,29 @@ void
 V4TraceRoute::Send()
 {
     NS_LOG_INFO("m_seq=" << m_seq);
+
+    if (m_probeCount < m_maxProbes)
+    {
+        m_probeCount++;
+    }
+    else
+    {
+        m_probeCount = 1;
+        m_ttl++;
+    }
+
+    m_sent.insert(std::make_pair(m_seq, Simulator::Now()));
+    SendEcho(m_seq, m_ttl);
+    m_seq++;
+}
+
+void
+V4TraceRoute::SendEcho(uint16_t seq, uint8_t ttl)
+{
+    NS_LOG_FUNCTION(this << seq << +ttl);
     Ptr<Packet> p = Create<Packet>();
     Icmpv4Echo echo;
-    echo.SetSequenceNumber(m_seq);
-    m_seq++;
+    echo.SetSequenceNumber(seq);
     echo.SetIdentifier(0);
 
     //
@@ -390,21 +448,121 @@ V4TraceRoute::Send()
 
     p->AddHeader(header);
 
-    if (m_probeCount < m_maxProbes)
+    m_socket->SetIpTtl(ttl);
+
+    InetSocketAddress dst = InetSocketAddress(m_remote, 0);
+    m_socket->SendTo(p, 0, dst);
+}
+
+void
+V4TraceRoute::SendAllProbes()
+{
+    NS_LOG_FUNCTION(this);
+    NS_ABORT_MSG_IF(m_maxTtl == 0 || m_maxTtl > 255, "MaxHop must be in [1, 255]");
+    NS_ABORT_MSG_IF(m_maxProbes == 0 || m_maxTtl * m_maxProbes > 0xffff,
+                    "Too many probes for the ICMP sequence number space");
+
+    m_probes.assign(m_maxTtl * m_maxProbes, ProbeState());
+    m_firstSeq = m_seq;
+    m_destTtl = 0;
+    m_unanswered = 0;
+    for (uint32_t ttl = 1; ttl <= m_maxTtl; ttl++)
     {
-        m_probeCount++;
+        for (uint16_t probe = 0; probe < m_maxProbes; probe++)
+        {
+            SendEcho(m_seq, ttl);
+            m_seq++;
+        }
     }
-    else
+
+    m_waitIcmpReplyTimer =
+        Simulator::Schedule(m_waitIcmpReplyTimeout, &V4TraceRoute::ReportRoute, this);
+}
+
+void
+V4TraceRoute::RecordAnswer(uint16_t seq, Ipv4Address hop, bool reached)
+{
+    NS_LOG_FUNCTION(this << seq << hop << reached);
+
+    uint16_t index = seq - m_firstSeq;
+    if (index >= m_probes.size() || m_probes[index].answered)
     {
-        m_probeCount = 1;
-        m_ttl++;
+        return;
     }
+    ProbeState& probe = m_probes[index];
+    probe.answered = true;
+    probe.hop = hop;
+    probe.rtt = Simulator::Now() - m_started;
 
-    m_sent.insert(std::make_pair(m_seq - 1, Simulator::Now()));
-    m_socket->SetIpTtl(m_ttl);
+    uint32_t ttl = index / m_maxProbes + 1;
+    if (reached && (m_destTtl == 0 || ttl < m_destTtl))
+    {
+        // The route ends at this TTL: only the probes up to it are waited for.
+        m_destTtl = ttl;
+        m_unanswered = 0;
+        for (uint32_t i = 0; i < m_destTtl * m_maxProbes; i++)
+        {
+            m_unanswered += !m_probes[i].answered;
+        }
+    }
+    else if (m_destTtl != 0 && ttl <= m_destTtl)
+    {
+        m_unanswered--;
+    }
 
-    InetSocketAddress dst = InetSocketAddress(m_remote, 0);
-    m_socket->SendTo(p, 0, dst);
+    if (m_destTtl != 0 && m_unanswered == 0)
+    {
+        m_waitIcmpReplyTimer.Cancel();
+        ReportRoute();
+    }
+}
+
+void
+V4TraceRoute::ReportRoute()
+{
+    NS_LOG_FUNCTION(this);
+
+    // The whole route is written at once.
+    std::ostringstream os;
+    uint32_t lastTtl = m_destTtl ? m_destTtl : m_maxTtl;
+    for (uint32_t ttl = 1; ttl <= lastTtl; ttl++)
+    {
+        std::ostringstream rtts;
+        Ipv4Address hop;
+        for (uint16_t i = 0; i < m_maxProbes; i++)
+        {
+            const ProbeState& probe = m_probes[(ttl - 1) * m_maxProbes + i];
+            if (probe.answered)
+            {
+                hop = probe.hop;
+                rtts << probe.rtt.As(Time::MS) << " ";
+            }
+            else
+            {
+                rtts << "*  ";
+            }
+        }
+        os << ttl << " ";
+        if (hop.IsInitialized())
+        {
+            os << hop;
+        }
+        os << " " << rtts.str() << "\n";
+    }
+    m_probes.clear();
+
+    if (m_verbose)
+    {
+        std::string route = os.str();
+        route.pop_back();
+        NS_LOG_UNCOND(route);
+    }
+    if (m_printStream)
+    {
+        *m_printStream->GetStream() << os.str();
+    }
+
+    m_next = Simulator::ScheduleNow(&V4TraceRoute::StopApplication, this);
 }
 
 void
@@ -11,12 +11,14 @@
 
 #include "ns3/application.h"
 #include "ns3/average.h"
+#include "ns3/ipv4-address.h"
 #include "ns3/nstime.h"
 #include "ns3/output-stream-wrapper.h"
 #include "ns3/simulator.h"
 #include "ns3/traced-callback.h"
 
 #include <map>
+#include <vector>
 
 namespace ns3
 {
@@ -35,6 +37,10 @@ class Socket;
  *        TTL and repeat the process to reveal all the intermediate hops to
  *        the destination.
  *
+ * In parallel mode (\c Parallel attribute), the probes of all the TTLs are
+ * sent at once, and the route is printed as a whole when all the probes up to
+ * the destination are answered, or after \c Timeout.  The discovery of a path
+ * then takes one round trip time instead of one per hop and probe.
  */
 class V4TraceRoute : public Application
 {
@@ -75,6 +81,27 @@ class V4TraceRoute : public Application
     /** @brief Send one (ICMP ECHO) to the destination.*/
     void Send();
 
+    /**
+     * @brief Send an ICMP ECHO to the destination.
+     * @param seq the ICMP ECHO sequence number
+     * @param ttl the IP TTL
+     */
+    void SendEcho(uint16_t seq, uint8_t ttl);
+
+    /** @brief Send the probes of all the TTLs at once (parallel mode).*/
+    void SendAllProbes();
+
+    /**
+     * @brief Record the answer to a probe (parallel mode).
+     * @param seq the sequence number of the probe
+     * @param hop the address of the node that answered
+     * @param reached true if the answer comes from the destination
+     */
+    void RecordAnswer(uint16_t seq, Ipv4Address hop, bool reached);
+
+    /** @brief Print the whole route and stop the application (parallel mode).*/
+    void ReportRoute();
+
     /** @brief Starts a timer after sending an ICMP ECHO.*/
     void StartWaitReplyTimer();
 
@@ -121,6 +148,29 @@ class V4TraceRoute : public Application
     /// All sent but not answered packets. Map icmp seqno -> when sent
     std::map<uint16_t, Time> m_sent;
 
+    /// Send the probes of all the TTLs at once
+    bool m_parallel;
+
+    /// State of a probe in parallel mode
+    struct ProbeState
+    {
+        Ipv4Address hop;      //!< Address of the node that answered
+        Time rtt;             //!< Round trip time
+        bool answered{false}; //!< True if the probe has been answered
+    };
+
+    /**
+     * Probes in flight (parallel mode), indexed by sequence number minus
+     * m_firstSeq.  The probe at index i has TTL i / m_maxProbes + 1.
+     */
+    std::vector<ProbeState> m_probes;
+    /// Sequence number of the first probe (parallel mode)
+    uint16_t m_firstSeq;
+    /// Smallest TTL that reached the destination, 0 if not reached yet (parallel mode)
+    uint32_t m_destTtl;
+    /// Number of unanswered probes with TTL up to m_destTtl (parallel mode)
+    uint32_t m_unanswered;
+
     /// Stream of characters used for printing a single route
     std::ostringstream m_osRoute;
     /// The Ipv4 address of the latest hop found
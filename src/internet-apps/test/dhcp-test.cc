@@ -8,12 +8,14 @@
  *
  */
 
+#include "ns3/boolean.h"
 #include "ns3/data-rate.h"
 #include "ns3/dhcp-client.h"
 #include "ns3/dhcp-helper.h"
 #include "ns3/dhcp-server.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv4-address-helper.h"
+#include "ns3/periodic-timer-group.h"
 #include "ns3/simple-net-device-helper.h"
 #include "ns3/simple-net-device.h"
 #include "ns3/test.h"
@@ -34,7 +36,11 @@ using namespace ns3;
 class DhcpTestCase : public TestCase
 {
   public:
-    DhcpTestCase();
+    /**
+     * Constructor.
+     * @param coalescedTimer Whether the server uses the shared lease timer.
+     */
+    DhcpTestCase(bool coalescedTimer);
     ~DhcpTestCase() override;
     /**
      * Triggered by an address lease on a client.
@@ -45,11 +51,18 @@ class DhcpTestCase : public TestCase
 
   private:
     void DoRun() override;
+    /** Record the number of timers of the shared lease timer group. */
+    void CountTimers();
+
     Ipv4Address m_leasedAddress[3]; //!< Address given to the nodes
+    bool m_coalescedTimer;          //!< Whether the server uses the shared lease timer
+    std::size_t m_timers;           //!< Timers of the shared group while the server runs
 };
 
-DhcpTestCase::DhcpTestCase()
-    : TestCase("Dhcp test case ")
+DhcpTestCase::DhcpTestCase(bool coalescedTimer)
+    : TestCase(coalescedTimer ? "Dhcp test case with coalesced timer" : "Dhcp test case "),
+      m_coalescedTimer(coalescedTimer),
+      m_timers(0)
 {
 }
 
@@ -68,6 +81,12 @@ DhcpTestCase::LeaseObtained(std::string context, const Ipv4Address& newAddress)
     }
 }
 
+void
+DhcpTestCase::CountTimers()
+{
+    m_timers = PeriodicTimerGroup::GetShared(Seconds(1)).GetN();
+}
+
 void
 DhcpTestCase::DoRun()
 {
@@ -97,6 +116,7 @@ DhcpTestCase::DoRun()
                                                                       Ipv4Address("172.30.0.10"),
                                                                       Ipv4Address("172.30.0.15"),
                                                                       Ipv4Address("172.30.0.17"));
+    dhcpServerApp.Get(0)->SetAttribute("CoalescedTimer", BooleanValue(m_coalescedTimer));
     dhcpServerApp.Start(Seconds(0));
     dhcpServerApp.Stop(Seconds(20));
 
@@ -122,6 +142,7 @@ DhcpTestCase::DoRun()
                                         "2",
                                         MakeCallback(&DhcpTestCase::LeaseObtained, this));
 
+    Simulator::Schedule(Seconds(10), &DhcpTestCase::CountTimers, this);
     Simulator::Stop(Seconds(21));
 
     Simulator::Run();
@@ -141,6 +162,13 @@ DhcpTestCase::DoRun()
                           m_leasedAddress[2] << " instead of "
                                              << "172.30.0.14");
 
+    NS_TEST_ASSERT_MSG_EQ(m_timers,
+                          (m_coalescedTimer ? 1 : 0),
+                          "Wrong number of timers in the shared lease timer group");
+    NS_TEST_ASSERT_MSG_EQ(PeriodicTimerGroup::GetShared(Seconds(1)).GetN(),
+                          0,
+                          "The stopped server must remove its timer");
+
     Simulator::Destroy();
 }
 
@@ -159,7 +187,8 @@ class DhcpTestSuite : public TestSuite
 DhcpTestSuite::DhcpTestSuite()
     : TestSuite("dhcp", Type::UNIT)
 {
-    AddTestCase(new DhcpTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new DhcpTestCase(false), TestCase::Duration::QUICK);
+    AddTestCase(new DhcpTestCase(true), TestCase::Duration::QUICK);
 }
 
 static DhcpTestSuite dhcpTestSuite; //!< Static variable for test initialization
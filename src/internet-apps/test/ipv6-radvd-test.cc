@@ -7,9 +7,12 @@
  *
  */
 
+#include "ns3/boolean.h"
 #include "ns3/data-rate.h"
+#include "ns3/icmpv6-l4-protocol.h"
 #include "ns3/internet-stack-helper.h"
 #include "ns3/ipv6-address-helper.h"
+#include "ns3/ipv6-l3-protocol.h"
 #include "ns3/ipv6-route.h"
 #include "ns3/ipv6-routing-helper.h"
 #include "ns3/ipv6-routing-protocol.h"
@@ -17,6 +20,9 @@
 #include "ns3/simple-net-device-helper.h"
 #include "ns3/simple-net-device.h"
 #include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <map>
 
 using namespace ns3;
 
@@ -34,7 +40,11 @@ using namespace ns3;
 class RadvdTestCase : public TestCase
 {
   public:
-    RadvdTestCase();
+    /**
+     * Constructor.
+     * @param sharedScheduler use the shared RA scheduler
+     */
+    RadvdTestCase(bool sharedScheduler);
     ~RadvdTestCase() override;
 
   private:
@@ -63,13 +73,24 @@ class RadvdTestCase : public TestCase
                       Ptr<NetDevice> r1Dev,
                       Ptr<NetDevice> n1Dev);
 
+    /**
+     * Records the solicited RAs sent by the router.
+     * @param interface the interface index
+     * @param solicited true if the RA answers a RS
+     */
+    void RaTxSink(uint32_t interface, bool solicited);
+
     std::vector<Ipv6Address> m_addresses;              //!< Addresses on the nodes
     std::vector<Socket::SocketErrno> m_routingResults; //!< Routing call return values
     std::vector<Ptr<Ipv6Route>> m_routes;              //!< Routing call results
+    bool m_sharedScheduler;                            //!< Use the shared RA scheduler
+    uint32_t m_raTx{0};                                //!< Number of RAs sent
+    std::map<uint32_t, Time> m_solicitedRaTx;          //!< First solicited RA of each interface
 };
 
-RadvdTestCase::RadvdTestCase()
-    : TestCase("Radvd test case ")
+RadvdTestCase::RadvdTestCase(bool sharedScheduler)
+    : TestCase(sharedScheduler ? "Radvd test case with shared scheduler" : "Radvd test case "),
+      m_sharedScheduler(sharedScheduler)
 {
 }
 
@@ -98,6 +119,16 @@ RadvdTestCase::CheckAddresses(Ptr<NetDevice> n0Dev,
     m_addresses.push_back(ipv6->GetAddress(ipv6->GetInterfaceForDevice(n1Dev), 1).GetAddress());
 }
 
+void
+RadvdTestCase::RaTxSink(uint32_t interface, bool solicited)
+{
+    m_raTx++;
+    if (solicited)
+    {
+        m_solicitedRaTx.emplace(interface, Simulator::Now());
+    }
+}
+
 void
 RadvdTestCase::CheckRouting(Ptr<NetDevice> n0Dev,
                             Ptr<NetDevice> r0Dev,
@@ -207,6 +238,10 @@ RadvdTestCase::DoRun()
     radvdHelper.GetRadvdInterface(iic2.GetInterfaceIndex(1))->SetSendAdvert(false);
 
     ApplicationContainer radvdApps = radvdHelper.Install(r);
+    radvdApps.Get(0)->SetAttribute("SharedScheduler", BooleanValue(m_sharedScheduler));
+    radvdApps.Get(0)->SetAttribute("CoalescingWindow", TimeValue(MilliSeconds(100)));
+    radvdApps.Get(0)->TraceConnectWithoutContext("RaTx",
+                                                 MakeCallback(&RadvdTestCase::RaTxSink, this));
     radvdApps.Start(Seconds(1));
     radvdApps.Stop(Seconds(10));
 
@@ -229,6 +264,19 @@ RadvdTestCase::DoRun()
 
     Simulator::Run();
 
+    NS_TEST_ASSERT_MSG_GT(m_raTx, 0, "No RA has been sent");
+
+    // Both schedulers answer the RS of each node at the same time.
+    uint32_t if1 = iic1.GetInterfaceIndex(1);
+    uint32_t if2 = iic2.GetInterfaceIndex(1);
+    NS_TEST_ASSERT_MSG_EQ(m_solicitedRaTx.size(), 2, "Wrong number of solicited RAs");
+    NS_TEST_EXPECT_MSG_EQ(m_solicitedRaTx[if1],
+                          MilliSeconds(1201),
+                          "Wrong time of the solicited RA on interface " << if1);
+    NS_TEST_EXPECT_MSG_EQ(m_solicitedRaTx[if2],
+                          MilliSeconds(1278),
+                          "Wrong time of the solicited RA on interface " << if2);
+
     // Address assignment checks
     NS_TEST_ASSERT_MSG_EQ(m_addresses[0],
                           Ipv6Address("2001:1::200:ff:fe00:1"),
@@ -285,6 +333,202 @@ RadvdTestCase::DoRun()
     Simulator::Destroy();
 }
 
+/**
+ * @ingroup radvd-test
+ * @ingroup tests
+ *
+ * @brief radvd Router Solicitation tests: rate limit, and solicited RAs
+ * merged with periodic RAs by the shared scheduler.
+ */
+class RadvdRsTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * @param sharedScheduler use the shared RA scheduler
+     * @param rsRateLimit the RsRateLimit attribute
+     * @param coalescingWindow the CoalescingWindow attribute
+     */
+    RadvdRsTestCase(bool sharedScheduler, uint32_t rsRateLimit, Time coalescingWindow);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Sends a burst of Router Solicitations from the host.
+     * @param dev the host device
+     * @param count the number of Router Solicitations
+     */
+    void SendRs(Ptr<NetDevice> dev, uint32_t count);
+
+    /**
+     * Records the RAs sent by the router.
+     * @param interface the interface index
+     * @param solicited true if the RA answers a RS
+     */
+    void RaTxSink(uint32_t interface, bool solicited);
+
+    /**
+     * Counts the Router Solicitations processed by the router.
+     * @param interface the interface index
+     * @param source the source of the Router Solicitation
+     */
+    void RsRxSink(uint32_t interface, const Ipv6Address& source);
+
+    /**
+     * Counts the Router Solicitations dropped by the router.
+     * @param interface the interface index
+     * @param source the source of the Router Solicitation
+     */
+    void RsDropSink(uint32_t interface, const Ipv6Address& source);
+
+    bool m_sharedScheduler;        //!< Use the shared RA scheduler
+    uint32_t m_rsRateLimit;        //!< Router Solicitations processed per second
+    Time m_coalescingWindow;       //!< Coalescing window of the shared scheduler
+    Ipv6Address m_source;          //!< Source of the Router Solicitations
+    uint32_t m_interface{0};       //!< Router interface toward the host
+    uint32_t m_rsRx{0};            //!< Router Solicitations of the burst processed
+    uint32_t m_rsDrop{0};          //!< Router Solicitations of the burst dropped
+    uint32_t m_unsolicitedRaTx{0}; //!< Periodic RAs sent after 10 s
+    uint32_t m_solicitedRaTx{0};   //!< Solicited RAs sent after 10 s
+};
+
+RadvdRsTestCase::RadvdRsTestCase(bool sharedScheduler, uint32_t rsRateLimit, Time coalescingWindow)
+    : TestCase(std::string("Radvd RS test case, ") +
+               (sharedScheduler ? "shared scheduler" : "per-interface events") +
+               ", RS rate limit " + std::to_string(rsRateLimit) + ", coalescing window " +
+               std::to_string(coalescingWindow.GetMilliSeconds()) + " ms"),
+      m_sharedScheduler(sharedScheduler),
+      m_rsRateLimit(rsRateLimit),
+      m_coalescingWindow(coalescingWindow)
+{
+}
+
+void
+RadvdRsTestCase::SendRs(Ptr<NetDevice> dev, uint32_t count)
+{
+    Ptr<Ipv6L3Protocol> ipv6 = dev->GetNode()->GetObject<Ipv6L3Protocol>();
+    m_source = ipv6->GetAddress(ipv6->GetInterfaceForDevice(dev), 0).GetAddress();
+    Ipv6Address dst = Ipv6Address::GetAllRoutersMulticast();
+    for (uint32_t i = 0; i < count; i++)
+    {
+        Ptr<Packet> p = Create<Packet>();
+        Icmpv6RS rs;
+        rs.CalculatePseudoHeaderChecksum(m_source,
+                                         dst,
+                                         rs.GetSerializedSize(),
+                                         Icmpv6L4Protocol::PROT_NUMBER);
+        p->AddHeader(rs);
+        ipv6->GetIcmpv6()->SendMessage(p, m_source, dst, 255);
+    }
+}
+
+void
+RadvdRsTestCase::RaTxSink(uint32_t interface, bool solicited)
+{
+    if (interface != m_interface || Simulator::Now() < Seconds(10))
+    {
+        return;
+    }
+    if (solicited)
+    {
+        m_solicitedRaTx++;
+    }
+    else
+    {
+        m_unsolicitedRaTx++;
+    }
+}
+
+void
+RadvdRsTestCase::RsRxSink(uint32_t interface, const Ipv6Address& source)
+{
+    if (interface == m_interface && source == m_source && Simulator::Now() >= Seconds(10))
+    {
+        m_rsRx++;
+    }
+}
+
+void
+RadvdRsTestCase::RsDropSink(uint32_t interface, const Ipv6Address& source)
+{
+    if (interface == m_interface && source == m_source && Simulator::Now() >= Seconds(10))
+    {
+        m_rsDrop++;
+    }
+}
+
+void
+RadvdRsTestCase::DoRun()
+{
+    Ptr<Node> r = CreateObject<Node>();
+    Ptr<Node> n = CreateObject<Node>();
+    NodeContainer net(r, n);
+
+    InternetStackHelper internetv6;
+    internetv6.Install(net);
+
+    SimpleNetDeviceHelper simpleNetDevice;
+    simpleNetDevice.SetChannelAttribute("Delay", TimeValue(MilliSeconds(2)));
+    simpleNetDevice.SetDeviceAttribute("DataRate", DataRateValue(DataRate("5Mbps")));
+    NetDeviceContainer d = simpleNetDevice.Install(net);
+
+    Ipv6AddressHelper ipv6;
+    ipv6.SetBase(Ipv6Address("2001:1::"), Ipv6Prefix(64));
+    NetDeviceContainer tmp;
+    tmp.Add(d.Get(0));
+    Ipv6InterfaceContainer iicr = ipv6.Assign(tmp);
+    iicr.SetForwarding(0, true);
+    NetDeviceContainer tmp2;
+    tmp2.Add(d.Get(1));
+    ipv6.AssignWithoutAddress(tmp2);
+    m_interface = iicr.GetInterfaceIndex(0);
+
+    /* periodic RAs at 1, 11 and 21 s */
+    RadvdHelper radvdHelper;
+    radvdHelper.AddAnnouncedPrefix(m_interface, Ipv6Address("2001:1::0"), 64);
+    radvdHelper.GetRadvdInterface(m_interface)->SetMinRtrAdvInterval(10000);
+    radvdHelper.GetRadvdInterface(m_interface)->SetMaxRtrAdvInterval(10000);
+
+    ApplicationContainer radvdApps = radvdHelper.Install(r);
+    radvdApps.Get(0)->SetAttribute("SharedScheduler", BooleanValue(m_sharedScheduler));
+    radvdApps.Get(0)->SetAttribute("CoalescingWindow", TimeValue(m_coalescingWindow));
+    radvdApps.Get(0)->SetAttribute("RsRateLimit", UintegerValue(m_rsRateLimit));
+    radvdApps.Get(0)->TraceConnectWithoutContext("RaTx",
+                                                 MakeCallback(&RadvdRsTestCase::RaTxSink, this));
+    radvdApps.Get(0)->TraceConnectWithoutContext("RsRx",
+                                                 MakeCallback(&RadvdRsTestCase::RsRxSink, this));
+    radvdApps.Get(0)->TraceConnectWithoutContext("RsDrop",
+                                                 MakeCallback(&RadvdRsTestCase::RsDropSink, this));
+    radvdApps.Start(Seconds(1));
+    radvdApps.Stop(Seconds(20));
+
+    /* a burst of RSs 600 ms before the second periodic RA: the solicited RA is due at most
+     * 500 ms later, before the periodic RA */
+    Simulator::Schedule(MilliSeconds(10400), &RadvdRsTestCase::SendRs, this, d.Get(1), 5);
+    Simulator::Stop(MilliSeconds(11500));
+    Simulator::Run();
+
+    uint32_t accepted = (m_rsRateLimit == 0) ? 5 : m_rsRateLimit;
+    NS_TEST_EXPECT_MSG_EQ(m_rsRx, accepted, "Wrong number of Router Solicitations processed");
+    NS_TEST_EXPECT_MSG_EQ(m_rsDrop, 5 - accepted, "Wrong number of Router Solicitations dropped");
+
+    if (m_coalescingWindow >= Seconds(1))
+    {
+        /* the periodic RA is sent early in place of the solicited RA */
+        NS_TEST_EXPECT_MSG_EQ(m_solicitedRaTx, 0, "The solicited RA should have been merged");
+        NS_TEST_EXPECT_MSG_EQ(m_unsolicitedRaTx, 1, "Wrong number of periodic RAs");
+    }
+    else
+    {
+        /* a single solicited RA answers the whole burst */
+        NS_TEST_EXPECT_MSG_EQ(m_solicitedRaTx, 1, "Wrong number of solicited RAs");
+        NS_TEST_EXPECT_MSG_EQ(m_unsolicitedRaTx, 1, "Wrong number of periodic RAs");
+    }
+
+    Simulator::Destroy();
+}
+
 /**
  * @ingroup radvd-test
  * @ingroup tests
@@ -300,7 +544,12 @@ class RadvdTestSuite : public TestSuite
 RadvdTestSuite::RadvdTestSuite()
     : TestSuite("radvd", Type::UNIT)
 {
-    AddTestCase(new RadvdTestCase, TestCase::Duration::QUICK);
+    AddTestCase(new RadvdTestCase(false), TestCase::Duration::QUICK);
+    AddTestCase(new RadvdTestCase(true), TestCase::Duration::QUICK);
+    AddTestCase(new RadvdRsTestCase(false, 0, Time(0)), TestCase::Duration::QUICK);
+    AddTestCase(new RadvdRsTestCase(false, 2, Time(0)), TestCase::Duration::QUICK);
+    AddTestCase(new RadvdRsTestCase(true, 2, Time(0)), TestCase::Duration::QUICK);
+    AddTestCase(new RadvdRsTestCase(true, 2, Seconds(1)), TestCase::Duration::QUICK);
 }
 
 static RadvdTestSuite radvdTestSuite; //!< Static variable for test initialization
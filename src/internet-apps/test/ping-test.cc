@@ -34,6 +34,7 @@
 // 7. Test behavior of first reply lost in a count-limited configuration
 // 8. Test behavior of second reply lost in a count-limited configuration
 // 9. Test behavior of last reply lost in a count-limited configuration.
+// 10. Test the in-flight window, with more pings in flight than window slots
 
 #include "ns3/boolean.h"
 #include "ns3/data-rate.h"
@@ -141,6 +142,15 @@ class PingTestCase : public TestCase
         m_interpacketInterval = interval;
     }
 
+    /**
+     * Set the size of the in-flight window.
+     * @param windowSize Number of in-flight echo requests tracked.
+     */
+    void SetWindowSize(uint32_t windowSize)
+    {
+        m_windowSizeAttribute = windowSize;
+    }
+
     /**
      * Set the packet drop list on the Ping node's interface
      * @param dropList packet drop list
@@ -222,6 +232,7 @@ class PingTestCase : public TestCase
     uint32_t m_mtu{1500};                           //!< Link MTU
     uint32_t m_countAttribute{0};                   //!< Number of pings to send
     uint32_t m_sizeAttribute{56};                   //!< Size of pings
+    uint32_t m_windowSizeAttribute{1024};           //!< Size of the in-flight window
     // The following are for setting expected counts for traced events
     uint32_t m_expectedTraceTx{0};  //!< Expected Tx trace sink calls
     uint32_t m_expectedTraceRtt{0}; //!< Expected Rtt trace sink calls
@@ -515,6 +526,7 @@ PingTestCase::DoRun()
     ping->SetAttribute("Count", UintegerValue(m_countAttribute));
     ping->SetAttribute("Size", UintegerValue(m_sizeAttribute));
     ping->SetAttribute("Interval", TimeValue(m_interpacketInterval));
+    ping->SetAttribute("WindowSize", UintegerValue(m_windowSizeAttribute));
     ping->SetStartTime(m_startTime);
     ping->SetStopTime(m_stopTime);
     m_nodes.Get(0)->AddApplication(ping);
@@ -924,6 +936,47 @@ PingTestSuite::PingTestSuite()
     testcase10v4->CheckReportTime(MicroSeconds(1020028));
     AddTestCase(testcase10v4, TestCase::Duration::QUICK);
 #endif
+
+    // 11. Test the in-flight window, with more pings in flight than window slots
+    // Configuration:  Ping::Count = 100,  Ping::Interval = 5 ms, Ping start time =
+    //                 1s, Ping stop time = 5s.  Ping::WindowSize = 8 or 2.
+    // Expected behavior:  The RTT is 20 ms, so four echo requests are in flight
+    //                     when a reply comes back.  With a window of 8 slots all
+    //                     the replies are matched.  With a window of 2 slots, the
+    //                     slot of a reply has been reused by a later request,
+    //                     except for the last two requests, which are never
+    //                     overwritten: only their replies are matched.
+    // How validated:  PingReport trace is checked for number of packets
+    //                 transmitted (100) and received (100 or 2).
+    //                 Ping Tx trace (100) and Rtt trace (100 or 2) are also checked.
+    auto testcase11v4 =
+        new PingTestCase("11. Test the in-flight window with 8 slots, IPv4", USEIPV6_FALSE);
+    testcase11v4->SetStartTime(Seconds(1));
+    testcase11v4->SetCount(100);
+    testcase11v4->SetInterval(MilliSeconds(5));
+    testcase11v4->SetWindowSize(8);
+    testcase11v4->SetStopTime(Seconds(5));
+    testcase11v4->CheckTraceTx(100);
+    testcase11v4->CheckTraceRtt(100);
+    testcase11v4->CheckReportTransmitted(100);
+    testcase11v4->CheckReportReceived(100);
+    testcase11v4->CheckReportLoss(0);
+    AddTestCase(testcase11v4, TestCase::Duration::QUICK);
+
+    auto testcase11v6 =
+        new PingTestCase("11. Test the in-flight window with 2 slots, IPv6", USEIPV6_TRUE);
+    testcase11v6->SetStartTime(Seconds(1));
+    testcase11v6->SetCount(100);
+    testcase11v6->SetInterval(MilliSeconds(5));
+    testcase11v6->SetWindowSize(2);
+    testcase11v6->SetStopTime(Seconds(5));
+    testcase11v6->SetDestinationAddress(Ipv6Address("2001:1::200:ff:fe00:2"));
+    testcase11v6->CheckTraceTx(100);
+    testcase11v6->CheckTraceRtt(2);
+    testcase11v6->CheckReportTransmitted(100);
+    testcase11v6->CheckReportReceived(2);
+    testcase11v6->CheckReportLoss(98); // 98%
+    AddTestCase(testcase11v6, TestCase::Duration::QUICK);
 }
 
 static PingTestSuite pingTestSuite; //!< Static variable for test initialization
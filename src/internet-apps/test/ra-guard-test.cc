@@ -0,0 +1,165 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/bridge-helper.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv6-address-helper.h"
+#include "ns3/ipv6-l3-protocol.h"
+#include "ns3/ra-guard-helper.h"
+#include "ns3/radvd-helper.h"
+#include "ns3/rogue-radvd-helper.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * @ingroup raguard
+ * @defgroup raguard-test RaGuard tests
+ */
+
+/**
+ * @ingroup raguard-test
+ * @ingroup tests
+ *
+ * @brief A legitimate and a rogue router advertise different prefixes to a
+ * host through a bridge, with and without RA guard.
+ */
+class RaGuardTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * @param guard install the RA guard on the bridge
+     */
+    RaGuardTestCase(bool guard);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Checks if a device has an address in a prefix.
+     * @param device the device
+     * @param prefix the prefix (/64)
+     * @return true if one of the addresses of the device is in the prefix
+     */
+    static bool HasAddressIn(Ptr<NetDevice> device, Ipv6Address prefix);
+
+    bool m_guard; //!< Install the RA guard
+};
+
+RaGuardTestCase::RaGuardTestCase(bool guard)
+    : TestCase(guard ? "RA guard drops rogue RAs" : "Rogue RAs without RA guard"),
+      m_guard(guard)
+{
+}
+
+bool
+RaGuardTestCase::HasAddressIn(Ptr<NetDevice> device, Ipv6Address prefix)
+{
+    Ptr<Ipv6L3Protocol> ipv6 = device->GetNode()->GetObject<Ipv6L3Protocol>();
+    int32_t interface = ipv6->GetInterfaceForDevice(device);
+    for (uint32_t i = 0; i < ipv6->GetNAddresses(interface); i++)
+    {
+        if (ipv6->GetAddress(interface, i).GetAddress().CombinePrefix(Ipv6Prefix(64)) == prefix)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+RaGuardTestCase::DoRun()
+{
+    Ptr<Node> router = CreateObject<Node>();
+    Ptr<Node> rogue = CreateObject<Node>();
+    Ptr<Node> host = CreateObject<Node>();
+    Ptr<Node> bridge = CreateObject<Node>();
+
+    InternetStackHelper internetv6;
+    internetv6.Install(NodeContainer(router, rogue, host));
+
+    // One link per bridge port.
+    SimpleNetDeviceHelper simpleNetDevice;
+    NetDeviceContainer d0 = simpleNetDevice.Install(NodeContainer(router, bridge));
+    NetDeviceContainer d1 = simpleNetDevice.Install(NodeContainer(rogue, bridge));
+    NetDeviceContainer d2 = simpleNetDevice.Install(NodeContainer(host, bridge));
+
+    NetDeviceContainer ports;
+    ports.Add(d0.Get(1));
+    ports.Add(d1.Get(1));
+    ports.Add(d2.Get(1));
+    BridgeHelper bridgeHelper;
+    bridgeHelper.Install(bridge, ports);
+
+    Ipv6AddressHelper ipv6;
+    ipv6.SetBase(Ipv6Address("2001:1::"), Ipv6Prefix(64));
+    Ipv6InterfaceContainer iicr = ipv6.Assign(NetDeviceContainer(d0.Get(0)));
+    iicr.SetForwarding(0, true);
+    ipv6.AssignWithoutAddress(NetDeviceContainer(d1.Get(0), d2.Get(0)));
+
+    RadvdHelper radvdHelper;
+    radvdHelper.AddAnnouncedPrefix(iicr.GetInterfaceIndex(0), Ipv6Address("2001:1::"), 64);
+    ApplicationContainer radvdApps = radvdHelper.Install(router);
+    radvdApps.Start(Seconds(1));
+    radvdApps.Stop(Seconds(10));
+
+    RogueRadvdHelper rogueHelper;
+    rogueHelper.SetAttribute("Prefix", Ipv6AddressValue(Ipv6Address("2001:bad::")));
+    rogueHelper.SetAttribute("Interval", TimeValue(MilliSeconds(500)));
+    ApplicationContainer rogueApps = rogueHelper.Install(rogue);
+    rogueApps.Start(Seconds(1));
+    rogueApps.Stop(Seconds(9.9));
+
+    Ptr<RaGuard> guard;
+    if (m_guard)
+    {
+        RaGuardHelper guardHelper;
+        guardHelper.AddTrustedPort(d0.Get(1));
+        guard = DynamicCast<RaGuard>(guardHelper.Install(bridge).Get(0));
+    }
+
+    Simulator::Stop(Seconds(10));
+    Simulator::Run();
+
+    Ptr<RogueRadvd> rogueApp = DynamicCast<RogueRadvd>(rogueApps.Get(0));
+    NS_TEST_ASSERT_MSG_GT(rogueApp->GetNSent(), 0, "No rogue RA has been sent");
+
+    NS_TEST_EXPECT_MSG_EQ(HasAddressIn(d2.Get(0), Ipv6Address("2001:1::")),
+                          true,
+                          "The host must be configured by the legitimate router");
+    NS_TEST_EXPECT_MSG_EQ(HasAddressIn(d2.Get(0), Ipv6Address("2001:bad::")),
+                          !m_guard,
+                          "Unexpected rogue address on the host");
+    if (guard)
+    {
+        NS_TEST_EXPECT_MSG_EQ(guard->GetNDropped(),
+                              rogueApp->GetNSent(),
+                              "The guard must drop all the rogue RAs, and only them");
+    }
+
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup raguard-test
+ * @ingroup tests
+ *
+ * @brief RaGuard TestSuite
+ */
+class RaGuardTestSuite : public TestSuite
+{
+  public:
+    RaGuardTestSuite();
+};
+
+RaGuardTestSuite::RaGuardTestSuite()
+    : TestSuite("ra-guard", Type::UNIT)
+{
+    AddTestCase(new RaGuardTestCase(false), TestCase::Duration::QUICK);
+    AddTestCase(new RaGuardTestCase(true), TestCase::Duration::QUICK);
+}
+
+static RaGuardTestSuite g_raGuardTestSuite; //!< Static variable for test initialization
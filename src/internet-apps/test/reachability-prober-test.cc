@@ -0,0 +1,158 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/data-rate.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4.h"
+#include "ns3/reachability-prober-helper.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * @ingroup reachability-prober
+ * @defgroup reachability-prober-test ReachabilityProber tests
+ */
+
+/**
+ * @ingroup reachability-prober-test
+ * @ingroup tests
+ *
+ * @brief A prober checks two hosts and a missing address; one of the hosts
+ * goes down during the simulation.
+ *
+ * The probes are sent every second, with a timeout of 500 ms.  The second
+ * host goes down at 4.5 s, so its probe sent at 5 s (whichever the batch
+ * size) times out at 5.5 s, and the batch of 6 s reports it unreachable.
+ */
+class ReachabilityProberTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * @param batchSize the BatchSize attribute
+     * @param expected the number of reachable targets reported by each batch
+     */
+    ReachabilityProberTestCase(uint32_t batchSize, std::vector<uint32_t> expected);
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Records the number of reachable targets after a batch.
+     * @param reachable the number of reachable targets
+     * @param total the number of targets
+     */
+    void ReachabilitySink(uint32_t reachable, uint32_t total);
+
+    uint32_t m_batchSize;             //!< Targets probed per batch
+    std::vector<uint32_t> m_expected; //!< Expected reachable targets after each batch
+    std::vector<uint32_t> m_reported; //!< Reachable targets reported after each batch
+    uint32_t m_total{0};              //!< Number of targets reported by the last batch
+};
+
+ReachabilityProberTestCase::ReachabilityProberTestCase(uint32_t batchSize,
+                                                       std::vector<uint32_t> expected)
+    : TestCase("ReachabilityProber with batches of " + std::to_string(batchSize) + " targets"),
+      m_batchSize(batchSize),
+      m_expected(expected)
+{
+}
+
+void
+ReachabilityProberTestCase::ReachabilitySink(uint32_t reachable, uint32_t total)
+{
+    m_reported.push_back(reachable);
+    m_total = total;
+}
+
+void
+ReachabilityProberTestCase::DoRun()
+{
+    NodeContainer nodes;
+    nodes.Create(3);
+
+    SimpleNetDeviceHelper simpleNetDevice;
+    simpleNetDevice.SetChannelAttribute("Delay", TimeValue(MilliSeconds(2)));
+    simpleNetDevice.SetDeviceAttribute("DataRate", DataRateValue(DataRate("5Mbps")));
+    NetDeviceContainer devices = simpleNetDevice.Install(nodes);
+
+    InternetStackHelper internet;
+    internet.Install(nodes);
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    Ipv4InterfaceContainer interfaces = ipv4.Assign(devices);
+
+    ReachabilityProberHelper proberHelper;
+    proberHelper.AddTarget(interfaces.GetAddress(1));
+    proberHelper.AddTarget(interfaces.GetAddress(2));
+    proberHelper.AddTarget(Ipv4Address("10.1.1.99"));
+    proberHelper.SetAttribute("Interval", TimeValue(Seconds(1)));
+    proberHelper.SetAttribute("Timeout", TimeValue(MilliSeconds(500)));
+    proberHelper.SetAttribute("BatchSize", UintegerValue(m_batchSize));
+    ApplicationContainer apps = proberHelper.Install(nodes.Get(0));
+    apps.Start(Seconds(1));
+    apps.Stop(Seconds(9.5));
+    Ptr<ReachabilityProber> prober = DynamicCast<ReachabilityProber>(apps.Get(0));
+    prober->TraceConnectWithoutContext(
+        "Reachability",
+        MakeCallback(&ReachabilityProberTestCase::ReachabilitySink, this));
+
+    Ptr<Ipv4> host2 = nodes.Get(2)->GetObject<Ipv4>();
+    Simulator::Schedule(Seconds(4.5), &Ipv4::SetDown, host2, interfaces.Get(2).second);
+
+    Simulator::Stop(Seconds(10));
+    Simulator::Run();
+
+    NS_TEST_EXPECT_MSG_EQ(m_total, 3, "Wrong number of targets");
+    NS_TEST_ASSERT_MSG_EQ(m_reported.size(), m_expected.size(), "Wrong number of batches");
+    for (std::size_t i = 0; i < m_expected.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(m_reported[i],
+                              m_expected[i],
+                              "Wrong number of reachable targets after batch " << i);
+    }
+    NS_TEST_EXPECT_MSG_EQ(prober->IsReachable(0), true, "The first host is reachable");
+    NS_TEST_EXPECT_MSG_EQ(prober->IsReachable(1), false, "The second host went down");
+    NS_TEST_EXPECT_MSG_EQ(prober->IsReachable(2), false, "The missing host is unreachable");
+    NS_TEST_EXPECT_MSG_EQ_TOL(prober->GetReachableFraction(),
+                              1.0 / 3,
+                              1e-9,
+                              "Wrong fraction of reachable targets");
+
+    Simulator::Destroy();
+}
+
+/**
+ * @ingroup reachability-prober-test
+ * @ingroup tests
+ *
+ * @brief ReachabilityProber TestSuite
+ */
+class ReachabilityProberTestSuite : public TestSuite
+{
+  public:
+    ReachabilityProberTestSuite();
+};
+
+ReachabilityProberTestSuite::ReachabilityProberTestSuite()
+    : TestSuite("reachability-prober", Type::UNIT)
+{
+    // All the targets in each batch: the hosts answer the first batch.
+    AddTestCase(new ReachabilityProberTestCase(0, {0, 2, 2, 2, 2, 1, 1, 1, 1}),
+                TestCase::Duration::QUICK);
+    // One target per batch: the hosts answer the first and second batches.
+    // The second host is probed again at 5 s, and its timeout is detected by
+    // the next batch, which probes the missing address.
+    AddTestCase(new ReachabilityProberTestCase(1, {0, 1, 2, 2, 2, 1, 1, 1, 1}),
+                TestCase::Duration::QUICK);
+}
+
+static ReachabilityProberTestSuite
+    reachabilityProberTestSuite; //!< Static variable for test initialization
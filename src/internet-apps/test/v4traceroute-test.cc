@@ -0,0 +1,149 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/data-rate.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-address-helper.h"
+#include "ns3/ipv4-global-routing-helper.h"
+#include "ns3/output-stream-wrapper.h"
+#include "ns3/simple-net-device-helper.h"
+#include "ns3/test.h"
+#include "ns3/v4traceroute-helper.h"
+#include "ns3/v4traceroute.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * @ingroup v4traceroute
+ * @defgroup v4traceroute-test V4TraceRoute tests
+ */
+
+/**
+ * @ingroup v4traceroute-test
+ * @ingroup tests
+ *
+ * @brief The parallel mode finds the same hops as the serial mode.
+ *
+ * The route goes through two routers: n0 -- r1 -- r2 -- n3.
+ */
+class V4TraceRouteParallelTestCase : public TestCase
+{
+  public:
+    V4TraceRouteParallelTestCase();
+
+  private:
+    void DoRun() override;
+
+    /**
+     * Run a traceroute from n0 to n3.
+     * @param parallel the Parallel attribute
+     * @return the hop of each TTL, "*" if no probe of the TTL is answered
+     */
+    std::vector<std::string> TraceRoute(bool parallel);
+};
+
+V4TraceRouteParallelTestCase::V4TraceRouteParallelTestCase()
+    : TestCase("V4TraceRoute parallel mode finds the hops of the serial mode")
+{
+}
+
+std::vector<std::string>
+V4TraceRouteParallelTestCase::TraceRoute(bool parallel)
+{
+    NodeContainer nodes;
+    nodes.Create(4);
+
+    InternetStackHelper internet;
+    internet.Install(nodes);
+
+    SimpleNetDeviceHelper simpleNetDevice;
+    simpleNetDevice.SetChannelAttribute("Delay", TimeValue(MilliSeconds(2)));
+    simpleNetDevice.SetDeviceAttribute("DataRate", DataRateValue(DataRate("5Mbps")));
+
+    Ipv4AddressHelper ipv4;
+    ipv4.SetBase("10.1.1.0", "255.255.255.0");
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        NetDeviceContainer link =
+            simpleNetDevice.Install(NodeContainer(nodes.Get(i), nodes.Get(i + 1)));
+        ipv4.Assign(link);
+        ipv4.NewNetwork();
+    }
+    Ipv4GlobalRoutingHelper::PopulateRoutingTables();
+
+    V4TraceRouteHelper traceRoute(Ipv4Address("10.1.3.2"));
+    traceRoute.SetAttribute("Verbose", BooleanValue(false));
+    traceRoute.SetAttribute("Parallel", BooleanValue(parallel));
+    traceRoute.SetAttribute("Timeout", TimeValue(Seconds(1)));
+    ApplicationContainer apps = traceRoute.Install(nodes.Get(0));
+    std::ostringstream output;
+    DynamicCast<V4TraceRoute>(apps.Get(0))->Print(Create<OutputStreamWrapper>(&output));
+    apps.Start(Seconds(1));
+    apps.Stop(Seconds(30));
+
+    Simulator::Stop(Seconds(31));
+    Simulator::Run();
+    Simulator::Destroy();
+
+    // Each hop is printed as "<ttl> <address> <rtts>".
+    std::vector<std::string> hops;
+    std::istringstream lines(output.str());
+    std::string line;
+    while (std::getline(lines, line))
+    {
+        std::istringstream fields(line);
+        uint32_t ttl;
+        std::string hop;
+        if (fields >> ttl >> hop)
+        {
+            NS_TEST_EXPECT_MSG_EQ(ttl, hops.size() + 1, "Wrong TTL order in \"" << line << "\"");
+            hops.push_back(hop);
+        }
+    }
+    return hops;
+}
+
+void
+V4TraceRouteParallelTestCase::DoRun()
+{
+    std::vector<std::string> serial = TraceRoute(false);
+    std::vector<std::string> parallel = TraceRoute(true);
+
+    std::vector<std::string> expected{"10.1.1.2", "10.1.2.2", "10.1.3.2"};
+    NS_TEST_ASSERT_MSG_EQ(serial.size(), expected.size(), "Wrong number of hops in serial mode");
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(serial[i], expected[i], "Wrong hop " << i + 1 << " in serial mode");
+    }
+    NS_TEST_ASSERT_MSG_EQ(parallel.size(), serial.size(), "Wrong number of hops in parallel mode");
+    for (std::size_t i = 0; i < serial.size(); i++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(parallel[i], serial[i], "Wrong hop " << i + 1 << " in parallel mode");
+    }
+}
+
+/**
+ * @ingroup v4traceroute-test
+ * @ingroup tests
+ *
+ * @brief V4TraceRoute TestSuite
+ */
+class V4TraceRouteTestSuite : public TestSuite
+{
+  public:
+    V4TraceRouteTestSuite();
+};
+
+V4TraceRouteTestSuite::V4TraceRouteTestSuite()
+    : TestSuite("v4traceroute", Type::UNIT)
+{
+    AddTestCase(new V4TraceRouteParallelTestCase, TestCase::Duration::QUICK);
+}
+
+static V4TraceRouteTestSuite v4TraceRouteTestSuite; //!< Static variable for test initialization
@@ -10,6 +10,7 @@
 #include "ipv4-header.h"
 #include "ipv4-interface.h"
 
+#include "ns3/abort.h"
 #include "ns3/assert.h"
 #include "ns3/log.h"
 #include "ns3/names.h"
@@ -247,6 +248,42 @@ ArpCache::Flush()
     }
 }
 
+void
+ArpCache::SaveCheckpoint(CheckpointWriter& writer) const
+{
+    NS_LOG_FUNCTION(this);
+    uint32_t n = 0;
+    for (const auto& [address, entry] : m_arpCache)
+    {
+        if (!entry->IsWaitReply() && !entry->IsDead())
+        {
+            n++;
+        }
+    }
+    writer.WriteU32(n);
+    for (const auto& [address, entry] : m_arpCache)
+    {
+        if (!entry->IsWaitReply() && !entry->IsDead())
+        {
+            writer.WriteU32(address.Get());
+            entry->SaveCheckpoint(writer);
+        }
+    }
+}
+
+void
+ArpCache::RestoreCheckpoint(CheckpointReader& reader)
+{
+    NS_LOG_FUNCTION(this);
+    Flush();
+    uint32_t n = reader.ReadU32();
+    for (uint32_t i = 0; i < n; i++)
+    {
+        ArpCache::Entry* entry = Add(Ipv4Address(reader.ReadU32()));
+        entry->RestoreCheckpoint(reader);
+    }
+}
+
 void
 ArpCache::PrintArpCache(Ptr<OutputStreamWrapper> stream)
 {
@@ -531,6 +568,32 @@ ArpCache::Entry::GetTimeout() const
     return Time(); // Silence compiler warning
 }
 
+void
+ArpCache::Entry::SaveCheckpoint(CheckpointWriter& writer) const
+{
+    NS_LOG_FUNCTION(this);
+    uint8_t buffer[Address::MAX_SIZE + 2];
+    uint32_t size = m_macAddress.CopyAllTo(buffer, sizeof(buffer));
+    writer.WriteU8(size);
+    writer.Write(buffer, size);
+    writer.WriteU8(m_state);
+    writer.WriteTime(m_lastSeen);
+}
+
+void
+ArpCache::Entry::RestoreCheckpoint(CheckpointReader& reader)
+{
+    NS_LOG_FUNCTION(this);
+    uint8_t buffer[Address::MAX_SIZE + 2];
+    uint8_t size = reader.ReadU8();
+    NS_ABORT_MSG_IF(size > sizeof(buffer), "Invalid MAC address in the checkpoint");
+    reader.Read(buffer, size);
+    m_macAddress.CopyAllFrom(buffer, size);
+    m_state = static_cast<ArpCacheEntryState_e>(reader.ReadU8());
+    m_lastSeen = reader.ReadTime();
+    ClearRetries();
+}
+
 bool
 ArpCache::Entry::IsExpired() const
 {
@@ -10,6 +10,7 @@
 
 #include "ns3/address.h"
 #include "ns3/callback.h"
+#include "ns3/checkpoint.h"
 #include "ns3/ipv4-address.h"
 #include "ns3/net-device.h"
 #include "ns3/nstime.h"
@@ -38,7 +39,7 @@ class Ipv4Header;
  * A cached lookup table for translating layer 3 addresses to layer 2.
  * This implementation does lookups from IPv4 to a MAC address
  */
-class ArpCache : public Object
+class ArpCache : public Object, public Checkpointable
 {
   public:
     /**
@@ -161,6 +162,22 @@ class ArpCache : public Object
      */
     void RemoveAutoGeneratedEntries();
 
+    /**
+     * @brief Save the resolved entries, i.e., the alive, permanent and
+     * auto-generated ones, with the last time they were seen.
+     *
+     * The entries waiting for a reply and the dead ones are not saved.
+     *
+     * @param writer The section of the cache.
+     */
+    void SaveCheckpoint(CheckpointWriter& writer) const override;
+    /**
+     * @brief Replace the entries with the ones saved by SaveCheckpoint().
+     *
+     * @param reader The section of the cache.
+     */
+    void RestoreCheckpoint(CheckpointReader& reader) override;
+
     /**
      * @brief Pair of a packet and an Ipv4 header.
      */
@@ -291,6 +308,20 @@ class ArpCache : public Object
          */
         Time GetTimeout() const;
 
+        /**
+         * @brief Save the MAC address, the state and the last time the entry was seen
+         *
+         * @param writer The section of the ARP cache
+         */
+        void SaveCheckpoint(CheckpointWriter& writer) const;
+
+        /**
+         * @brief Restore the entry saved by SaveCheckpoint()
+         *
+         * @param reader The section of the ARP cache
+         */
+        void RestoreCheckpoint(CheckpointReader& reader);
+
       private:
         /**
          * @brief ARP cache entry states
@@ -17,6 +17,7 @@
 #include "ipv4-route.h"
 #include "loopback-net-device.h"
 
+#include "ns3/abort.h"
 #include "ns3/boolean.h"
 #include "ns3/callback.h"
 #include "ns3/ipv4-address.h"
@@ -31,6 +32,8 @@
 #include "ns3/traffic-control-layer.h"
 #include "ns3/uinteger.h"
 
+#include <algorithm>
+
 namespace ns3
 {
 
@@ -1383,6 +1386,105 @@ Ipv4L3Protocol::GetNetDevice(uint32_t i)
     return GetInterface(i)->GetDevice();
 }
 
+void
+Ipv4L3Protocol::SaveCheckpoint(CheckpointWriter& writer) const
+{
+    NS_LOG_FUNCTION(this);
+    writer.WriteU8(m_ipForward);
+    writer.WriteU32(m_interfaces.size());
+    for (uint32_t i = 0; i < m_interfaces.size(); i++)
+    {
+        writer.WriteU8(IsUp(i));
+        writer.WriteU8(IsForwarding(i));
+        writer.WriteU32(GetMetric(i));
+        writer.WriteU32(GetNAddresses(i));
+        for (uint32_t j = 0; j < GetNAddresses(i); j++)
+        {
+            Ipv4InterfaceAddress address = GetAddress(i, j);
+            writer.WriteU32(address.GetLocal().Get());
+            writer.WriteU32(address.GetMask().Get());
+            writer.WriteU32(address.GetBroadcast().Get());
+            writer.WriteU8(address.GetScope());
+            writer.WriteU8(address.IsSecondary());
+        }
+        Ptr<ArpCache> cache = GetInterface(i)->GetArpCache();
+        writer.WriteU8(cache != nullptr);
+        if (cache)
+        {
+            cache->SaveCheckpoint(writer);
+        }
+    }
+}
+
+void
+Ipv4L3Protocol::RestoreCheckpoint(CheckpointReader& reader)
+{
+    NS_LOG_FUNCTION(this);
+    SetIpForward(reader.ReadU8());
+    uint32_t nInterfaces = reader.ReadU32();
+    NS_ABORT_MSG_IF(nInterfaces != m_interfaces.size(),
+                    "The node has " << m_interfaces.size() << " IPv4 interfaces, the checkpoint "
+                                    << nInterfaces);
+    for (uint32_t i = 0; i < nInterfaces; i++)
+    {
+        bool up = reader.ReadU8();
+        bool forwarding = reader.ReadU8();
+        uint16_t metric = reader.ReadU32();
+        std::vector<Ipv4InterfaceAddress> addresses(reader.ReadU32());
+        for (auto& address : addresses)
+        {
+            address.SetLocal(Ipv4Address(reader.ReadU32()));
+            address.SetMask(Ipv4Mask(reader.ReadU32()));
+            address.SetBroadcast(Ipv4Address(reader.ReadU32()));
+            address.SetScope(
+                static_cast<Ipv4InterfaceAddress::InterfaceAddressScope_e>(reader.ReadU8()));
+            if (reader.ReadU8())
+            {
+                address.SetSecondary();
+            }
+        }
+
+        for (uint32_t j = GetNAddresses(i); j > 0; j--)
+        {
+            if (std::find(addresses.begin(), addresses.end(), GetAddress(i, j - 1)) ==
+                addresses.end())
+            {
+                RemoveAddress(i, j - 1);
+            }
+        }
+        for (const auto& address : addresses)
+        {
+            bool found = false;
+            for (uint32_t j = 0; j < GetNAddresses(i) && !found; j++)
+            {
+                found = GetAddress(i, j) == address;
+            }
+            if (!found)
+            {
+                AddAddress(i, address);
+            }
+        }
+
+        if (up && !IsUp(i))
+        {
+            SetUp(i);
+        }
+        else if (!up && IsUp(i))
+        {
+            SetDown(i);
+        }
+        SetForwarding(i, forwarding);
+        SetMetric(i, metric);
+
+        if (reader.ReadU8())
+        {
+            Ptr<ArpCache> cache = GetInterface(i)->GetArpCache();
+            NS_ABORT_MSG_UNLESS(cache, "No ARP cache on IPv4 interface " << i);
+            cache->RestoreCheckpoint(reader);
+        }
+    }
+}
+
 void
 Ipv4L3Protocol::SetIpForward(bool forward)
 {
@@ -13,6 +13,7 @@
 #include "ipv4-routing-protocol.h"
 #include "ipv4.h"
 
+#include "ns3/checkpoint.h"
 #include "ns3/deprecated.h"
 #include "ns3/ipv4-address.h"
 #include "ns3/net-device.h"
@@ -69,7 +70,7 @@ class Icmpv4L4Protocol;
  * kernel. Hence it is not possible, for instance, to test a fragmentation
  * attack.
  */
-class Ipv4L3Protocol : public Ipv4
+class Ipv4L3Protocol : public Ipv4, public Checkpointable
 {
   public:
     /**
@@ -214,6 +215,24 @@ class Ipv4L3Protocol : public Ipv4
 
     Ptr<NetDevice> GetNetDevice(uint32_t i) override;
 
+    /**
+     * @brief Save the forwarding mode and the state of the interfaces: their
+     * addresses, up or down state, forwarding mode, metric and ARP cache.
+     *
+     * @param writer the section of the protocol
+     */
+    void SaveCheckpoint(CheckpointWriter& writer) const override;
+
+    /**
+     * @brief Restore the state saved by SaveCheckpoint().
+     *
+     * The node must have the same interfaces as the checkpointed one.  The
+     * addresses not in the checkpoint are removed, and the missing ones added.
+     *
+     * @param reader the section of the protocol
+     */
+    void RestoreCheckpoint(CheckpointReader& reader) override;
+
     /**
      * @brief Check if an IPv4 address is unicast according to the node.
      *
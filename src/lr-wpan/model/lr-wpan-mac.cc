@@ -2930,7 +2930,7 @@ LrWpanMac::DequeueInd(Mac64Address dst, Ptr<IndTxQueueElement> entry)
         if ((*iter)->dstExtAddress == dst)
         {
             *entry = **iter;
-            m_macIndTxDequeueTrace((*iter)->txQPkt->Copy());
+            NS_TRACE(m_macIndTxDequeueTrace, (*iter)->txQPkt->Copy());
             m_indTxQueue.erase(iter);
             return true;
         }
@@ -2974,7 +2974,7 @@ LrWpanMac::PurgeInd()
                     m_mcpsDataConfirmCallback(confParams);
                 }
             }
-            m_macIndTxDropTrace(m_indTxQueue[i]->txQPkt->Copy());
+            NS_TRACE(m_macIndTxDropTrace, m_indTxQueue[i]->txQPkt->Copy());
             m_indTxQueue.erase(m_indTxQueue.begin() + i);
         }
         else
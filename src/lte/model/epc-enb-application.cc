@@ -277,7 +277,7 @@ EpcEnbApplication::RecvFromLteSocket(Ptr<Socket> socket)
         auto bidIt = rntiIt->second.find(bid);
         NS_ASSERT(bidIt != rntiIt->second.end());
         uint32_t teid = bidIt->second;
-        m_rxLteSocketPktTrace(packet->Copy());
+        NS_TRACE(m_rxLteSocketPktTrace, packet->Copy());
         SendToS1uSocket(packet, teid);
     }
 }
@@ -299,7 +299,7 @@ EpcEnbApplication::RecvFromS1uSocket(Ptr<Socket> socket)
     }
     else
     {
-        m_rxS1uSocketPktTrace(packet->Copy());
+        NS_TRACE(m_rxS1uSocketPktTrace, packet->Copy());
         SendToLteSocket(packet, it->second.m_rnti, it->second.m_bid);
     }
 }
@@ -161,7 +161,7 @@ EpcPgwApplication::RecvFromTunDevice(Ptr<Packet> packet,
                                      uint16_t protocolNumber)
 {
     NS_LOG_FUNCTION(this << source << dest << protocolNumber << packet << packet->GetSize());
-    m_rxTunPktTrace(packet->Copy());
+    NS_TRACE(m_rxTunPktTrace, packet->Copy());
 
     // get IP address of UE
     if (protocolNumber == Ipv4L3Protocol::PROT_NUMBER)
@@ -236,7 +236,7 @@ EpcPgwApplication::RecvFromS5uSocket(Ptr<Socket> socket)
     NS_LOG_FUNCTION(this << socket);
     NS_ASSERT(socket == m_s5uSocket);
     Ptr<Packet> packet = socket->Recv();
-    m_rxS5PktTrace(packet->Copy());
+    NS_TRACE(m_rxS5PktTrace, packet->Copy());
 
     GtpuHeader gtpu;
     packet->RemoveHeader(gtpu);
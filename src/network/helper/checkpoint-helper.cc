@@ -0,0 +1,109 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "checkpoint-helper.h"
+
+#include "ns3/application.h"
+#include "ns3/log.h"
+#include "ns3/net-device.h"
+#include "ns3/nstime.h"
+#include "ns3/simulator.h"
+
+#include <functional>
+#include <sstream>
+
+namespace ns3
+{
+
+NS_LOG_COMPONENT_DEFINE("CheckpointHelper");
+
+/**
+ * Call a function for each checkpointable net device, aggregated object and
+ * application of a node, in this order.
+ *
+ * @param node The node.
+ * @param f The function, called with the section name and the object.
+ */
+static void
+ForEachCheckpointable(Ptr<Node> node,
+                      std::function<void(const std::string&, Checkpointable&)> f)
+{
+    std::ostringstream path;
+    path << "/NodeList/" << node->GetId() << "/";
+    for (uint32_t i = 0; i < node->GetNDevices(); i++)
+    {
+        if (auto object = dynamic_cast<Checkpointable*>(PeekPointer(node->GetDevice(i))))
+        {
+            f(path.str() + "DeviceList/" + std::to_string(i), *object);
+        }
+    }
+    Object::AggregateIterator aggregates = node->GetAggregateIterator();
+    while (aggregates.HasNext())
+    {
+        auto aggregate = const_cast<Object*>(PeekPointer(aggregates.Next()));
+        if (auto object = dynamic_cast<Checkpointable*>(aggregate))
+        {
+            f(path.str() + "$" + aggregate->GetInstanceTypeId().GetName(), *object);
+        }
+    }
+    for (uint32_t i = 0; i < node->GetNApplications(); i++)
+    {
+        if (auto object = dynamic_cast<Checkpointable*>(PeekPointer(node->GetApplication(i))))
+        {
+            f(path.str() + "ApplicationList/" + std::to_string(i), *object);
+        }
+    }
+}
+
+void
+CheckpointHelper::Save(Checkpoint& checkpoint, NodeContainer c) const
+{
+    for (auto i = c.Begin(); i != c.End(); ++i)
+    {
+        ForEachCheckpointable(*i, [&checkpoint](const std::string& name, Checkpointable& object) {
+            NS_LOG_LOGIC("Save " << name);
+            checkpoint.Add(name, object);
+        });
+    }
+}
+
+void
+CheckpointHelper::Restore(const Checkpoint& checkpoint, NodeContainer c) const
+{
+    NS_ASSERT_MSG(Simulator::Now() == checkpoint.GetTime(),
+                  "Simulator::SetStartTime() was not called with the checkpoint time");
+    Time time = checkpoint.GetTime();
+    for (auto i = c.Begin(); i != c.End(); ++i)
+    {
+        ForEachCheckpointable(*i, [&checkpoint](const std::string& name, Checkpointable& object) {
+            if (checkpoint.Has(name))
+            {
+                NS_LOG_LOGIC("Restore " << name);
+                checkpoint.Restore(name, object);
+            }
+        });
+
+        for (uint32_t j = 0; j < (*i)->GetNApplications(); j++)
+        {
+            Ptr<Application> application = (*i)->GetApplication(j);
+            TimeValue start;
+            TimeValue stop;
+            application->GetAttribute("StartTime", start);
+            application->GetAttribute("StopTime", stop);
+            if (stop.Get().IsStrictlyPositive() && stop.Get() <= time)
+            {
+                application->SetStartTime(Seconds(0));
+                application->SetStopTime(TimeStep(1));
+                continue;
+            }
+            application->SetStartTime(Max(start.Get() - time, Seconds(0)));
+            if (stop.Get().IsStrictlyPositive())
+            {
+                application->SetStopTime(stop.Get() - time);
+            }
+        }
+    }
+}
+
+} // namespace ns3
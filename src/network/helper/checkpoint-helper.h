@@ -0,0 +1,70 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef CHECKPOINT_HELPER_H
+#define CHECKPOINT_HELPER_H
+
+#include "node-container.h"
+
+#include "ns3/checkpoint.h"
+
+namespace ns3
+{
+
+/**
+ * @ingroup checkpoint
+ * @brief Save and restore the state of the nodes in a Checkpoint.
+ *
+ * The net devices, the objects aggregated to the nodes and the
+ * applications which implement ns3::Checkpointable are saved in sections
+ * named after their configuration path, e.g.,
+ * \c /NodeList/3/$ns3::Ipv4L3Protocol or \c /NodeList/3/ApplicationList/0,
+ * so that they are found again when the process restoring the checkpoint
+ * builds the same scenario.
+ *
+ * @code
+ *   // Process saving the state at 100 s
+ *   Simulator::Stop(Seconds(100));
+ *   Simulator::Run();
+ *   Checkpoint checkpoint;
+ *   CheckpointHelper().Save(checkpoint);
+ *   checkpoint.Save("warm.ckpt");
+ *
+ *   // Process restoring it
+ *   Checkpoint checkpoint = Checkpoint::Load("warm.ckpt");
+ *   Simulator::SetStartTime(checkpoint.GetTime());
+ *   // ... build the scenario ...
+ *   CheckpointHelper().Restore(checkpoint);
+ *   Simulator::Run();
+ * @endcode
+ */
+class CheckpointHelper
+{
+  public:
+    /**
+     * Save the state of the nodes.
+     *
+     * @param checkpoint The checkpoint in which the state is saved.
+     * @param c The nodes, by default all of them.
+     */
+    void Save(Checkpoint& checkpoint, NodeContainer c = NodeContainer::GetGlobal()) const;
+
+    /**
+     * Restore the state of the nodes, before running the simulation.
+     *
+     * The start and stop times of all the applications of the nodes are
+     * shifted by the checkpoint time, so that they stay the times set when
+     * building the scenario: the applications running at the checkpoint
+     * time start at once, and the ones already stopped start and stop at
+     * once.
+     *
+     * @param checkpoint The checkpoint holding the state.
+     * @param c The nodes, by default all of them.
+     */
+    void Restore(const Checkpoint& checkpoint, NodeContainer c = NodeContainer::GetGlobal()) const;
+};
+
+} // namespace ns3
+
+#endif /* CHECKPOINT_HELPER_H */
@@ -0,0 +1,326 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/config.h"
+#include "ns3/multithreaded-simulator-impl.h"
+#include "ns3/node.h"
+#include "ns3/nstime.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/string.h"
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * @brief Check that MultithreadedSimulatorImpl executes the events of each
+ * context at the same times as DefaultSimulatorImpl.
+ *
+ * Each context forwards tokens to two other contexts, with a delay not
+ * shorter than the lookahead, and records the times at which it receives
+ * them.
+ */
+class MultithreadedSimulatorTraceTestCase : public TestCase
+{
+  public:
+    /**
+     * Constructor.
+     * @param threads The number of threads.
+     */
+    MultithreadedSimulatorTraceTestCase(uint32_t threads);
+
+  private:
+    void DoRun() override;
+    void DoTeardown() override;
+
+    /// Times at which each context received a token
+    using Traces = std::vector<std::vector<int64_t>>;
+
+    /**
+     * Run the token exchange.
+     * @param simulatorType The simulator implementation.
+     * @returns The traces of the contexts.
+     */
+    Traces RunSimulation(const std::string& simulatorType);
+
+    /**
+     * Receive a token, and forward it to two other contexts.
+     * @param hops The number of hops of the token so far.
+     */
+    void Receive(uint32_t hops);
+
+    static constexpr uint32_t N_CONTEXTS = 16; //!< Number of contexts
+    static constexpr uint32_t MAX_HOPS = 8;    //!< Hops after which a token is dropped
+
+    uint32_t m_threads; //!< Number of threads
+    Traces m_traces;    //!< Times at which each context received a token
+};
+
+MultithreadedSimulatorTraceTestCase::MultithreadedSimulatorTraceTestCase(uint32_t threads)
+    : TestCase("Check the event times of the contexts with " + std::to_string(threads) +
+               " threads"),
+      m_threads(threads)
+{
+}
+
+void
+MultithreadedSimulatorTraceTestCase::Receive(uint32_t hops)
+{
+    uint32_t context = Simulator::GetContext();
+    m_traces[context].push_back(Simulator::Now().GetTimeStep());
+    if (hops == MAX_HOPS)
+    {
+        return;
+    }
+    // Distinct delays per context, never shorter than the lookahead.
+    Time delay = MicroSeconds(100 + 7 * context + hops);
+    Simulator::ScheduleWithContext((context + 1) % N_CONTEXTS,
+                                   delay,
+                                   &MultithreadedSimulatorTraceTestCase::Receive,
+                                   this,
+                                   hops + 1);
+    Simulator::ScheduleWithContext((3 * context + 5) % N_CONTEXTS,
+                                   delay + MicroSeconds(13),
+                                   &MultithreadedSimulatorTraceTestCase::Receive,
+                                   this,
+                                   hops + 1);
+}
+
+MultithreadedSimulatorTraceTestCase::Traces
+MultithreadedSimulatorTraceTestCase::RunSimulation(const std::string& simulatorType)
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue(simulatorType));
+    Ptr<SimulatorImpl> impl = Simulator::GetImplementation();
+    if (auto multithreaded = DynamicCast<MultithreadedSimulatorImpl>(impl))
+    {
+        multithreaded->SetAttribute("Threads", UintegerValue(m_threads));
+        multithreaded->SetAttribute("Lookahead", TimeValue(MicroSeconds(100)));
+    }
+
+    m_traces.assign(N_CONTEXTS, {});
+    for (uint32_t context = 0; context < N_CONTEXTS; context += 3)
+    {
+        Simulator::ScheduleWithContext(context,
+                                       MicroSeconds(context),
+                                       &MultithreadedSimulatorTraceTestCase::Receive,
+                                       this,
+                                       0);
+    }
+    Simulator::Stop(MilliSeconds(1));
+    Simulator::Run();
+    NS_TEST_EXPECT_MSG_EQ(Simulator::Now(), MilliSeconds(1), "Simulation stopped at wrong time");
+    Simulator::Destroy();
+    return m_traces;
+}
+
+void
+MultithreadedSimulatorTraceTestCase::DoRun()
+{
+    Traces expected = RunSimulation("ns3::DefaultSimulatorImpl");
+    Traces actual = RunSimulation("ns3::MultithreadedSimulatorImpl");
+    for (uint32_t context = 0; context < N_CONTEXTS; context++)
+    {
+        NS_TEST_ASSERT_MSG_EQ(actual[context].size(),
+                              expected[context].size(),
+                              "Wrong number of events in context " << context);
+        for (std::size_t i = 0; i < expected[context].size(); i++)
+        {
+            NS_TEST_EXPECT_MSG_EQ(actual[context][i],
+                                  expected[context][i],
+                                  "Wrong time of event " << i << " in context " << context);
+        }
+    }
+}
+
+void
+MultithreadedSimulatorTraceTestCase::DoTeardown()
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+}
+
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * @brief Check the lookahead derived from the channel delays.
+ */
+class MultithreadedSimulatorLookaheadTestCase : public TestCase
+{
+  public:
+    MultithreadedSimulatorLookaheadTestCase();
+
+  private:
+    void DoRun() override;
+    void DoTeardown() override;
+};
+
+MultithreadedSimulatorLookaheadTestCase::MultithreadedSimulatorLookaheadTestCase()
+    : TestCase("Check the lookahead derived from the channel delays")
+{
+}
+
+void
+MultithreadedSimulatorLookaheadTestCase::DoRun()
+{
+    Config::SetGlobal("SimulatorImplementationType",
+                      StringValue("ns3::MultithreadedSimulatorImpl"));
+    auto impl = DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    NS_TEST_ASSERT_MSG_NE(impl, nullptr, "Wrong simulator implementation");
+    impl->SetAttribute("Threads", UintegerValue(2));
+
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookahead(), Time::Max(), "Lookahead without channel");
+
+    // Connect two nodes with a channel, and return the channel.
+    auto connect = [](Time delay) {
+        Ptr<SimpleChannel> channel = CreateObject<SimpleChannel>();
+        channel->SetAttribute("Delay", TimeValue(delay));
+        for (uint32_t i = 0; i < 2; i++)
+        {
+            Ptr<Node> node = CreateObject<Node>();
+            Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice>();
+            node->AddDevice(device);
+            device->SetChannel(channel);
+        }
+        return channel;
+    };
+
+    // The nodes of a channel are in the same logical process, unless they
+    // are assigned to different ones: nodes 0 and 1, then nodes 2 and 3.
+    connect(MicroSeconds(30));
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookahead(), Time::Max(), "Channel in a single process");
+    for (uint32_t node = 0; node < 4; node++)
+    {
+        impl->AssignContext(node, node % 2);
+    }
+    connect(MicroSeconds(20));
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookahead(), MicroSeconds(20), "Smallest channel delay");
+
+    // Nodes 4 and 5 are in the same logical process.
+    connect(MicroSeconds(10));
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookahead(), MicroSeconds(20), "Channel in a single process");
+
+    impl->SetAttribute("Lookahead", TimeValue(MicroSeconds(5)));
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookahead(), MicroSeconds(5), "Lookahead attribute");
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+void
+MultithreadedSimulatorLookaheadTestCase::DoTeardown()
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+}
+
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * @brief Check the partition of the nodes in logical processes.
+ */
+class MultithreadedSimulatorPartitionTestCase : public TestCase
+{
+  public:
+    MultithreadedSimulatorPartitionTestCase();
+
+  private:
+    void DoRun() override;
+    void DoTeardown() override;
+};
+
+MultithreadedSimulatorPartitionTestCase::MultithreadedSimulatorPartitionTestCase()
+    : TestCase("Check the partition of the nodes sharing a channel")
+{
+}
+
+void
+MultithreadedSimulatorPartitionTestCase::DoRun()
+{
+    Config::SetGlobal("SimulatorImplementationType",
+                      StringValue("ns3::MultithreadedSimulatorImpl"));
+    auto impl = DynamicCast<MultithreadedSimulatorImpl>(Simulator::GetImplementation());
+    NS_TEST_ASSERT_MSG_NE(impl, nullptr, "Wrong simulator implementation");
+    impl->SetAttribute("Threads", UintegerValue(3));
+
+    // Connect new nodes to a shared channel.
+    auto connect = [](uint32_t nNodes) {
+        Ptr<SimpleChannel> channel = CreateObject<SimpleChannel>();
+        channel->SetAttribute("Delay", TimeValue(MicroSeconds(10)));
+        for (uint32_t i = 0; i < nNodes; i++)
+        {
+            Ptr<Node> node = CreateObject<Node>();
+            Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice>();
+            node->AddDevice(device);
+            device->SetChannel(channel);
+        }
+    };
+
+    // Nodes 0 to 3, 4 and 5, and 6 share three channels; node 7 has none.
+    connect(4);
+    connect(2);
+    connect(1);
+    CreateObject<Node>();
+    for (uint32_t node = 1; node < 4; node++)
+    {
+        NS_TEST_EXPECT_MSG_EQ(impl->GetLogicalProcess(node),
+                              impl->GetLogicalProcess(0),
+                              "Node " << node << " not with the other nodes of its channel");
+    }
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLogicalProcess(5),
+                          impl->GetLogicalProcess(4),
+                          "Node 5 not with the other node of its channel");
+    // The largest groups go first to the least loaded logical processes.
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLogicalProcess(0), 0, "Wrong process of nodes 0 to 3");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLogicalProcess(4), 1, "Wrong process of nodes 4 and 5");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLogicalProcess(6), 2, "Wrong process of node 6");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLogicalProcess(7), 2, "Wrong process of node 7");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLookahead(), Time::Max(), "No channel between processes");
+
+    // The nodes of a channel follow the assigned node.
+    impl->AssignContext(5, 2);
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLogicalProcess(4), 2, "Node 4 did not follow node 5");
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLogicalProcess(0), 0, "Wrong process of nodes 0 to 3");
+
+    // A context which is not a node.
+    NS_TEST_EXPECT_MSG_EQ(impl->GetLogicalProcess(100), 100 % 3, "Wrong process of context");
+
+    Simulator::Run();
+    Simulator::Destroy();
+}
+
+void
+MultithreadedSimulatorPartitionTestCase::DoTeardown()
+{
+    Config::SetGlobal("SimulatorImplementationType", StringValue("ns3::DefaultSimulatorImpl"));
+}
+
+/**
+ * @ingroup network-test
+ * @ingroup tests
+ *
+ * @brief MultithreadedSimulatorImpl TestSuite
+ */
+class MultithreadedSimulatorTestSuite : public TestSuite
+{
+  public:
+    MultithreadedSimulatorTestSuite()
+        : TestSuite("multithreaded-simulator", Type::UNIT)
+    {
+        AddTestCase(new MultithreadedSimulatorTraceTestCase(1), TestCase::Duration::QUICK);
+        AddTestCase(new MultithreadedSimulatorTraceTestCase(2), TestCase::Duration::QUICK);
+        AddTestCase(new MultithreadedSimulatorTraceTestCase(4), TestCase::Duration::QUICK);
+        AddTestCase(new MultithreadedSimulatorLookaheadTestCase(), TestCase::Duration::QUICK);
+        AddTestCase(new MultithreadedSimulatorPartitionTestCase(), TestCase::Duration::QUICK);
+    }
+};
+
+static MultithreadedSimulatorTestSuite
+    g_multithreadedSimulatorTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,740 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "multithreaded-simulator-impl.h"
+
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+#include "ns3/channel-list.h"
+#include "ns3/channel.h"
+#include "ns3/log.h"
+#include "ns3/net-device.h"
+#include "ns3/node-list.h"
+#include "ns3/node.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+
+#include <algorithm>
+#include <barrier>
+#include <map>
+#include <numeric>
+#include <set>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::MultithreadedSimulatorImpl implementation.
+ */
+
+namespace ns3
+{
+
+// Note:  Logging in this file is largely avoided due to the
+// number of calls that are made to these functions, from several threads.
+NS_LOG_COMPONENT_DEFINE("MultithreadedSimulatorImpl");
+
+NS_OBJECT_ENSURE_REGISTERED(MultithreadedSimulatorImpl);
+
+namespace
+{
+/** The logical process executed by the calling thread, during Run(). */
+thread_local void* t_current = nullptr;
+} // namespace
+
+TypeId
+MultithreadedSimulatorImpl::GetTypeId()
+{
+    static TypeId tid =
+        TypeId("ns3::MultithreadedSimulatorImpl")
+            .SetParent<SimulatorImpl>()
+            .SetGroupName("Network")
+            .AddConstructor<MultithreadedSimulatorImpl>()
+            .AddAttribute("Threads",
+                          "The number of threads, i.e., of logical processes.",
+                          UintegerValue(std::max(1U, std::thread::hardware_concurrency())),
+                          MakeUintegerAccessor(&MultithreadedSimulatorImpl::m_nThreads),
+                          MakeUintegerChecker<uint32_t>(1))
+            .AddAttribute("Lookahead",
+                          "The minimum delay of the events scheduled between contexts of "
+                          "different logical processes; zero to derive it from the delay of "
+                          "the channels.",
+                          TimeValue(Time(0)),
+                          MakeTimeAccessor(&MultithreadedSimulatorImpl::m_lookaheadAttribute),
+                          MakeTimeChecker(Time(0)));
+    return tid;
+}
+
+MultithreadedSimulatorImpl::MultithreadedSimulatorImpl()
+    : m_nThreads(std::max(1U, std::thread::hardware_concurrency())),
+      m_partitionNodes(0),
+      m_partitionChannels(0),
+      m_partitionThreads(0),
+      m_partitionKept(false),
+      m_currentTs(0),
+      m_windowEnd(0),
+      m_lookahead(0),
+      m_stopTs(UINT64_MAX),
+      m_stop(false),
+      m_finished(false)
+{
+    NS_LOG_FUNCTION(this);
+    m_schedulerFactory.SetTypeId("ns3::MapScheduler");
+}
+
+MultithreadedSimulatorImpl::~MultithreadedSimulatorImpl()
+{
+    NS_LOG_FUNCTION(this);
+}
+
+void
+MultithreadedSimulatorImpl::DoDispose()
+{
+    NS_LOG_FUNCTION(this);
+    for (auto& lp : m_lps)
+    {
+        for (const auto& remote : lp->inbox)
+        {
+            remote.event->Unref();
+        }
+        lp->inbox.clear();
+        while (!lp->events->IsEmpty())
+        {
+            Scheduler::Event next = lp->events->RemoveNext();
+            next.impl->Unref();
+        }
+        lp->events = nullptr;
+    }
+    m_lps.clear();
+    SimulatorImpl::DoDispose();
+}
+
+void
+MultithreadedSimulatorImpl::Destroy()
+{
+    NS_LOG_FUNCTION(this);
+    while (!m_destroyEvents.empty())
+    {
+        Ptr<EventImpl> ev = m_destroyEvents.front().PeekEventImpl();
+        m_destroyEvents.pop_front();
+        NS_LOG_LOGIC("handle destroy " << ev);
+        if (!ev->IsCancelled())
+        {
+            ev->Invoke();
+        }
+    }
+}
+
+void
+MultithreadedSimulatorImpl::CreateLogicalProcesses()
+{
+    if (!m_lps.empty())
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this << m_nThreads);
+    for (uint32_t i = 0; i < m_nThreads; i++)
+    {
+        auto lp = std::make_unique<LogicalProcess>();
+        lp->events = m_schedulerFactory.Create<Scheduler>();
+        lp->currentContext = Simulator::NO_CONTEXT;
+        lp->currentUid = EventId::UID::INVALID;
+        lp->uid = EventId::UID::VALID;
+        m_lps.push_back(std::move(lp));
+    }
+}
+
+void
+MultithreadedSimulatorImpl::SetScheduler(ObjectFactory schedulerFactory)
+{
+    NS_LOG_FUNCTION(this << schedulerFactory);
+    m_schedulerFactory = schedulerFactory;
+    for (auto& lp : m_lps)
+    {
+        Ptr<Scheduler> scheduler = schedulerFactory.Create<Scheduler>();
+        while (!lp->events->IsEmpty())
+        {
+            scheduler->Insert(lp->events->RemoveNext());
+        }
+        lp->events = scheduler;
+    }
+}
+
+void
+MultithreadedSimulatorImpl::AssignContext(uint32_t context, uint32_t lp)
+{
+    NS_LOG_FUNCTION(this << context << lp);
+    NS_ABORT_MSG_IF(lp >= m_nThreads, "Invalid logical process " << lp);
+    NS_ABORT_MSG_IF(m_partitionKept, "Contexts must be assigned before Run()");
+    if (m_assignedContexts.size() <= context)
+    {
+        m_assignedContexts.resize(context + 1, UINT32_MAX);
+    }
+    m_assignedContexts[context] = lp;
+    // the groups of nodes follow their assigned nodes
+    m_partitionThreads = 0;
+}
+
+void
+MultithreadedSimulatorImpl::UpdatePartition() const
+{
+    if (m_partitionKept)
+    {
+        return;
+    }
+    uint32_t nNodes = NodeList::GetNNodes();
+    uint32_t nChannels = ChannelList::GetNChannels();
+    if (nNodes == m_partitionNodes && nChannels == m_partitionChannels &&
+        m_nThreads == m_partitionThreads)
+    {
+        return;
+    }
+    NS_LOG_FUNCTION(this << nNodes << nChannels << m_nThreads);
+    m_partitionNodes = nNodes;
+    m_partitionChannels = nChannels;
+    m_partitionThreads = m_nThreads;
+
+    // Group the nodes connected by channels other than point-to-point links.
+    std::vector<uint32_t> group(nNodes);
+    std::iota(group.begin(), group.end(), 0);
+    auto find = [&group](uint32_t node) {
+        while (group[node] != node)
+        {
+            group[node] = group[group[node]];
+            node = group[node];
+        }
+        return node;
+    };
+    TypeId pointToPoint;
+    bool hasPointToPoint = TypeId::LookupByNameFailSafe("ns3::PointToPointChannel", &pointToPoint);
+    for (auto it = ChannelList::Begin(); it != ChannelList::End(); ++it)
+    {
+        Ptr<Channel> channel = *it;
+        TypeId tid = channel->GetInstanceTypeId();
+        if (hasPointToPoint && (tid == pointToPoint || tid.IsChildOf(pointToPoint)))
+        {
+            continue;
+        }
+        uint32_t first = UINT32_MAX;
+        for (std::size_t i = 0; i < channel->GetNDevices(); i++)
+        {
+            Ptr<NetDevice> device = channel->GetDevice(i);
+            if (!device || !device->GetNode())
+            {
+                continue;
+            }
+            uint32_t root = find(device->GetNode()->GetId());
+            if (first == UINT32_MAX)
+            {
+                first = root;
+            }
+            else
+            {
+                group[root] = find(first);
+            }
+        }
+    }
+    std::map<uint32_t, std::vector<uint32_t>> groups;
+    for (uint32_t node = 0; node < nNodes; node++)
+    {
+        groups[find(node)].push_back(node);
+    }
+
+    // The groups holding an assigned node follow it; the other groups go,
+    // by decreasing size, to the logical process with the fewest nodes.
+    m_partition.assign(nNodes, 0);
+    std::vector<uint32_t> load(m_nThreads, 0);
+    std::vector<const std::vector<uint32_t>*> unassigned;
+    for (const auto& [root, nodes] : groups)
+    {
+        auto assigned = std::find_if(nodes.begin(), nodes.end(), [this](uint32_t node) {
+            return node < m_assignedContexts.size() && m_assignedContexts[node] != UINT32_MAX;
+        });
+        if (assigned == nodes.end())
+        {
+            unassigned.push_back(&nodes);
+            continue;
+        }
+        for (auto node : nodes)
+        {
+            m_partition[node] = m_assignedContexts[*assigned];
+            load[m_partition[node]]++;
+        }
+    }
+    std::stable_sort(unassigned.begin(), unassigned.end(), [](const auto* a, const auto* b) {
+        return a->size() > b->size();
+    });
+    for (const auto* nodes : unassigned)
+    {
+        auto lp = static_cast<uint32_t>(std::min_element(load.begin(), load.end()) - load.begin());
+        for (auto node : *nodes)
+        {
+            m_partition[node] = lp;
+        }
+        load[lp] += nodes->size();
+    }
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetLogicalProcess(uint32_t context) const
+{
+    if (context == Simulator::NO_CONTEXT)
+    {
+        return 0;
+    }
+    if (context < m_assignedContexts.size() && m_assignedContexts[context] != UINT32_MAX)
+    {
+        return m_assignedContexts[context];
+    }
+    UpdatePartition();
+    if (context < m_partition.size())
+    {
+        return m_partition[context];
+    }
+    return context % m_nThreads;
+}
+
+Time
+MultithreadedSimulatorImpl::GetLookahead() const
+{
+    NS_LOG_FUNCTION(this);
+    if (!m_lookaheadAttribute.IsZero())
+    {
+        return m_lookaheadAttribute;
+    }
+
+    Time lookahead = Time::Max();
+    for (auto it = ChannelList::Begin(); it != ChannelList::End(); ++it)
+    {
+        Ptr<Channel> channel = *it;
+        std::set<uint32_t> lps;
+        for (std::size_t i = 0; i < channel->GetNDevices(); i++)
+        {
+            lps.insert(GetLogicalProcess(channel->GetDevice(i)->GetNode()->GetId()));
+        }
+        if (lps.size() < 2)
+        {
+            continue;
+        }
+        TypeId::AttributeInformation info;
+        if (!channel->GetInstanceTypeId().LookupAttributeByName("Delay", &info))
+        {
+            NS_LOG_WARN("Channel " << channel->GetId() << " ("
+                                   << channel->GetInstanceTypeId().GetName()
+                                   << ") has no Delay attribute, no lookahead");
+            return Time(0);
+        }
+        TimeValue delay;
+        channel->GetAttribute("Delay", delay);
+        lookahead = std::min(lookahead, delay.Get());
+    }
+    return lookahead;
+}
+
+MultithreadedSimulatorImpl::LogicalProcess*
+MultithreadedSimulatorImpl::GetCurrent() const
+{
+    return static_cast<LogicalProcess*>(t_current);
+}
+
+MultithreadedSimulatorImpl::LogicalProcess&
+MultithreadedSimulatorImpl::GetScheduling()
+{
+    LogicalProcess* current = GetCurrent();
+    if (current)
+    {
+        return *current;
+    }
+    CreateLogicalProcesses();
+    return *m_lps[GetLogicalProcess(Simulator::NO_CONTEXT)];
+}
+
+Scheduler::EventKey
+MultithreadedSimulatorImpl::Insert(LogicalProcess& lp,
+                                   uint32_t context,
+                                   uint64_t ts,
+                                   EventImpl* event)
+{
+    Scheduler::Event ev;
+    ev.impl = event;
+    ev.key.m_ts = ts;
+    ev.key.m_context = context;
+    ev.key.m_uid = lp.uid;
+    lp.uid++;
+    lp.unscheduledEvents++;
+    lp.events->Insert(ev);
+    return ev.key;
+}
+
+void
+MultithreadedSimulatorImpl::ProcessInboxes()
+{
+    for (auto& lp : m_lps)
+    {
+        std::unique_lock lock{lp->inboxMutex};
+        for (const auto& remote : lp->inbox)
+        {
+            // The events scheduled outside Run() are all in the first inbox.
+            LogicalProcess& target = *m_lps[GetLogicalProcess(remote.context)];
+            NS_ABORT_MSG_IF(remote.ts < target.currentTs,
+                            "Event scheduled for context "
+                                << remote.context << " at " << TimeStep(remote.ts)
+                                << ", before the current time of its logical process "
+                                << TimeStep(target.currentTs));
+            Insert(target, remote.context, remote.ts, remote.event);
+        }
+        lp->inbox.clear();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::ProcessWindow(LogicalProcess& lp)
+{
+    t_current = &lp;
+    while (!lp.stop && !lp.events->IsEmpty() && lp.events->PeekNext().key.m_ts < m_windowEnd)
+    {
+        Scheduler::Event next = lp.events->RemoveNext();
+
+        PreEventHook(EventId(next.impl, next.key.m_ts, next.key.m_context, next.key.m_uid));
+
+        NS_ASSERT(next.key.m_ts >= lp.currentTs);
+        lp.unscheduledEvents--;
+        lp.eventCount++;
+
+        lp.currentTs = next.key.m_ts;
+        lp.currentContext = next.key.m_context;
+        lp.currentUid = next.key.m_uid;
+        next.impl->Invoke();
+        next.impl->Unref();
+    }
+    lp.currentContext = Simulator::NO_CONTEXT;
+    t_current = nullptr;
+}
+
+void
+MultithreadedSimulatorImpl::WorkerThread(uint32_t index, std::barrier<>& barrier)
+{
+    while (true)
+    {
+        // start of the window
+        barrier.arrive_and_wait();
+        if (m_finished)
+        {
+            return;
+        }
+        ProcessWindow(*m_lps[index]);
+        // end of the window
+        barrier.arrive_and_wait();
+    }
+}
+
+void
+MultithreadedSimulatorImpl::Run()
+{
+    NS_LOG_FUNCTION(this);
+    CreateLogicalProcesses();
+    // The events of the contexts are inserted in the event lists of their
+    // logical processes from now on, so the partition can no longer change.
+    UpdatePartition();
+    m_partitionKept = true;
+    Time lookahead = GetLookahead();
+    m_lookahead = lookahead.IsStrictlyPositive() ? lookahead.GetTimeStep() : 0;
+    NS_LOG_INFO("Run " << m_lps.size() << " logical processes, lookahead " << lookahead);
+
+    m_stop = false;
+    m_finished = false;
+    for (auto& lp : m_lps)
+    {
+        lp->stop = false;
+    }
+
+    bool stopped = false;
+    std::barrier<> barrier(m_lps.size());
+    std::vector<std::thread> workers;
+    for (uint32_t i = 1; i < m_lps.size(); i++)
+    {
+        workers.emplace_back(&MultithreadedSimulatorImpl::WorkerThread,
+                             this,
+                             i,
+                             std::ref(barrier));
+    }
+
+    while (true)
+    {
+        ProcessInboxes();
+        uint64_t start = UINT64_MAX;
+        for (auto& lp : m_lps)
+        {
+            if (!lp->events->IsEmpty())
+            {
+                start = std::min(start, lp->events->PeekNext().key.m_ts);
+            }
+        }
+        if (start >= m_stopTs)
+        {
+            stopped = true;
+            break;
+        }
+        if (m_stop || start == UINT64_MAX)
+        {
+            break;
+        }
+
+        // A window without lookahead holds a single time stamp.
+        uint64_t width = std::max<uint64_t>(m_lookahead, 1);
+        m_windowEnd = (start > UINT64_MAX - width) ? UINT64_MAX : start + width;
+        m_windowEnd = std::min<uint64_t>(m_windowEnd, m_stopTs);
+
+        barrier.arrive_and_wait();
+        ProcessWindow(*m_lps[0]);
+        barrier.arrive_and_wait();
+    }
+
+    m_finished = true;
+    barrier.arrive_and_wait();
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    for (auto& lp : m_lps)
+    {
+        m_currentTs = std::max(m_currentTs, lp->currentTs);
+    }
+    if (stopped)
+    {
+        // Stop(delay) reached
+        m_currentTs = m_stopTs;
+        m_stopTs = UINT64_MAX;
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsFinished() const
+{
+    if (m_stop)
+    {
+        return true;
+    }
+    for (const auto& lp : m_lps)
+    {
+        if (!lp->events->IsEmpty() || !lp->inbox.empty())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+MultithreadedSimulatorImpl::Stop()
+{
+    NS_LOG_FUNCTION(this);
+    LogicalProcess* current = GetCurrent();
+    if (current)
+    {
+        current->stop = true;
+    }
+    m_stop = true;
+}
+
+EventId
+MultithreadedSimulatorImpl::Stop(const Time& delay)
+{
+    NS_LOG_FUNCTION(this << delay.GetTimeStep());
+    uint64_t ts = (Now() + delay).GetTimeStep();
+    uint64_t stopTs = m_stopTs.load();
+    while (ts < stopTs && !m_stopTs.compare_exchange_weak(stopTs, ts))
+    {
+    }
+    // Run() stops before the events of the stop time stamp: this event only
+    // keeps the simulation running until then.
+    return Simulator::Schedule(delay, []() {});
+}
+
+EventId
+MultithreadedSimulatorImpl::Schedule(const Time& delay, EventImpl* event)
+{
+    NS_ASSERT_MSG(delay.IsPositive(), "MultithreadedSimulatorImpl::Schedule(): Negative delay");
+    LogicalProcess& lp = GetScheduling();
+    uint64_t now = GetCurrent() ? lp.currentTs : m_currentTs;
+    uint64_t ts = (delay + TimeStep(now)).GetTimeStep();
+    Scheduler::EventKey key = Insert(lp, GetContext(), ts, event);
+    return EventId(event, key.m_ts, key.m_context, key.m_uid);
+}
+
+void
+MultithreadedSimulatorImpl::ScheduleWithContext(uint32_t context,
+                                                const Time& delay,
+                                                EventImpl* event)
+{
+    LogicalProcess* current = GetCurrent();
+    if (!current)
+    {
+        // Outside of the events: the logical processes are not running, and
+        // the partition may still change until Run(), which moves the event
+        // to the logical process of its context.
+        CreateLogicalProcesses();
+        LogicalProcess& target = *m_lps[0];
+        uint64_t ts = (delay + TimeStep(m_currentTs)).GetTimeStep();
+        std::unique_lock lock{target.inboxMutex};
+        target.inbox.push_back(RemoteEvent{context, ts, event});
+        return;
+    }
+
+    uint64_t ts = (delay + TimeStep(current->currentTs)).GetTimeStep();
+    LogicalProcess& target = *m_lps[GetLogicalProcess(context)];
+    if (&target == current)
+    {
+        Insert(target, context, ts, event);
+        return;
+    }
+    NS_ABORT_MSG_IF(m_lookahead > 0 && ts < m_windowEnd,
+                    "Event scheduled from context " << current->currentContext << " to context "
+                                                    << context << " with a delay of " << delay
+                                                    << ", shorter than the lookahead "
+                                                    << TimeStep(m_lookahead));
+    std::unique_lock lock{target.inboxMutex};
+    target.inbox.push_back(RemoteEvent{context, ts, event});
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleNow(EventImpl* event)
+{
+    return Schedule(Time(0), event);
+}
+
+EventId
+MultithreadedSimulatorImpl::ScheduleDestroy(EventImpl* event)
+{
+    std::unique_lock lock{m_destroyMutex};
+    EventId id(Ptr<EventImpl>(event, false), m_currentTs, 0xffffffff, EventId::UID::DESTROY);
+    m_destroyEvents.push_back(id);
+    return id;
+}
+
+Time
+MultithreadedSimulatorImpl::Now() const
+{
+    // Do not add function logging here, to avoid stack overflow
+    LogicalProcess* current = GetCurrent();
+    return TimeStep(current ? current->currentTs : m_currentTs);
+}
+
+Time
+MultithreadedSimulatorImpl::GetDelayLeft(const EventId& id) const
+{
+    if (IsExpired(id))
+    {
+        return TimeStep(0);
+    }
+    return TimeStep(id.GetTs()) - Now();
+}
+
+void
+MultithreadedSimulatorImpl::Remove(const EventId& id)
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        std::unique_lock lock{m_destroyMutex};
+        m_destroyEvents.remove(id);
+        return;
+    }
+    if (IsExpired(id))
+    {
+        return;
+    }
+    // An EventId is only returned by Schedule(), which inserts the event in
+    // the event list of the calling logical process, never in an inbox.
+    LogicalProcess& lp = GetOwner(id);
+    Scheduler::Event event;
+    event.impl = id.PeekEventImpl();
+    event.key.m_ts = id.GetTs();
+    event.key.m_context = id.GetContext();
+    event.key.m_uid = id.GetUid();
+    lp.events->Remove(event);
+    event.impl->Cancel();
+    // whenever we remove an event from the event list, we have to unref it.
+    event.impl->Unref();
+
+    lp.unscheduledEvents--;
+}
+
+void
+MultithreadedSimulatorImpl::Cancel(const EventId& id)
+{
+    if (!IsExpired(id))
+    {
+        id.PeekEventImpl()->Cancel();
+    }
+}
+
+bool
+MultithreadedSimulatorImpl::IsExpired(const EventId& id) const
+{
+    if (id.GetUid() == EventId::UID::DESTROY)
+    {
+        if (id.PeekEventImpl() == nullptr || id.PeekEventImpl()->IsCancelled())
+        {
+            return true;
+        }
+        std::unique_lock lock{const_cast<MultithreadedSimulatorImpl*>(this)->m_destroyMutex};
+        return std::find(m_destroyEvents.begin(), m_destroyEvents.end(), id) ==
+               m_destroyEvents.end();
+    }
+    if (id.PeekEventImpl() == nullptr)
+    {
+        return true;
+    }
+    const LogicalProcess& lp = GetOwner(id);
+    if (id.PeekEventImpl()->IsCancelled())
+    {
+        return true;
+    }
+    return id.GetTs() < lp.currentTs ||
+           (id.GetTs() == lp.currentTs && id.GetUid() <= lp.currentUid);
+}
+
+MultithreadedSimulatorImpl::LogicalProcess&
+MultithreadedSimulatorImpl::GetOwner(const EventId& id) const
+{
+    LogicalProcess& lp = *m_lps[GetLogicalProcess(id.GetContext())];
+    LogicalProcess* current = GetCurrent();
+    NS_ABORT_MSG_IF(current && current != &lp,
+                    "Event of context " << id.GetContext() << " accessed from context "
+                                        << current->currentContext
+                                        << ", in another logical process");
+    return lp;
+}
+
+Time
+MultithreadedSimulatorImpl::GetMaximumSimulationTime() const
+{
+    return TimeStep(0x7fffffffffffffffLL);
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetSystemId() const
+{
+    return 0;
+}
+
+uint32_t
+MultithreadedSimulatorImpl::GetContext() const
+{
+    LogicalProcess* current = GetCurrent();
+    return current ? current->currentContext : Simulator::NO_CONTEXT;
+}
+
+uint64_t
+MultithreadedSimulatorImpl::GetEventCount() const
+{
+    uint64_t count = 0;
+    for (const auto& lp : m_lps)
+    {
+        count += lp->eventCount;
+    }
+    return count;
+}
+
+} // namespace ns3
@@ -0,0 +1,240 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef MULTITHREADED_SIMULATOR_IMPL_H
+#define MULTITHREADED_SIMULATOR_IMPL_H
+
+#include "ns3/nstime.h"
+#include "ns3/object-factory.h"
+#include "ns3/scheduler.h"
+#include "ns3/simulator-impl.h"
+
+#include <atomic>
+#include <barrier>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @file
+ * @ingroup simulator
+ * ns3::MultithreadedSimulatorImpl declaration.
+ */
+
+namespace ns3
+{
+
+/**
+ * @ingroup simulator
+ *
+ * @brief Conservative parallel simulator running on the threads of a
+ * single process.
+ *
+ * The contexts (i.e., the node ids) are partitioned into logical
+ * processes, one per thread.  The nodes connected by a channel are kept in
+ * the same logical process, since a channel, e.g., a CsmaChannel, holds
+ * state shared by its devices; only the PointToPointChannel, whose two
+ * directions are independent, may connect nodes of different logical
+ * processes.  The groups of nodes so formed are assigned by decreasing
+ * size, each to the logical process with the fewest nodes.  AssignContext()
+ * overrides the logical process of a node, which the other nodes of its
+ * group follow.  The contexts which are not node ids belong to the logical
+ * process <tt>c % Threads</tt>, and the events without context to the
+ * logical process 0.  The partition follows the NodeList and the
+ * ChannelList until the first Run(), and is then kept.
+ *
+ * Each logical process has its own event list.  The simulation advances
+ * by windows: the start of a window is the earliest event of all the
+ * logical processes, and its end is the start plus the lookahead.  The
+ * threads execute the events of the window of their logical process in
+ * parallel, then meet at a barrier, where the events scheduled for other
+ * logical processes are inserted in their event lists.  This is correct as
+ * long as an event scheduled for another logical process is not earlier
+ * than the end of the window, i.e., the delay of Simulator::ScheduleWithContext
+ * between contexts of different logical processes is at least the
+ * lookahead; a shorter delay is a fatal error.
+ *
+ * The \c Lookahead attribute sets the lookahead.  If it is zero, the
+ * lookahead is the smallest \c Delay attribute of the channels (e.g.,
+ * PointToPointChannel, CsmaChannel or SimpleChannel) connecting nodes of
+ * different logical processes, found in the ChannelList when Run() is
+ * called.  If such a channel has no \c Delay attribute, each window holds
+ * a single time stamp.
+ *
+ * Simulator::Stop(delay) ends the simulation at the same time stamp in all
+ * the logical processes, before the events of that time stamp.
+ * Simulator::Stop() called from an event stops the other logical processes
+ * at the end of the current window.
+ *
+ * @warning The models must be safe to run on several threads: the state
+ * of a node must only be accessed from events in its context, and the
+ * objects shared between contexts of different logical processes must be
+ * thread-safe.  In particular, the reference counts of Packet and of its
+ * buffers are not atomic: a packet must not be referenced at the same
+ * time from two logical processes.  During Run(), an event may only be
+ * canceled, removed or checked (e.g., with EventId::IsPending()) from the
+ * logical process which scheduled it, otherwise the simulation is aborted.
+ * Events may not be scheduled from other threads during Run().
+ */
+class MultithreadedSimulatorImpl : public SimulatorImpl
+{
+  public:
+    /**
+     *  Register this type.
+     *  @return The object TypeId.
+     */
+    static TypeId GetTypeId();
+
+    /** Constructor. */
+    MultithreadedSimulatorImpl();
+    /** Destructor. */
+    ~MultithreadedSimulatorImpl() override;
+
+    // Inherited
+    void Destroy() override;
+    bool IsFinished() const override;
+    void Stop() override;
+    EventId Stop(const Time& delay) override;
+    EventId Schedule(const Time& delay, EventImpl* event) override;
+    void ScheduleWithContext(uint32_t context, const Time& delay, EventImpl* event) override;
+    EventId ScheduleNow(EventImpl* event) override;
+    EventId ScheduleDestroy(EventImpl* event) override;
+    void Remove(const EventId& id) override;
+    void Cancel(const EventId& id) override;
+    bool IsExpired(const EventId& id) const override;
+    void Run() override;
+    Time Now() const override;
+    Time GetDelayLeft(const EventId& id) const override;
+    Time GetMaximumSimulationTime() const override;
+    void SetScheduler(ObjectFactory schedulerFactory) override;
+    uint32_t GetSystemId() const override;
+    uint32_t GetContext() const override;
+    uint64_t GetEventCount() const override;
+
+    /**
+     * Assign a context to a logical process.
+     *
+     * Must be called before the first Run().
+     *
+     * @param [in] context The context (node id).
+     * @param [in] lp The logical process, lower than the \c Threads attribute.
+     */
+    void AssignContext(uint32_t context, uint32_t lp);
+
+    /**
+     * @param [in] context The context (node id).
+     * @returns The logical process of the context.
+     */
+    uint32_t GetLogicalProcess(uint32_t context) const;
+
+    /**
+     * Get the lookahead, from the \c Lookahead attribute or from the
+     * channels connecting nodes of different logical processes.
+     *
+     * @returns The lookahead, or Time::Max() if no channel connects nodes
+     *          of different logical processes.
+     */
+    Time GetLookahead() const;
+
+  private:
+    void DoDispose() override;
+
+    /** An event scheduled for another logical process. */
+    struct RemoteEvent
+    {
+        uint32_t context;  //!< The event context.
+        uint64_t ts;       //!< The absolute event time stamp.
+        EventImpl* event;  //!< The event implementation.
+    };
+
+    /** A logical process. */
+    struct LogicalProcess
+    {
+        Ptr<Scheduler> events;          //!< The event list
+        uint64_t currentTs{0};          //!< Time stamp of the current event
+        uint32_t currentContext;        //!< Context of the current event
+        uint32_t currentUid;            //!< Unique id of the current event
+        uint32_t uid;                   //!< Next event unique id
+        uint64_t eventCount{0};         //!< Number of events executed
+        int unscheduledEvents{0};       //!< Number of events inserted but not yet executed
+        bool stop{false};               //!< Simulator::Stop() called from this logical process
+        std::mutex inboxMutex;          //!< Mutex protecting the inbox
+        std::vector<RemoteEvent> inbox; //!< Events scheduled by other logical processes
+    };
+
+    /** Create the logical processes, if not yet done. */
+    void CreateLogicalProcesses();
+    /**
+     * Partition the nodes in logical processes, unless the partition is up
+     * to date with the NodeList, the ChannelList and the \c Threads
+     * attribute, or has been kept by Run().
+     */
+    void UpdatePartition() const;
+    /**
+     * Get the logical process holding an event, which must be the one of
+     * the calling thread during Run().
+     * @param [in] id The event.
+     * @returns The logical process of the event.
+     */
+    LogicalProcess& GetOwner(const EventId& id) const;
+    /**
+     * Get the logical process of the calling thread.
+     * @returns The logical process running on this thread, or nullptr
+     *          outside Run() and on the other threads.
+     */
+    LogicalProcess* GetCurrent() const;
+    /**
+     * Get the logical process to schedule an event from the calling thread.
+     * @returns The logical process running on this thread, or the one of
+     *          the events without context.
+     */
+    LogicalProcess& GetScheduling();
+    /**
+     * Insert an event in a logical process.
+     * @param [in] lp The logical process.
+     * @param [in] context The event context.
+     * @param [in] ts The event time stamp.
+     * @param [in] event The event implementation.
+     * @returns The event key.
+     */
+    Scheduler::EventKey Insert(LogicalProcess& lp, uint32_t context, uint64_t ts, EventImpl* event);
+    /** Move the events of the inboxes to the event lists. */
+    void ProcessInboxes();
+    /**
+     * Execute the events of a logical process in the current window.
+     * @param [in] lp The logical process.
+     */
+    void ProcessWindow(LogicalProcess& lp);
+    /**
+     * Body of the worker threads.
+     * @param [in] index The logical process of the thread.
+     * @param [in] barrier The barrier delimiting the windows.
+     */
+    void WorkerThread(uint32_t index, std::barrier<>& barrier);
+
+    uint32_t m_nThreads;                                //!< Number of threads
+    Time m_lookaheadAttribute;                          //!< Lookahead attribute
+    ObjectFactory m_schedulerFactory;                   //!< Factory of the event lists
+    std::vector<std::unique_ptr<LogicalProcess>> m_lps; //!< The logical processes
+    std::vector<uint32_t> m_assignedContexts;           //!< Logical processes of AssignContext()
+    mutable std::vector<uint32_t> m_partition;          //!< Logical process of the nodes
+    mutable uint32_t m_partitionNodes;                  //!< Number of nodes of the partition
+    mutable uint32_t m_partitionChannels;               //!< Number of channels of the partition
+    mutable uint32_t m_partitionThreads;                //!< Number of threads of the partition
+    bool m_partitionKept;                               //!< Partition kept by Run()
+    uint64_t m_currentTs;                               //!< Time stamp outside Run()
+    uint64_t m_windowEnd;                               //!< End of the current window
+    uint64_t m_lookahead;                               //!< Lookahead used by Run()
+    std::atomic<uint64_t> m_stopTs;                     //!< Time stamp of Stop(delay)
+    std::atomic<bool> m_stop;                           //!< Stop at the end of the window
+    bool m_finished;                                    //!< Tell the workers to exit
+    std::mutex m_destroyMutex;                          //!< Mutex protecting m_destroyEvents
+    std::list<EventId> m_destroyEvents;                 //!< Events to run at Destroy()
+};
+
+} // namespace ns3
+
+#endif /* MULTITHREADED_SIMULATOR_IMPL_H */
@@ -0,0 +1,145 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "p2-quantile-estimator.h"
+
+#include "ns3/assert.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ns3
+{
+
+P2QuantileEstimator::P2QuantileEstimator(double quantile)
+    : m_p(quantile)
+{
+    NS_ASSERT_MSG(quantile >= 0 && quantile <= 1, "Quantile must be in [0, 1]");
+    Reset();
+}
+
+void
+P2QuantileEstimator::Reset()
+{
+    m_count = 0;
+    m_heights.fill(0);
+    m_positions = {0, 1, 2, 3, 4};
+    m_desired = {0, 2 * m_p, 4 * m_p, 2 + 2 * m_p, 4};
+    m_increments = {0, m_p / 2, m_p, (1 + m_p) / 2, 1};
+}
+
+double
+P2QuantileEstimator::GetQuantile() const
+{
+    return m_p;
+}
+
+uint64_t
+P2QuantileEstimator::Count() const
+{
+    return m_count;
+}
+
+void
+P2QuantileEstimator::Update(double x)
+{
+    if (m_count < 5)
+    {
+        m_heights[m_count++] = x;
+        if (m_count == 5)
+        {
+            std::sort(m_heights.begin(), m_heights.end());
+        }
+        return;
+    }
+    m_count++;
+
+    // Find the cell k such that m_heights[k] <= x < m_heights[k+1], extending the extremes.
+    uint32_t k;
+    if (x < m_heights[0])
+    {
+        m_heights[0] = x;
+        k = 0;
+    }
+    else if (x >= m_heights[4])
+    {
+        m_heights[4] = x;
+        k = 3;
+    }
+    else
+    {
+        k = 0;
+        while (x >= m_heights[k + 1])
+        {
+            k++;
+        }
+    }
+
+    for (uint32_t i = k + 1; i < 5; i++)
+    {
+        m_positions[i]++;
+    }
+    for (uint32_t i = 0; i < 5; i++)
+    {
+        m_desired[i] += m_increments[i];
+    }
+
+    // Adjust the heights of the three middle markers if they are off their desired positions.
+    for (uint32_t i = 1; i < 4; i++)
+    {
+        double d = m_desired[i] - m_positions[i];
+        if ((d >= 1 && m_positions[i + 1] - m_positions[i] > 1) ||
+            (d <= -1 && m_positions[i - 1] - m_positions[i] < -1))
+        {
+            int32_t dir = d > 0 ? 1 : -1;
+            double candidate = Parabolic(i, dir);
+            if (m_heights[i - 1] < candidate && candidate < m_heights[i + 1])
+            {
+                m_heights[i] = candidate;
+            }
+            else
+            {
+                m_heights[i] = Linear(i, dir);
+            }
+            m_positions[i] += dir;
+        }
+    }
+}
+
+double
+P2QuantileEstimator::Parabolic(uint32_t i, double d) const
+{
+    const auto& q = m_heights;
+    const auto& n = m_positions;
+    return q[i] + d / (n[i + 1] - n[i - 1]) *
+                      ((n[i] - n[i - 1] + d) * (q[i + 1] - q[i]) / (n[i + 1] - n[i]) +
+                       (n[i + 1] - n[i] - d) * (q[i] - q[i - 1]) / (n[i] - n[i - 1]));
+}
+
+double
+P2QuantileEstimator::Linear(uint32_t i, int32_t d) const
+{
+    return m_heights[i] +
+           d * (m_heights[i + d] - m_heights[i]) / (m_positions[i + d] - m_positions[i]);
+}
+
+double
+P2QuantileEstimator::Estimate() const
+{
+    if (m_count == 0)
+    {
+        return 0;
+    }
+    if (m_count < 5)
+    {
+        // Not enough samples for the markers: use the exact (nearest-rank) quantile.
+        std::array<double, 5> sorted = m_heights;
+        std::sort(sorted.begin(), sorted.begin() + m_count);
+        auto rank = static_cast<uint32_t>(std::ceil(m_p * m_count));
+        return sorted[rank > 0 ? rank - 1 : 0];
+    }
+    return m_heights[2];
+}
+
+} // namespace ns3
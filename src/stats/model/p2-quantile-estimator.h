@@ -0,0 +1,88 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#ifndef P2_QUANTILE_ESTIMATOR_H
+#define P2_QUANTILE_ESTIMATOR_H
+
+#include <array>
+#include <cstdint>
+
+namespace ns3
+{
+
+/**
+ * @ingroup stats
+ *
+ * @brief Streaming estimator of a single quantile using the P-square algorithm.
+ *
+ * The estimator keeps five markers whose heights approximate the minimum,
+ * the p/2, p and (1+p)/2 quantiles and the maximum of the samples seen so far,
+ * see R. Jain and I. Chlamtac, "The P-square algorithm for dynamic calculation
+ * of quantiles and histograms without storing observations", CACM 28(10), 1985.
+ *
+ * Memory usage is constant and each update costs O(1), regardless of the
+ * number of samples.  With fewer than five samples the exact quantile is
+ * returned.
+ */
+class P2QuantileEstimator
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param quantile the quantile to estimate, in [0, 1]
+     */
+    P2QuantileEstimator(double quantile = 0.5);
+
+    /**
+     * Add a new sample
+     * @param x The sample
+     */
+    void Update(double x);
+
+    /// Reset the estimator, keeping the configured quantile
+    void Reset();
+
+    /**
+     * @return the quantile being estimated
+     */
+    double GetQuantile() const;
+
+    /**
+     * @return the number of samples seen since the last reset
+     */
+    uint64_t Count() const;
+
+    /**
+     * @return the current estimate, or 0 if no samples were added
+     */
+    double Estimate() const;
+
+  private:
+    /**
+     * Piecewise-parabolic prediction of the height of a marker.
+     * @param i the marker index
+     * @param d the direction of the adjustment (+1 or -1)
+     * @return the predicted height
+     */
+    double Parabolic(uint32_t i, double d) const;
+
+    /**
+     * Linear prediction of the height of a marker.
+     * @param i the marker index
+     * @param d the direction of the adjustment (+1 or -1)
+     * @return the predicted height
+     */
+    double Linear(uint32_t i, int32_t d) const;
+
+    double m_p;                          //!< Quantile to estimate.
+    uint64_t m_count;                    //!< Number of samples.
+    std::array<double, 5> m_heights;     //!< Marker heights.
+    std::array<double, 5> m_positions;   //!< Actual marker positions.
+    std::array<double, 5> m_desired;     //!< Desired marker positions.
+    std::array<double, 5> m_increments;  //!< Increments of the desired positions.
+};
+
+} // namespace ns3
+
+#endif /* P2_QUANTILE_ESTIMATOR_H */
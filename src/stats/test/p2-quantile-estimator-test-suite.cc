@@ -0,0 +1,81 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+#include "ns3/p2-quantile-estimator.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * @ingroup stats-tests
+ *
+ * @brief P2QuantileEstimator Test
+ */
+class P2QuantileEstimatorTestCase : public TestCase
+{
+  public:
+    P2QuantileEstimatorTestCase();
+
+  private:
+    void DoRun() override;
+};
+
+P2QuantileEstimatorTestCase::P2QuantileEstimatorTestCase()
+    : TestCase("P2QuantileEstimator")
+{
+}
+
+void
+P2QuantileEstimatorTestCase::DoRun()
+{
+    P2QuantileEstimator median(0.5);
+    NS_TEST_EXPECT_MSG_EQ(median.Estimate(), 0, "Empty estimator must return 0");
+
+    // Exact results with fewer than five samples.
+    median.Update(3);
+    median.Update(1);
+    median.Update(2);
+    NS_TEST_EXPECT_MSG_EQ(median.Count(), 3, "Wrong sample count");
+    NS_TEST_EXPECT_MSG_EQ(median.Estimate(), 2, "Wrong exact median");
+
+    // Uniform ramp, inserted in a scrambled order: the quantiles are known.
+    const uint32_t n = 10007; // prime, so i * 7919 % n is a permutation of [0, n)
+    P2QuantileEstimator p50(0.5);
+    P2QuantileEstimator p90(0.9);
+    P2QuantileEstimator p99(0.99);
+    for (uint32_t i = 0; i < n; i++)
+    {
+        double x = (static_cast<uint64_t>(i) * 7919) % n;
+        p50.Update(x);
+        p90.Update(x);
+        p99.Update(x);
+    }
+    NS_TEST_EXPECT_MSG_EQ(p50.Count(), n, "Wrong sample count");
+    NS_TEST_EXPECT_MSG_EQ_TOL(p50.Estimate(), 0.50 * n, 0.01 * n, "Wrong p50 estimate");
+    NS_TEST_EXPECT_MSG_EQ_TOL(p90.Estimate(), 0.90 * n, 0.01 * n, "Wrong p90 estimate");
+    NS_TEST_EXPECT_MSG_EQ_TOL(p99.Estimate(), 0.99 * n, 0.01 * n, "Wrong p99 estimate");
+
+    p50.Reset();
+    NS_TEST_EXPECT_MSG_EQ(p50.Count(), 0, "Reset must clear the samples");
+    NS_TEST_EXPECT_MSG_EQ(p50.GetQuantile(), 0.5, "Reset must keep the quantile");
+}
+
+/**
+ * @ingroup stats-tests
+ *
+ * @brief P2QuantileEstimator TestSuite
+ */
+class P2QuantileEstimatorTestSuite : public TestSuite
+{
+  public:
+    P2QuantileEstimatorTestSuite();
+};
+
+P2QuantileEstimatorTestSuite::P2QuantileEstimatorTestSuite()
+    : TestSuite("p2-quantile-estimator", Type::UNIT)
+{
+    AddTestCase(new P2QuantileEstimatorTestCase, TestCase::Duration::QUICK);
+}
+
+static P2QuantileEstimatorTestSuite g_p2QuantileTestSuite; //!< Static variable for test initialization
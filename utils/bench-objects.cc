@@ -0,0 +1,195 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program can be used to benchmark Object::GetObject() on an Object
+// with several aggregates, as done on per-packet paths, e.g.,
+// node->GetObject<Ipv4>() for each packet.
+// Sample usage:  ./ns3 run 'bench-objects --n=10000000 --aggregates=8'
+
+#include "ns3/command-line.h"
+#include "ns3/object.h"
+#include "ns3/system-wall-clock-ms.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace ns3;
+
+/**
+ * An Object type to aggregate, distinguished by its template parameter.
+ * @tparam N The index of the type.
+ */
+template <int N>
+class BenchObject : public Object
+{
+  public:
+    /**
+     * Register this type.
+     * @return The TypeId.
+     */
+    static TypeId GetTypeId()
+    {
+        static TypeId tid = TypeId("ns3::BenchObject<" + std::to_string(N) + ">")
+                                .SetParent<Object>()
+                                .AddConstructor<BenchObject>();
+        return tid;
+    }
+};
+
+/**
+ * The lookup of Object::DoGetObject() before its results were cached: the
+ * aggregates are scanned, walking the TypeId parents of each of them, and
+ * the found aggregate is moved ahead of the aggregates accessed less often.
+ */
+class UncachedAggregates
+{
+  public:
+    /**
+     * Constructor.
+     * @param [in] object The aggregating Object.
+     */
+    UncachedAggregates(Ptr<Object> object)
+    {
+        Object::AggregateIterator it = object->GetAggregateIterator();
+        while (it.HasNext())
+        {
+            m_buffer.push_back({PeekPointer(it.Next()), 0});
+        }
+    }
+
+    /**
+     * Find an aggregate.
+     * @param [in] tid The TypeId of the aggregate.
+     * @returns The aggregate, or null if not found.
+     */
+    Ptr<Object> Get(TypeId tid)
+    {
+        TypeId objectTid = Object::GetTypeId();
+        for (std::size_t i = 0; i < m_buffer.size(); i++)
+        {
+            TypeId cur = m_buffer[i].object->GetInstanceTypeId();
+            while (cur != tid && cur != objectTid)
+            {
+                cur = cur.GetParent();
+            }
+            if (cur == tid)
+            {
+                const Object* current = m_buffer[i].object;
+                m_buffer[i].count++;
+                for (std::size_t j = i; j > 0 && m_buffer[j].count > m_buffer[j - 1].count; j--)
+                {
+                    std::swap(m_buffer[j], m_buffer[j - 1]);
+                }
+                return const_cast<Object*>(current);
+            }
+        }
+        return nullptr;
+    }
+
+  private:
+    /** An aggregate and its access count. */
+    struct Entry
+    {
+        const Object* object; //!< The aggregate
+        uint32_t count;       //!< The number of lookups which found it
+    };
+
+    std::vector<Entry> m_buffer; //!< The aggregates, sorted by access count
+};
+
+/**
+ * Run a benchmark and print its result.
+ * @param [in] name The name of the benchmark.
+ * @param [in] n The number of lookups.
+ * @param [in] lookup The function doing one lookup.
+ */
+template <typename F>
+static void
+Run(const std::string& name, uint64_t n, F lookup)
+{
+    uint64_t found = 0;
+    SystemWallClockMs timer;
+    timer.Start();
+    for (uint64_t i = 0; i < n; i++)
+    {
+        found += lookup() ? 1 : 0;
+    }
+    int64_t ms = timer.End();
+    std::cout << std::left << std::setw(40) << name << std::right << std::setw(10) << ms << " ms"
+              << std::setw(10) << std::fixed << std::setprecision(2) << ms * 1e6 / n
+              << " ns/lookup" << std::setw(12) << found << " found" << std::endl;
+}
+
+int
+main(int argc, char* argv[])
+{
+    uint64_t n = 10000000;
+    uint32_t aggregates = 8;
+
+    CommandLine cmd(__FILE__);
+    cmd.AddValue("n", "number of lookups", n);
+    cmd.AddValue("aggregates", "number of aggregated objects, from 3 to 8", aggregates);
+    cmd.Parse(argc, argv);
+    aggregates = std::min<uint32_t>(std::max<uint32_t>(aggregates, 3), 8);
+
+    // The aggregates of a node: the node itself, and its stack.
+    Ptr<Object> node = CreateObject<BenchObject<0>>();
+    Ptr<Object> objects[] = {nullptr,
+                             CreateObject<BenchObject<1>>(),
+                             CreateObject<BenchObject<2>>(),
+                             CreateObject<BenchObject<3>>(),
+                             CreateObject<BenchObject<4>>(),
+                             CreateObject<BenchObject<5>>(),
+                             CreateObject<BenchObject<6>>(),
+                             CreateObject<BenchObject<7>>()};
+    for (uint32_t i = 1; i < aggregates; i++)
+    {
+        node->AggregateObject(objects[i]);
+    }
+    TypeId first = BenchObject<0>::GetTypeId();
+    TypeId last = objects[aggregates - 1]->GetInstanceTypeId();
+    TypeId one = BenchObject<1>::GetTypeId();
+    TypeId two = BenchObject<2>::GetTypeId();
+    TypeId missing = BenchObject<9>::GetTypeId();
+
+    // Each uncached benchmark starts from the aggregates in their
+    // aggregation order, taken before any lookup sorts them.
+    const UncachedAggregates initial(node);
+    std::cout << "GetObject() on " << aggregates << " aggregates" << std::endl;
+    Run("GetObject, first aggregate", n, [&node, first]() {
+        return node->GetObject<Object>(first);
+    });
+    Run("uncached, first aggregate", n, [uncached = initial, first]() mutable {
+        return uncached.Get(first);
+    });
+    Run("GetObject, last aggregate", n, [&node, last]() { return node->GetObject<Object>(last); });
+    Run("uncached, last aggregate", n, [uncached = initial, last]() mutable {
+        return uncached.Get(last);
+    });
+    Run("GetObject, alternating aggregates", n, [&node, one, two, i = 0]() mutable {
+        i = 1 - i;
+        return node->GetObject<Object>(i ? one : two);
+    });
+    Run("uncached, alternating aggregates",
+        n,
+        [uncached = initial, one, two, i = 0]() mutable {
+            i = 1 - i;
+            return uncached.Get(i ? one : two);
+        });
+    Run("GetObject, missing aggregate", n / 10, [&node, missing]() {
+        return node->GetObject<Object>(missing);
+    });
+    Run("uncached, missing aggregate",
+        n / 10,
+        [uncached = initial, missing]() mutable {
+            return uncached.Get(missing);
+        });
+
+    node->Dispose();
+    return 0;
+}
@@ -373,28 +373,90 @@ BenchSuite::Log() const
     LOG("");
 }
 
+/**
+ *  Create a bimodal stream of event delays: mostly short delays, as the
+ *  link events of a busy LAN, mixed with long timers.
+ *
+ *  Nine delays out of ten are exponential with mean 100 ns, the other ones
+ *  are uniform between 0.5 s and 1.5 s.  The values are drawn once and
+ *  replayed by a DeterministicRandomVariable.
+ *
+ *  @returns The RandomVariableStream.
+ */
+Ptr<RandomVariableStream>
+GetBimodalStream()
+{
+    auto choice = CreateObject<UniformRandomVariable>();
+    auto shortDelay = CreateObject<ExponentialRandomVariable>();
+    shortDelay->SetAttribute("Mean", DoubleValue(100));
+    auto longDelay = CreateObject<UniformRandomVariable>();
+    longDelay->SetAttribute("Min", DoubleValue(0.5e9));
+    longDelay->SetAttribute("Max", DoubleValue(1.5e9));
+
+    std::vector<double> nsValues(1000000);
+    for (auto& value : nsValues)
+    {
+        value = choice->GetValue() < 0.9 ? shortDelay->GetValue() : longDelay->GetValue();
+    }
+    auto drv = CreateObject<DeterministicRandomVariable>();
+    drv->SetValueArray(nsValues);
+    return drv;
+}
+
 /**
  *  Create a RandomVariableStream to generate next event delays.
  *
- *  If the \p filename parameter is empty a default exponential time
- *  distribution will be used, with mean delay of 100 ns.
+ *  If the \p filename parameter is empty, the delays are drawn from the
+ *  \p dist distribution:
+ *  - `exp`: exponential, with mean delay of 100 ns (the default),
+ *  - `uniform`: uniform between 0 and 200 ns,
+ *  - `bimodal`: see GetBimodalStream(),
+ *  - `pareto`: heavy-tailed Pareto, with scale 10 ns and shape 1.1,
+ *    bounded at 1 s.
  *
  *  If the \p filename is `-` standard input will be used.
  *
  *  @param [in] filename The delay interval source file name.
+ *  @param [in] dist The delay distribution, if \p filename is empty.
  *  @returns The RandomVariableStream.
  */
 Ptr<RandomVariableStream>
-GetRandomStream(std::string filename)
+GetRandomStream(std::string filename, std::string dist)
 {
     Ptr<RandomVariableStream> stream = nullptr;
 
     if (filename.empty())
     {
-        LOG("  Event time distribution:      default exponential");
-        auto erv = CreateObject<ExponentialRandomVariable>();
-        erv->SetAttribute("Mean", DoubleValue(100));
-        stream = erv;
+        if (dist == "uniform")
+        {
+            LOG("  Event time distribution:      uniform");
+            auto urv = CreateObject<UniformRandomVariable>();
+            urv->SetAttribute("Min", DoubleValue(0));
+            urv->SetAttribute("Max", DoubleValue(200));
+            stream = urv;
+        }
+        else if (dist == "bimodal")
+        {
+            LOG("  Event time distribution:      bimodal");
+            stream = GetBimodalStream();
+        }
+        else if (dist == "pareto")
+        {
+            LOG("  Event time distribution:      pareto");
+            auto prv = CreateObject<ParetoRandomVariable>();
+            prv->SetAttribute("Scale", DoubleValue(10));
+            prv->SetAttribute("Shape", DoubleValue(1.1));
+            prv->SetAttribute("Bound", DoubleValue(1e9));
+            stream = prv;
+        }
+        else
+        {
+            NS_ABORT_MSG_IF(dist != "exp", "Unknown distribution " << dist);
+            LOG("  Event time distribution:      default exponential");
+            auto erv = CreateObject<ExponentialRandomVariable>();
+            erv->SetAttribute("Mean", DoubleValue(100));
+            stream = erv;
+        }
     }
     else
     {
@@ -442,15 +504,19 @@ main(int argc, char* argv[])
 {
     bool allSched = false;
     bool schedCal = false;
+    bool schedDary = false;
     bool schedHeap = false;
+    bool schedLadder = false;
     bool schedList = false;
     bool schedMap = false; // default scheduler
     bool schedPQ = false;
+    bool schedRadix = false;
 
     uint64_t pop = 100000;
     uint64_t total = 1000000;
     uint64_t runs = 1;
     std::string filename = "";
+    std::string dist = "exp";
     bool calRev = false;
 
     CommandLine cmd(__FILE__);
@@ -458,6 +524,7 @@ main(int argc, char* argv[])
               "\n"
               "Event intervals are taken from one of:\n"
               "  an exponential distribution, with mean 100 ns,\n"
+              "  another distribution, given by the --dist argument,\n"
               "  an ascii file, given by the --file=\"<filename>\" argument,\n"
               "  or standard input, by the argument --file=\"-\"\n"
               "In the case of either --file form, the input is expected\n"
@@ -467,15 +534,19 @@ main(int argc, char* argv[])
     cmd.AddValue("all", "use all schedulers", allSched);
     cmd.AddValue("cal", "use CalendarScheduler", schedCal);
     cmd.AddValue("calrev", "reverse ordering in the CalendarScheduler", calRev);
+    cmd.AddValue("dary", "use DaryHeapScheduler", schedDary);
     cmd.AddValue("heap", "use HeapScheduler", schedHeap);
+    cmd.AddValue("ladder", "use LadderScheduler", schedLadder);
     cmd.AddValue("list", "use ListScheduler", schedList);
     cmd.AddValue("map", "use MapScheduler (default)", schedMap);
     cmd.AddValue("pri", "use PriorityQueue", schedPQ);
+    cmd.AddValue("radix", "use RadixScheduler", schedRadix);
     cmd.AddValue("debug", "enable debugging output", g_debug);
     cmd.AddValue("pop", "event population size", pop);
     cmd.AddValue("total", "total number of events to run", total);
     cmd.AddValue("runs", "number of runs", runs);
     cmd.AddValue("file", "file of relative event times", filename);
+    cmd.AddValue("dist", "event time distribution: exp, uniform, bimodal or pareto", dist);
     cmd.AddValue("prec", "printed output precision", g_fwidth);
     cmd.Parse(argc, argv);
 
@@ -491,15 +562,17 @@ main(int argc, char* argv[])
 
     if (allSched)
     {
-        schedCal = schedHeap = schedList = schedMap = schedPQ = true;
+        schedCal = schedDary = schedHeap = schedLadder = true;
+        schedList = schedMap = schedPQ = schedRadix = true;
     }
     // Set the default case if nothing else is set
-    if (!(schedCal || schedHeap || schedList || schedMap || schedPQ))
+    if (!(schedCal || schedDary || schedHeap || schedLadder || schedList || schedMap || schedPQ ||
+          schedRadix))
     {
         schedMap = true;
     }
 
-    auto eventStream = GetRandomStream(filename);
+    auto eventStream = GetRandomStream(filename, dist);
 
     ObjectFactory factory("ns3::MapScheduler");
     if (schedCal)
@@ -513,11 +586,21 @@ main(int argc, char* argv[])
             BenchSuite(factory, pop, total, runs, eventStream, !calRev).Log();
         }
     }
+    if (schedDary)
+    {
+        factory.SetTypeId("ns3::DaryHeapScheduler");
+        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+    }
     if (schedHeap)
     {
         factory.SetTypeId("ns3::HeapScheduler");
         BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
     }
+    if (schedLadder)
+    {
+        factory.SetTypeId("ns3::LadderScheduler");
+        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+    }
     if (schedList)
     {
         factory.SetTypeId("ns3::ListScheduler");
@@ -539,6 +622,11 @@ main(int argc, char* argv[])
         factory.SetTypeId("ns3::PriorityQueueScheduler");
         BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
     }
+    if (schedRadix)
+    {
+        factory.SetTypeId("ns3::RadixScheduler");
+        BenchSuite(factory, pop, total, runs, eventStream, calRev).Log();
+    }
 
     return 0;
 }
@@ -0,0 +1,42 @@
+/*
+ * SPDX-License-Identifier: GPL-2.0-only
+ */
+
+// This program prints as text the log messages written to a binary log,
+// see ns3::BinaryLog.
+// Sample usage:
+//   NS_LOG="DhcpServer=info|prefix_all" NS_LOG_BINARY=dhcp.log ./ns3 run ...
+//   ./ns3 run 'print-binary-log --file=dhcp.log'
+
+#include "ns3/command-line.h"
+#include "ns3/log.h"
+
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace ns3;
+
+int
+main(int argc, char* argv[])
+{
+    std::string file;
+
+    CommandLine cmd(__FILE__);
+    cmd.Usage("Print the messages of a binary log as text.");
+    cmd.AddValue("file", "the binary log", file);
+    cmd.Parse(argc, argv);
+
+    std::ifstream is(file, std::ios::binary);
+    if (!is.is_open())
+    {
+        std::cerr << "Can't open " << file << std::endl;
+        return 1;
+    }
+    if (!BinaryLog::Decode(is, std::cout))
+    {
+        std::cerr << file << ": truncated or malformed binary log" << std::endl;
+        return 1;
+    }
+    return 0;
+}